@@ -0,0 +1,78 @@
+// Copyright (C) 2018-2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include "openvino/op/op.hpp"
+#include "transformations_visibility.hpp"
+
+namespace ov {
+namespace op {
+namespace internal {
+
+///
+/// \brief CTCPrefixBeamSearch operation decodes the CTC outputs by the prefix beam search.
+///
+/// The beam_size most probable label prefixes are kept at each time step, the probability of a prefix is the sum over
+/// all its alignments ending in the blank and in the last label. The logits are turned to the log probabilities by
+/// log softmax over the classes, so the log probabilities can be passed as well.
+///
+/// The optional token scores are a static per-class (unigram) bias: lm_weight * token_scores[c] is added each time a
+/// prefix is extended by the class c, whatever the prefix is. E.g. the log priors of the tokens or the boosted hot
+/// words. It's not a language model over the prefixes, the bias of a class doesn't depend on the preceding classes.
+///
+/// Inputs:
+///     1. Logits of type T1 - shape [N, T, C], where N - batch size, T - max sequence length, C - number of classes.
+///        Required
+///     2. Sequence lengths of type T2 - shape [N]. Required
+///     3. Blank index of type T2 - scalar or 1D tensor with a single element, C - 1 by default. Optional
+///     4. Token scores of type T1 - shape [C]. Optional, required if lm_weight is not 0
+/// Outputs:
+///     1. Decoded classes of the most probable prefix of type I32 - shape [N, T], padded with -1
+///     2. Lengths of the decoded classes of type I32 - shape [N]
+///     3. Log probabilities (with the token scores) of the decoded classes of type FP32 - shape [N]
+///
+/// \ingroup ov_ops_cpp_api
+class TRANSFORMATIONS_API CTCPrefixBeamSearch : public ov::op::Op {
+public:
+    OPENVINO_OP("CTCPrefixBeamSearch", "ie_internal_opset");
+
+    CTCPrefixBeamSearch() = default;
+
+    CTCPrefixBeamSearch(const Output<Node>& logits, const Output<Node>& sequence_length, size_t beam_size = 10);
+
+    CTCPrefixBeamSearch(const Output<Node>& logits,
+                        const Output<Node>& sequence_length,
+                        const Output<Node>& blank_index,
+                        size_t beam_size = 10);
+
+    CTCPrefixBeamSearch(const Output<Node>& logits,
+                        const Output<Node>& sequence_length,
+                        const Output<Node>& blank_index,
+                        const Output<Node>& token_scores,
+                        size_t beam_size,
+                        float lm_weight);
+
+    CTCPrefixBeamSearch(const OutputVector& args, size_t beam_size, float lm_weight);
+
+    bool visit_attributes(AttributeVisitor& visitor) override;
+    void validate_and_infer_types() override;
+    std::shared_ptr<Node> clone_with_new_inputs(const OutputVector& new_args) const override;
+
+    size_t get_beam_size() const {
+        return m_beam_size;
+    }
+
+    float get_lm_weight() const {
+        return m_lm_weight;
+    }
+
+private:
+    size_t m_beam_size = 10;
+    float m_lm_weight = 0.f;
+};
+
+}  // namespace internal
+}  // namespace op
+}  // namespace ov
@@ -0,0 +1,145 @@
+// Copyright (C) 2018-2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "ov_ops/ctc_prefix_beam_search.hpp"
+
+#include "itt.hpp"
+
+namespace ov {
+namespace op {
+namespace internal {
+
+CTCPrefixBeamSearch::CTCPrefixBeamSearch(const Output<Node>& logits,
+                                         const Output<Node>& sequence_length,
+                                         size_t beam_size)
+    : Op({logits, sequence_length}),
+      m_beam_size(beam_size) {
+    validate_and_infer_types();
+}
+
+CTCPrefixBeamSearch::CTCPrefixBeamSearch(const Output<Node>& logits,
+                                         const Output<Node>& sequence_length,
+                                         const Output<Node>& blank_index,
+                                         size_t beam_size)
+    : Op({logits, sequence_length, blank_index}),
+      m_beam_size(beam_size) {
+    validate_and_infer_types();
+}
+
+CTCPrefixBeamSearch::CTCPrefixBeamSearch(const Output<Node>& logits,
+                                         const Output<Node>& sequence_length,
+                                         const Output<Node>& blank_index,
+                                         const Output<Node>& token_scores,
+                                         size_t beam_size,
+                                         float lm_weight)
+    : Op({logits, sequence_length, blank_index, token_scores}),
+      m_beam_size(beam_size),
+      m_lm_weight(lm_weight) {
+    validate_and_infer_types();
+}
+
+CTCPrefixBeamSearch::CTCPrefixBeamSearch(const OutputVector& args, size_t beam_size, float lm_weight)
+    : Op(args),
+      m_beam_size(beam_size),
+      m_lm_weight(lm_weight) {
+    validate_and_infer_types();
+}
+
+std::shared_ptr<Node> CTCPrefixBeamSearch::clone_with_new_inputs(const OutputVector& new_args) const {
+    INTERNAL_OP_SCOPE(CTCPrefixBeamSearch_clone_with_new_inputs);
+    check_new_args_count(this, new_args);
+    return std::make_shared<CTCPrefixBeamSearch>(new_args, m_beam_size, m_lm_weight);
+}
+
+bool CTCPrefixBeamSearch::visit_attributes(AttributeVisitor& visitor) {
+    INTERNAL_OP_SCOPE(CTCPrefixBeamSearch_visit_attributes);
+    visitor.on_attribute("beam_size", m_beam_size);
+    visitor.on_attribute("lm_weight", m_lm_weight);
+    return true;
+}
+
+void CTCPrefixBeamSearch::validate_and_infer_types() {
+    INTERNAL_OP_SCOPE(CTCPrefixBeamSearch_validate_and_infer_types);
+    NODE_VALIDATION_CHECK(this, m_beam_size > 0, "beam_size attribute must be greater than zero");
+    NODE_VALIDATION_CHECK(this,
+                          get_input_size() >= 2 && get_input_size() <= 4,
+                          "Expects 2, 3 or 4 inputs whereas current number of inputs is ",
+                          get_input_size());
+    NODE_VALIDATION_CHECK(this,
+                          m_lm_weight == 0.f || get_input_size() == 4,
+                          "Non zero lm_weight attribute requires the 'token_scores' input");
+
+    const auto& logits_et = get_input_element_type(0);
+    const auto& logits_shape = get_input_partial_shape(0);
+    NODE_VALIDATION_CHECK(this,
+                          logits_et.is_dynamic() || logits_et.is_real(),
+                          "'logits' input must be real whereas current element type is ",
+                          logits_et);
+    NODE_VALIDATION_CHECK(this,
+                          logits_shape.rank().compatible(3),
+                          "'logits' input must have 3D shape whereas current shape is ",
+                          logits_shape);
+
+    const auto& seq_len_et = get_input_element_type(1);
+    const auto& seq_len_shape = get_input_partial_shape(1);
+    NODE_VALIDATION_CHECK(this,
+                          seq_len_et.is_dynamic() || seq_len_et.is_integral_number(),
+                          "'sequence_length' input must be integer whereas current element type is ",
+                          seq_len_et);
+    NODE_VALIDATION_CHECK(this,
+                          seq_len_shape.rank().compatible(1),
+                          "'sequence_length' input must have 1D shape whereas current shape is ",
+                          seq_len_shape);
+
+    if (get_input_size() > 2) {
+        const auto& blank_et = get_input_element_type(2);
+        const auto& blank_shape = get_input_partial_shape(2);
+        NODE_VALIDATION_CHECK(this,
+                              blank_et.is_dynamic() || blank_et.is_integral_number(),
+                              "'blank_index' input must be integer whereas current element type is ",
+                              blank_et);
+        NODE_VALIDATION_CHECK(this,
+                              blank_shape.compatible(PartialShape{}) || blank_shape.compatible(PartialShape{1}),
+                              "'blank_index' input must be a scalar or 1D tensor with a single element whereas "
+                              "current shape is ",
+                              blank_shape);
+    }
+
+    auto batch = Dimension::dynamic();
+    auto time = Dimension::dynamic();
+    auto classes = Dimension::dynamic();
+    if (logits_shape.rank().is_static()) {
+        batch = logits_shape[0];
+        time = logits_shape[1];
+        classes = logits_shape[2];
+    }
+    if (seq_len_shape.rank().is_static()) {
+        NODE_VALIDATION_CHECK(this,
+                              Dimension::merge(batch, batch, seq_len_shape[0]),
+                              "'sequence_length' input size must be equal to the 'logits' batch size");
+    }
+
+    if (get_input_size() > 3) {
+        const auto& scores_et = get_input_element_type(3);
+        const auto& scores_shape = get_input_partial_shape(3);
+        NODE_VALIDATION_CHECK(this,
+                              scores_et.is_dynamic() || scores_et.is_real(),
+                              "'token_scores' input must be real whereas current element type is ",
+                              scores_et);
+        NODE_VALIDATION_CHECK(this,
+                              scores_shape.rank().compatible(1) &&
+                                  (scores_shape.rank().is_dynamic() || scores_shape[0].compatible(classes)),
+                              "'token_scores' input must have 1D shape with the number of classes whereas current "
+                              "shape is ",
+                              scores_shape);
+    }
+
+    set_output_type(0, element::i32, {batch, time});
+    set_output_type(1, element::i32, {batch});
+    set_output_type(2, element::f32, {batch});
+}
+
+}  // namespace internal
+}  // namespace op
+}  // namespace ov
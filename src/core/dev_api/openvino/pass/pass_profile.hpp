@@ -0,0 +1,71 @@
+// Copyright (C) 2018-2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <chrono>
+#include <string>
+#include <vector>
+
+#include "openvino/core/core_visibility.hpp"
+
+namespace ov {
+namespace pass {
+
+/**
+ * @brief Execution statistics of a single pass run by ov::pass::Manager.
+ */
+struct PassProfile {
+    std::string name;                    //!< Pass name
+    size_t depth = 0;                    //!< Nesting level, the passes of the managers run by other passes have depth > 0
+    std::chrono::nanoseconds time{0};    //!< Wall time of the pass including the nested passes
+    size_t visited_nodes = 0;            //!< Number of the nodes the matcher passes were applied to
+    size_t matcher_invocations = 0;      //!< Number of the matcher passes applied to the nodes
+    size_t applied_rewrites = 0;         //!< Number of the matcher callbacks, which changed the model
+    bool applied = false;                //!< Whether the pass reported the model change
+};
+
+/**
+ * @brief Collects the profiles of all the passes run by the pass managers in the calling thread while the object is
+ * alive. The passes are recorded in the order they are started, so the nested passes follow their parent one.
+ * The scopes can be nested, then the innermost scope gets the profiles.
+ */
+class OPENVINO_API PassProfileScope {
+public:
+    PassProfileScope();
+    ~PassProfileScope();
+
+    PassProfileScope(const PassProfileScope&) = delete;
+    PassProfileScope& operator=(const PassProfileScope&) = delete;
+
+    const std::vector<PassProfile>& get_profile() const {
+        return m_profile;
+    }
+
+    /// \return the scope active in the calling thread or nullptr
+    static PassProfileScope* get_active();
+
+    /// \brief Adds the pass, which is started, and returns its index in the profile
+    size_t start_pass(const std::string& name);
+    void finish_pass(size_t index, std::chrono::nanoseconds time, bool applied);
+
+private:
+    PassProfileScope* m_parent;
+    std::vector<PassProfile> m_profile;
+    size_t m_depth = 0;
+};
+
+/**
+ * @brief Counters of the matcher passes applied by ov::pass::GraphRewrite in the calling thread.
+ */
+struct RewriteCounters {
+    size_t visited_nodes = 0;
+    size_t matcher_invocations = 0;
+    size_t applied_rewrites = 0;
+
+    OPENVINO_API static RewriteCounters& get_thread_local();
+};
+
+}  // namespace pass
+}  // namespace ov
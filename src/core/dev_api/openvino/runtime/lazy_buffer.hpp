@@ -0,0 +1,46 @@
+// Copyright (C) 2018-2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <atomic>
+#include <functional>
+#include <mutex>
+
+#include "openvino/runtime/aligned_buffer.hpp"
+
+namespace ov {
+
+/// \brief LazyBuffer class to store the data, which is generated on the first access.
+///
+/// The memory isn't allocated until the buffer is materialized, so get_ptr() returns nullptr for the buffer, which
+/// is not materialized yet. The owners (like ov::op::v0::Constant) access the data through materialize().
+class OPENVINO_API LazyBuffer final : public ov::AlignedBuffer {
+public:
+    /// \brief Function, which writes byte_size bytes of the data to the provided memory.
+    using Generator = std::function<void(void* data, size_t byte_size)>;
+
+    LazyBuffer(size_t byte_size, Generator generator, size_t alignment = 64);
+
+    ~LazyBuffer() override;
+
+    /// \brief Allocates the memory and generates the data if it's not done yet, thread safe.
+    /// The generator is destroyed once the data is generated, so the objects captured by it (e.g. the source
+    /// Constants) are released.
+    /// \return Pointer to the data.
+    void* materialize();
+
+    bool is_materialized() const;
+
+private:
+    LazyBuffer(const LazyBuffer&) = delete;
+    LazyBuffer& operator=(const LazyBuffer&) = delete;
+
+    Generator m_generator;
+    size_t m_alignment;
+    std::atomic<void*> m_materialized{nullptr};
+    std::mutex m_mutex;
+};
+
+}  // namespace ov
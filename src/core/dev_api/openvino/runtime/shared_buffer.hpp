@@ -4,6 +4,11 @@
 
 #pragma once
 
+#include <algorithm>
+#include <cstring>
+#include <memory>
+#include <streambuf>
+
 #include "openvino/runtime/aligned_buffer.hpp"
 
 namespace ov {
@@ -24,8 +29,83 @@ public:
         m_byte_size = 0;
     }
 
+    /// \brief Returns the object which owns the memory of the buffer.
+    const T& get_shared_object() const {
+        return _shared_object;
+    }
+
 private:
     T _shared_object;
 };
 
+/// \brief Read-only stream buffer over a pre-allocated memory region, it doesn't own the memory.
+class SharedStreamBuffer : public std::streambuf {
+public:
+    SharedStreamBuffer(char* data, size_t size) : m_data(data), m_size(size), m_offset(0) {}
+
+protected:
+    std::streamsize xsgetn(char* s, std::streamsize count) override {
+        const auto real_count = std::min<std::streamsize>(static_cast<std::streamsize>(m_size - m_offset), count);
+        std::memcpy(s, m_data + m_offset, static_cast<size_t>(real_count));
+        m_offset += static_cast<size_t>(real_count);
+        return real_count;
+    }
+
+    int_type underflow() override {
+        return m_size == m_offset ? traits_type::eof() : traits_type::to_int_type(m_data[m_offset]);
+    }
+
+    int_type uflow() override {
+        return m_size == m_offset ? traits_type::eof() : traits_type::to_int_type(m_data[m_offset++]);
+    }
+
+    std::streamsize showmanyc() override {
+        return static_cast<std::streamsize>(m_size - m_offset);
+    }
+
+    pos_type seekoff(off_type off, std::ios_base::seekdir dir, std::ios_base::openmode which) override {
+        off_type base = 0;
+        if (dir == std::ios_base::cur) {
+            base = static_cast<off_type>(m_offset);
+        } else if (dir == std::ios_base::end) {
+            base = static_cast<off_type>(m_size);
+        }
+        const off_type offset = base + off;
+        if (offset < 0 || offset > static_cast<off_type>(m_size)) {
+            return pos_type(off_type(-1));
+        }
+        m_offset = static_cast<size_t>(offset);
+        return pos_type(offset);
+    }
+
+    pos_type seekpos(pos_type pos, std::ios_base::openmode which) override {
+        return seekoff(off_type(pos), std::ios_base::beg, which);
+    }
+
+    char* m_data;
+    size_t m_size;
+    size_t m_offset;
+};
+
+/// \brief SharedStreamBuffer, which keeps the memory alive. The stream consumer may take the buffer to reference
+/// the data after the stream is destroyed.
+class OwningSharedStreamBuffer : public SharedStreamBuffer {
+public:
+    explicit OwningSharedStreamBuffer(std::shared_ptr<ov::AlignedBuffer> buffer)
+        : SharedStreamBuffer(static_cast<char*>(buffer->get_ptr()), buffer->size()),
+          m_shared_obj(std::move(buffer)) {}
+
+    std::shared_ptr<ov::AlignedBuffer> get_buffer() const {
+        return m_shared_obj;
+    }
+
+    // the current read position inside the buffer
+    size_t get_offset() const {
+        return m_offset;
+    }
+
+protected:
+    std::shared_ptr<ov::AlignedBuffer> m_shared_obj;
+};
+
 }  // namespace ov
@@ -4,11 +4,14 @@
 
 #pragma once
 
+#include <functional>
 #include <list>
 #include <memory>
 #include <typeinfo>
+#include <unordered_map>
 #include <vector>
 
+#include "openvino/pass/graph_rewrite.hpp"
 #include "openvino/pass/pass.hpp"
 #include "openvino/pass/validate.hpp"
 
@@ -51,6 +54,25 @@ public:
         return rc;
     }
 
+    /// \brief Register given MatcherPass class type to execution list. When the parallel execution is enabled by
+    /// set_parallel_matcher_passes, the pass is applied to the disjoint subgraphs of the model in parallel, a separate
+    /// pass instance is created per subgraph from the copies of the arguments. The model is split once for the
+    /// consecutive passes registered this way.
+    ///
+    /// The pass callback must modify only the nodes reachable from the matched root and must not change the model
+    /// itself (parameters, results, sinks).
+    ///
+    /// \return shared_ptr to the transformation instance, which is used for the serial execution
+    template <typename T, bool Enable = true, class... Args>
+    std::shared_ptr<T> register_parallel_pass(const Args&... args) {
+        static_assert(std::is_base_of<pass::MatcherPass, T>::value, "pass not derived from MatcherPass");
+        auto rc = register_pass<T, Enable>(args...);
+        m_matcher_pass_factories[rc.get()] = [args...]() -> std::shared_ptr<MatcherPass> {
+            return std::make_shared<T>(args...);
+        };
+        return rc;
+    }
+
     std::shared_ptr<PassBase> register_pass_instance(std::shared_ptr<PassBase> pass) {
         pass->set_pass_config(m_pass_config);
         m_pass_list.push_back(pass);
@@ -76,6 +98,13 @@ public:
     /// \param new_state Value "true" enables Validate pass run; "false", otherwise
     void set_per_pass_validation(bool new_state);
 
+    /// \brief Set flag to enable/disable the parallel execution of the passes registered with
+    /// register_parallel_pass over the disjoint subgraphs of the model
+    /// \param new_state Value "true" enables the parallel execution; "false", otherwise
+    void set_parallel_matcher_passes(bool new_state) {
+        m_parallel_matcher_passes = new_state;
+    }
+
     /// \return PassConfig shared object. This object is used for transformations pipeline
     /// configuration.
     /// This object allows to disable/enable transformations execution, set callback to
@@ -99,6 +128,8 @@ protected:
     std::vector<std::shared_ptr<PassBase>> m_pass_list;
     bool m_visualize = false;
     bool m_per_pass_validation = true;
+    bool m_parallel_matcher_passes = false;
+    std::unordered_map<const PassBase*, std::function<std::shared_ptr<MatcherPass>()>> m_matcher_pass_factories;
 };
 }  // namespace pass
 }  // namespace ov
@@ -12,6 +12,7 @@
 #include "openvino/op/util/attr_types.hpp"
 #include "openvino/reference/utils/coordinate_index.hpp"
 #include "openvino/reference/utils/coordinate_transform.hpp"
+#include "openvino/reference/utils/parallel_ranges.hpp"
 
 namespace ov {
 namespace reference {
@@ -70,33 +71,15 @@ inline size_t calculate_fixed_axis(size_t axis, const size_t* strides) {
         --axis;
     return axis;
 }
-}  // namespace internal
 
-/// \brief Helper function to implement autobroadcasting elementwise binop references.
-///
-/// \tparam T Element type of the input tensors.
-/// \tparam U Element type of the output tensor.
-/// \tparam Functor Type of the functor for the elementwise operation. Must support
-///                 operator()(T,T), and operator()(T,T) must return a value of type
-///                 U.
-///
-/// \param arg0 Pointer to the buffer for left operand input tensor.
-/// \param arg1 Pointer to the buffer for right operand input tensor.
-/// \param out Pointer to the buffer for output tensor. This must be pre-allocated by
-///            the caller, and must be large enough to hold a tensor of the correct
-///            shape.
-/// \param broadcast_spec Specification of the auto-broadcasting scheme.
-/// \param elementwise_functor Functor implementing the elementwise operation to be
-///                            applied across the input tensors. Must accept two
-///                            arguments of type T, and return a value of type U.
 template <typename T, typename U, typename Functor>
-void autobroadcast_binop(const T* arg0,
-                         const T* arg1,
-                         U* out,
-                         const Shape& arg0_shape,
-                         const Shape& arg1_shape,
-                         const op::AutoBroadcastSpec& broadcast_spec,
-                         Functor elementwise_functor) {
+void autobroadcast_binop_serial(const T* arg0,
+                                const T* arg1,
+                                U* out,
+                                const Shape& arg0_shape,
+                                const Shape& arg1_shape,
+                                const op::AutoBroadcastSpec& broadcast_spec,
+                                Functor elementwise_functor) {
     switch (broadcast_spec.m_type) {
     case op::AutoBroadcastType::NONE:
         for (size_t i = 0; i < shape_size(arg0_shape); i++) {
@@ -276,6 +259,110 @@ void autobroadcast_binop(const T* arg0,
     }
 }
 
+// the binary operations with large outputs are split into the independent parts, which are computed in parallel
+constexpr size_t parallel_binop_threshold = 1 << 16;
+
+template <typename T, typename U, typename Functor>
+bool parallel_autobroadcast_binop(const T* arg0,
+                                  const T* arg1,
+                                  U* out,
+                                  const Shape& arg0_shape,
+                                  const Shape& arg1_shape,
+                                  const op::AutoBroadcastSpec& broadcast_spec,
+                                  Functor elementwise_functor) {
+    if (broadcast_spec.m_type != op::AutoBroadcastType::NONE && broadcast_spec.m_type != op::AutoBroadcastType::NUMPY)
+        return false;
+
+    if (arg0_shape == arg1_shape) {
+        const auto out_size = shape_size(arg0_shape);
+        if (out_size < parallel_binop_threshold)
+            return false;
+        parallel_ranges(out_size, parallel_binop_threshold, [&](size_t begin, size_t end) {
+            for (size_t i = begin; i < end; ++i)
+                out[i] = static_cast<U>(elementwise_functor(arg0[i], arg1[i]));
+        });
+        return true;
+    }
+
+    if (broadcast_spec.m_type != op::AutoBroadcastType::NUMPY)
+        return false;
+
+    const size_t rank = std::max(arg0_shape.size(), arg1_shape.size());
+    Shape shape0(rank - arg0_shape.size(), 1), shape1(rank - arg1_shape.size(), 1), out_shape(rank);
+    shape0.insert(shape0.end(), arg0_shape.begin(), arg0_shape.end());
+    shape1.insert(shape1.end(), arg1_shape.begin(), arg1_shape.end());
+    for (size_t i = 0; i < rank; i++)
+        out_shape[i] = std::max(shape0[i], shape1[i]);
+    const auto out_size = shape_size(out_shape);
+    if (out_size < parallel_binop_threshold)
+        return false;
+
+    // The output is split along the outermost non-unit axis, the preceding axes are ones in all the shapes,
+    // so every slice is the broadcasted binary operation on the slices of the inputs
+    size_t axis = 0;
+    while (out_shape[axis] == 1)
+        ++axis;
+    const Shape slice_shape0(shape0.begin() + axis + 1, shape0.end());
+    const Shape slice_shape1(shape1.begin() + axis + 1, shape1.end());
+    const size_t step0 = shape0[axis] == 1 ? 0 : shape_size(slice_shape0);
+    const size_t step1 = shape1[axis] == 1 ? 0 : shape_size(slice_shape1);
+    const size_t out_step = out_size / out_shape[axis];
+    parallel_ranges(out_shape[axis], parallel_binop_threshold / out_step, [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i)
+            autobroadcast_binop_serial(arg0 + i * step0,
+                                       arg1 + i * step1,
+                                       out + i * out_step,
+                                       slice_shape0,
+                                       slice_shape1,
+                                       broadcast_spec,
+                                       elementwise_functor);
+    });
+    return true;
+}
+}  // namespace internal
+
+/// \brief Helper function to implement autobroadcasting elementwise binop references.
+///
+/// \tparam T Element type of the input tensors.
+/// \tparam U Element type of the output tensor.
+/// \tparam Functor Type of the functor for the elementwise operation. Must support
+///                 operator()(T,T), and operator()(T,T) must return a value of type
+///                 U.
+///
+/// \param arg0 Pointer to the buffer for left operand input tensor.
+/// \param arg1 Pointer to the buffer for right operand input tensor.
+/// \param out Pointer to the buffer for output tensor. This must be pre-allocated by
+///            the caller, and must be large enough to hold a tensor of the correct
+///            shape.
+/// \param broadcast_spec Specification of the auto-broadcasting scheme.
+/// \param elementwise_functor Functor implementing the elementwise operation to be
+///                            applied across the input tensors. Must accept two
+///                            arguments of type T, and return a value of type U.
+template <typename T, typename U, typename Functor>
+void autobroadcast_binop(const T* arg0,
+                         const T* arg1,
+                         U* out,
+                         const Shape& arg0_shape,
+                         const Shape& arg1_shape,
+                         const op::AutoBroadcastSpec& broadcast_spec,
+                         Functor elementwise_functor) {
+    if (internal::parallel_autobroadcast_binop(arg0,
+                                               arg1,
+                                               out,
+                                               arg0_shape,
+                                               arg1_shape,
+                                               broadcast_spec,
+                                               elementwise_functor))
+        return;
+    internal::autobroadcast_binop_serial(arg0,
+                                         arg1,
+                                         out,
+                                         arg0_shape,
+                                         arg1_shape,
+                                         broadcast_spec,
+                                         elementwise_functor);
+}
+
 /// \brief Helper function to implement autobroadcasting elementwise ternaryop
 /// references.
 ///
@@ -526,7 +526,9 @@ public:
                           [](const std::pair<dataType, std::pair<int, int>>& p1,
                              const std::pair<dataType, std::pair<int, int>>& p2) {
                               return (p1.first > p2.first) ||
-                                     (p1.first == p2.first && p1.second.second < p2.second.second);
+                                     (p1.first == p2.first && p1.second.second < p2.second.second) ||
+                                     (p1.first == p2.first && p1.second.second == p2.second.second &&
+                                      p1.second.first < p2.second.first);
                           });
                 scoreIndexPairs.resize(attrs.keep_top_k[0]);
                 std::map<int, std::vector<int>> newIndices;
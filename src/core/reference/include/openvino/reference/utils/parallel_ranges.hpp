@@ -0,0 +1,26 @@
+// Copyright (C) 2018-2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstddef>
+#include <functional>
+
+namespace ov {
+namespace reference {
+
+/**
+ * @brief Splits [0, work_amount) into the consecutive ranges and calls the function for each of them.
+ *
+ * The ranges are processed in parallel if the work amount is large enough, so the function must be safe to call
+ * concurrently for the disjoint ranges. The first exception thrown by the function is rethrown in the calling thread.
+ *
+ * @param work_amount Number of the items to process.
+ * @param grain_size  Minimal number of the items in one range, it must amortize the threading overhead.
+ * @param func        Function called with the [begin, end) range.
+ */
+void parallel_ranges(size_t work_amount, size_t grain_size, const std::function<void(size_t, size_t)>& func);
+
+}  // namespace reference
+}  // namespace ov
@@ -0,0 +1,44 @@
+// Copyright (C) 2018-2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "openvino/reference/utils/parallel_ranges.hpp"
+
+#include <exception>
+#include <mutex>
+
+#include "openvino/core/parallel.hpp"
+
+namespace ov {
+namespace reference {
+
+void parallel_ranges(size_t work_amount, size_t grain_size, const std::function<void(size_t, size_t)>& func) {
+    const size_t max_ranges = grain_size > 1 ? work_amount / grain_size : work_amount;
+    const auto max_threads = static_cast<size_t>(parallel_get_max_threads());
+    const int nthr = static_cast<int>(max_ranges < max_threads ? max_ranges : max_threads);
+    if (nthr <= 1) {
+        func(0, work_amount);
+        return;
+    }
+
+    std::mutex exception_mutex;
+    std::exception_ptr exception;
+    ov::parallel_nt(nthr, [&](const int ithr, const int team) {
+        size_t begin = 0, end = 0;
+        ov::splitter(work_amount, team, ithr, begin, end);
+        if (begin >= end)
+            return;
+        try {
+            func(begin, end);
+        } catch (...) {
+            std::lock_guard<std::mutex> lock(exception_mutex);
+            if (!exception)
+                exception = std::current_exception();
+        }
+    });
+    if (exception)
+        std::rethrow_exception(exception);
+}
+
+}  // namespace reference
+}  // namespace ov
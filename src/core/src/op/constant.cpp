@@ -8,6 +8,7 @@
 #include <cstdio>
 #include <cstring>
 #include <sstream>
+#include <typeinfo>
 
 #include "compare.hpp"
 #include "element_visitor.hpp"
@@ -15,6 +16,7 @@
 #include "openvino/core/type/float16.hpp"
 #include "openvino/core/type/nf4.hpp"
 #include "openvino/reference/utils/type_util.hpp"
+#include "openvino/runtime/lazy_buffer.hpp"
 #include "openvino/runtime/shared_buffer.hpp"
 #include "openvino/runtime/string_aligned_buffer.hpp"
 #include "openvino/runtime/tensor.hpp"
@@ -65,6 +67,13 @@ std::vector<T> from_string_vector(const std::vector<std::string>& str_values) {
     });
     return values;
 }
+
+// The lazy buffers have no memory until the data is accessed for the first time
+void* get_buffer_ptr(AlignedBuffer& buffer) {
+    if (typeid(buffer) == typeid(LazyBuffer))
+        return static_cast<LazyBuffer&>(buffer).materialize();
+    return buffer.get_ptr();
+}
 }  // namespace
 
 namespace v0 {
@@ -221,11 +230,11 @@ size_t Constant::get_byte_size() const {
 }
 
 const void* Constant::get_data_ptr() const {
-    return (m_data ? m_data->get_ptr() : nullptr);
+    return (m_data ? get_buffer_ptr(*m_data) : nullptr);
 }
 
 void* Constant::get_data_ptr_nc() {
-    return (m_data ? m_data->get_ptr() : nullptr);
+    return (m_data ? get_buffer_ptr(*m_data) : nullptr);
 }
 
 struct ValuesToString : ov::element::NotSupported<void> {
@@ -392,6 +401,9 @@ bool Constant::visit_attributes(AttributeVisitor& visitor) {
             m_data = string_aligned_buffer;
         }
     } else {
+        // the visitors access the buffer directly
+        if (m_data)
+            get_buffer_ptr(*m_data);
         visitor.on_attribute("value", m_data);
     }
     update_identical_flags(false, false);
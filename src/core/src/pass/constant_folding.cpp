@@ -4,15 +4,24 @@
 
 #include "openvino/pass/constant_folding.hpp"
 
+#include <exception>
+#include <mutex>
+#include <unordered_map>
+
 #include "openvino/cc/pass/itt.hpp"
 #include "openvino/core/constant_fold_utils.hpp"
+#include "openvino/core/parallel.hpp"
 #include "openvino/core/rt_info.hpp"
 #include "openvino/op/constant.hpp"
 #include "openvino/op/convert.hpp"
+#include "openvino/op/multiply.hpp"
+#include "openvino/op/parameter.hpp"
+#include "openvino/op/subtract.hpp"
 #include "openvino/op/util/op_types.hpp"
 #include "openvino/op/util/read_value_base.hpp"
 #include "openvino/op/util/shape_of_base.hpp"
 #include "openvino/op/util/sub_graph_base.hpp"
+#include "openvino/runtime/lazy_buffer.hpp"
 
 /**
  * \brief Check if \ref ov::Output<ov::Node> can be folded base on `can_be_folded` attribute.
@@ -99,65 +108,315 @@ static void remove_requires_precision_conversion_attribute(const std::shared_ptr
     }
 }
 
+/**
+ * \brief Split the nodes into the topological levels.
+ *
+ * The level of the node is the longest path from the nodes without inputs, so the nodes of the same level don't depend
+ * on each other.
+ *
+ * \param ordered_ops  Nodes in the topological order.
+ *
+ * \return Vector of the levels, the nodes of each level keep the topological order.
+ */
+static std::vector<ov::NodeVector> split_by_topological_levels(const ov::NodeVector& ordered_ops) {
+    std::unordered_map<const ov::Node*, size_t> node_levels;
+    std::vector<ov::NodeVector> levels;
+    for (const auto& node : ordered_ops) {
+        size_t level = 0;
+        for (const auto& input : node->inputs()) {
+            const auto it = node_levels.find(input.get_source_output().get_node());
+            if (it != node_levels.end())
+                level = std::max(level, it->second + 1);
+        }
+        node_levels[node.get()] = level;
+        if (levels.size() <= level)
+            levels.resize(level + 1);
+        levels[level].push_back(node);
+    }
+    return levels;
+}
+
+/**
+ * \brief Weights decompression chain: Convert of the u8/i8 weights, followed by Subtract and Multiply by Constants.
+ *
+ * The chain is evaluated right into the memory of the folded Constant: the weights are converted there and the
+ * element-wise operations are applied in place, so the intermediate results are never allocated.
+ */
+class DecompressionChain {
+public:
+    DecompressionChain(std::shared_ptr<ov::op::v0::Constant> weights, std::shared_ptr<ov::Node> convert)
+        : m_weights(std::move(weights)),
+          m_convert(std::move(convert)) {}
+
+    /**
+     * \brief Create the chain with the operation appended.
+     *
+     * \param node       Copy of the operation, which isn't connected to the graph.
+     * \param constant   The other input of the operation.
+     * \param data_port  Input port of the chain data.
+     */
+    std::shared_ptr<DecompressionChain> append(std::shared_ptr<ov::Node> node,
+                                               std::shared_ptr<ov::op::v0::Constant> constant,
+                                               size_t data_port) const {
+        auto chain = std::make_shared<DecompressionChain>(*this);
+        chain->m_operations.push_back({std::move(node), std::move(constant), data_port});
+        return chain;
+    }
+
+    void evaluate(void* data) const {
+        const auto& shape = m_weights->get_shape();
+        ov::TensorVector outputs{ov::Tensor(m_convert->get_output_element_type(0), shape, data)};
+        ov::TensorVector inputs{
+            ov::Tensor(m_weights->get_element_type(), shape, const_cast<void*>(m_weights->get_data_ptr()))};
+        OPENVINO_ASSERT(m_convert->evaluate(outputs, inputs), "Failed to evaluate lazily folded ", m_convert);
+        for (const auto& operation : m_operations) {
+            const auto& constant = operation.constant;
+            inputs.resize(2);
+            inputs[operation.data_port] = outputs[0];
+            inputs[1 - operation.data_port] = ov::Tensor(constant->get_element_type(),
+                                                         constant->get_shape(),
+                                                         const_cast<void*>(constant->get_data_ptr()));
+            OPENVINO_ASSERT(operation.node->evaluate(outputs, inputs),
+                            "Failed to evaluate lazily folded ",
+                            operation.node);
+        }
+    }
+
+private:
+    struct Operation {
+        std::shared_ptr<ov::Node> node;
+        std::shared_ptr<ov::op::v0::Constant> constant;
+        size_t data_port;
+    };
+
+    std::shared_ptr<ov::op::v0::Constant> m_weights;
+    std::shared_ptr<ov::Node> m_convert;
+    std::vector<Operation> m_operations;
+};
+
+/**
+ * \brief Lazily folded Constants of the model with their decompression chains.
+ */
+struct LazyConstant {
+    std::weak_ptr<ov::Node> constant;
+    std::shared_ptr<DecompressionChain> chain;
+};
+using LazyConstants = std::unordered_map<const ov::Node*, LazyConstant>;
+
+/**
+ * \brief Fold the node of the large weights decompression chain without evaluating it.
+ *
+ * The Convert of the u8/i8 weights Constant to f32 starts the chain, the f32 Subtract and Multiply of the chain data
+ * by a Constant extend it, as long as the data isn't broadcast. The replacement is a Constant with the lazy buffer,
+ * which evaluates the whole chain on the first access to the data and then releases the source Constants, so the
+ * full f32 copy of the weights isn't allocated during the folding, and never if the data isn't accessed.
+ *
+ * \param node            Node to fold.
+ * \param replacements    Replacements of the node outputs, filled if the node is folded.
+ * \param lazy_constants  Lazily folded Constants of the model.
+ *
+ * \return Chain of the replacement if the node is folded, nullptr otherwise.
+ */
+static std::shared_ptr<DecompressionChain> constant_fold_lazily(const std::shared_ptr<ov::Node>& node,
+                                                                ov::OutputVector& replacements,
+                                                                const LazyConstants& lazy_constants) {
+    constexpr size_t min_lazy_byte_size = 1 << 20;
+    if (ov::pass::constant_folding_is_disabled(node) || node->get_output_partial_shape(0).is_dynamic() ||
+        node->get_output_element_type(0) != ov::element::f32)
+        return nullptr;
+    const auto& shape = node->get_output_shape(0);
+    const auto byte_size = ov::shape_size(shape) * ov::element::f32.size();
+    if (byte_size < min_lazy_byte_size)
+        return nullptr;
+
+    const auto find_chain = [&](const ov::Output<ov::Node>& output) -> std::shared_ptr<DecompressionChain> {
+        const auto it = lazy_constants.find(output.get_node());
+        if (it == lazy_constants.end() || it->second.constant.lock() != output.get_node_shared_ptr())
+            return nullptr;
+        return it->second.chain;
+    };
+
+    std::shared_ptr<DecompressionChain> chain;
+    if (ov::is_type<ov::op::v0::Convert>(node)) {
+        auto weights = ov::as_type_ptr<ov::op::v0::Constant>(node->get_input_node_shared_ptr(0));
+        if (!weights ||
+            (weights->get_element_type() != ov::element::u8 && weights->get_element_type() != ov::element::i8))
+            return nullptr;
+        auto parameter = std::make_shared<ov::op::v0::Parameter>(weights->get_element_type(), shape);
+        chain = std::make_shared<DecompressionChain>(weights, node->clone_with_new_inputs({parameter}));
+    } else if (ov::is_type<ov::op::v1::Subtract>(node) || ov::is_type<ov::op::v1::Multiply>(node)) {
+        for (size_t data_port = 0; data_port < 2 && !chain; ++data_port) {
+            const auto& data = node->input_value(data_port);
+            const auto& other = node->input_value(1 - data_port);
+            const auto data_chain = find_chain(data);
+            auto constant = ov::as_type_ptr<ov::op::v0::Constant>(other.get_node_shared_ptr());
+            if (!data_chain || !constant || find_chain(other) || data.get_shape() != shape ||
+                constant->get_element_type() != ov::element::f32)
+                continue;
+            ov::OutputVector parameters(2);
+            parameters[data_port] = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, shape);
+            parameters[1 - data_port] =
+                std::make_shared<ov::op::v0::Parameter>(ov::element::f32, constant->get_shape());
+            chain = data_chain->append(node->clone_with_new_inputs(parameters), std::move(constant), data_port);
+        }
+    }
+    if (!chain)
+        return nullptr;
+
+    auto buffer = std::make_shared<ov::LazyBuffer>(byte_size, [chain](void* data, size_t) {
+        chain->evaluate(data);
+    });
+    replacements[0] = std::make_shared<ov::op::v0::Constant>(ov::element::f32, shape, buffer);
+    return chain;
+}
+
+/**
+ * \brief Try to constant fold the nodes, which don't depend on each other.
+ *
+ * The nodes are folded in parallel if at least two of them have only Constant inputs. The graph is not modified,
+ * only the replacements are created.
+ *
+ * \param nodes           Nodes to fold.
+ * \param replacements    Replacements of the node outputs, filled for the folded nodes.
+ * \param lazy_constants  Lazily folded Constants of the model, updated with the new ones.
+ *
+ * \return Vector of the flags, which are set for the folded nodes.
+ */
+static std::vector<char> constant_fold_independent(const ov::NodeVector& nodes,
+                                                   std::vector<ov::OutputVector>& replacements,
+                                                   LazyConstants& lazy_constants) {
+    std::vector<char> folded(nodes.size(), false);
+    std::vector<std::shared_ptr<DecompressionChain>> chains(nodes.size());
+    replacements.resize(nodes.size());
+    const auto fold = [&](size_t idx) {
+        replacements[idx].resize(nodes[idx]->get_output_size());
+        chains[idx] = constant_fold_lazily(nodes[idx], replacements[idx], lazy_constants);
+        folded[idx] = chains[idx] || nodes[idx]->constant_fold(replacements[idx], nodes[idx]->input_values());
+    };
+
+    // the sub-graph operations evaluate their bodies, so they are folded sequentially
+    const auto is_parallel_foldable = [](const std::shared_ptr<ov::Node>& node) {
+        const auto& inputs = node->input_values();
+        return !ov::is_type<ov::op::util::MultiSubGraphOp>(node) && !inputs.empty() &&
+               std::all_of(inputs.begin(), inputs.end(), [](const ov::Output<ov::Node>& input) {
+                   return ov::is_type<ov::op::v0::Constant>(input.get_node());
+               });
+    };
+    std::vector<size_t> parallel_nodes;
+    for (size_t idx = 0; idx < nodes.size(); ++idx) {
+        if (is_parallel_foldable(nodes[idx]))
+            parallel_nodes.push_back(idx);
+    }
+    if (parallel_nodes.size() < 2)
+        parallel_nodes.clear();
+
+    if (!parallel_nodes.empty()) {
+        std::mutex exception_mutex;
+        std::exception_ptr exception;
+        ov::parallel_for(parallel_nodes.size(), [&](size_t i) {
+            try {
+                fold(parallel_nodes[i]);
+            } catch (...) {
+                std::lock_guard<std::mutex> lock(exception_mutex);
+                if (!exception)
+                    exception = std::current_exception();
+            }
+        });
+        if (exception)
+            std::rethrow_exception(exception);
+    }
+
+    for (size_t idx = 0, i = 0; idx < nodes.size(); ++idx) {
+        if (i < parallel_nodes.size() && parallel_nodes[i] == idx)
+            ++i;
+        else
+            fold(idx);
+    }
+
+    for (size_t idx = 0; idx < nodes.size(); ++idx) {
+        if (chains[idx]) {
+            const auto& constant = replacements[idx][0].get_node_shared_ptr();
+            lazy_constants[constant.get()] = {constant, std::move(chains[idx])};
+        }
+    }
+    return folded;
+}
+
 bool ov::pass::ConstantFolding::run_on_model(const std::shared_ptr<ov::Model>& model) {
     RUN_ON_MODEL_SCOPE(ConstantFolding);
 
     bool rewritten = pre_calculated_values_folding(model);
 
-    for (const auto& original_node : model->get_ordered_ops()) {
-        auto node = original_node;
-        if (node_has_requires_precision_conversion_attribute(node)) {
-            remove_requires_precision_conversion_attribute(node);
-            node = util::convert_to_supported_precision(node.get());
-        } else {
-            rewritten = restore_original_input_precision(node) || rewritten;
-        }
+    // The nodes of the same topological level are independent, so they are evaluated together (in parallel).
+    // The graph is modified sequentially: the input precisions are prepared before the evaluation of the level
+    // and the outputs are replaced after it.
+    LazyConstants lazy_constants;
+    for (const auto& level : split_by_topological_levels(model->get_ordered_ops())) {
+        NodeVector nodes;
+        nodes.reserve(level.size());
+        for (const auto& original_node : level) {
+            auto node = original_node;
+            if (node_has_requires_precision_conversion_attribute(node)) {
+                remove_requires_precision_conversion_attribute(node);
+                node = util::convert_to_supported_precision(node.get());
+            } else {
+                rewritten = restore_original_input_precision(node) || rewritten;
+            }
 
-        if (rewritten) {
-            node->validate_and_infer_types();
+            if (rewritten) {
+                node->validate_and_infer_types();
+            }
+            nodes.push_back(node);
         }
 
-        OutputVector replacements(node->get_output_size());
-        if (node->constant_fold(replacements, node->input_values())) {
-            OPENVINO_ASSERT(!constant_folding_is_disabled(original_node),
-                            "Node folded but constant folding disabled. Check constant_fold implementation for ",
-                            node);
-            OPENVINO_ASSERT(replacements.size() == node->get_output_size(),
-                            "constant_fold_default returned incorrect number of replacements for ",
-                            node);
-
-            for (size_t i = 0; i < replacements.size(); ++i) {
-                auto node_output = original_node->output(i);
-                auto replacement = replacements.at(i);
-                auto replacement_ptr = replacement.get_node_shared_ptr();
-                if (replacement_ptr && (node_output != replacement)) {
-                    replacement_ptr->set_friendly_name(friendly_name_from(*original_node, replacements.size(), i));
-
-                    node_output.replace(replacement);
-                    // Copy runtime info from source nodes
-                    // when it was not propogated during pre-calculation
-                    copy_runtime_info_from_input_values(original_node);
-                    // Propagate runtime info attributes to replacement
-                    copy_runtime_info(original_node, replacement_ptr);
-
-                    rewritten = true;
+        std::vector<OutputVector> level_replacements;
+        const auto folded = constant_fold_independent(nodes, level_replacements, lazy_constants);
+
+        for (size_t node_idx = 0; node_idx < level.size(); ++node_idx) {
+            const auto& original_node = level[node_idx];
+            const auto& node = nodes[node_idx];
+            const auto& replacements = level_replacements[node_idx];
+            if (folded[node_idx]) {
+                OPENVINO_ASSERT(!constant_folding_is_disabled(original_node),
+                                "Node folded but constant folding disabled. Check constant_fold implementation for ",
+                                node);
+                OPENVINO_ASSERT(replacements.size() == node->get_output_size(),
+                                "constant_fold_default returned incorrect number of replacements for ",
+                                node);
+
+                for (size_t i = 0; i < replacements.size(); ++i) {
+                    auto node_output = original_node->output(i);
+                    auto replacement = replacements.at(i);
+                    auto replacement_ptr = replacement.get_node_shared_ptr();
+                    if (replacement_ptr && (node_output != replacement)) {
+                        replacement_ptr->set_friendly_name(friendly_name_from(*original_node, replacements.size(), i));
+
+                        node_output.replace(replacement);
+                        // Copy runtime info from source nodes
+                        // when it was not propogated during pre-calculation
+                        copy_runtime_info_from_input_values(original_node);
+                        // Propagate runtime info attributes to replacement
+                        copy_runtime_info(original_node, replacement_ptr);
+
+                        rewritten = true;
+                    }
                 }
-            }
-        } else {
-            if (auto sub_graph_node = std::dynamic_pointer_cast<ov::op::util::MultiSubGraphOp>(node)) {
-                // recursively constant fold operators containing subgraphs (ie: TensorIterator, Loop)
-                size_t sub_graphs_num = sub_graph_node->get_internal_subgraphs_size();
-                for (size_t sub_graph_ind = 0; sub_graph_ind < sub_graphs_num; ++sub_graph_ind) {
-                    rewritten =
-                        run_on_model(sub_graph_node->get_function(static_cast<int>(sub_graph_ind))) || rewritten;
+            } else {
+                if (auto sub_graph_node = std::dynamic_pointer_cast<ov::op::util::MultiSubGraphOp>(node)) {
+                    // recursively constant fold operators containing subgraphs (ie: TensorIterator, Loop)
+                    size_t sub_graphs_num = sub_graph_node->get_internal_subgraphs_size();
+                    for (size_t sub_graph_ind = 0; sub_graph_ind < sub_graphs_num; ++sub_graph_ind) {
+                        rewritten =
+                            run_on_model(sub_graph_node->get_function(static_cast<int>(sub_graph_ind))) || rewritten;
+                    }
                 }
-            }
 
-            // if CF was unsuccessful remove original precision attribute from inputs
-            bool restored = restore_original_input_precision(original_node);
-            if (restored) {
-                original_node->validate_and_infer_types();
-                rewritten = true;
+                // if CF was unsuccessful remove original precision attribute from inputs
+                bool restored = restore_original_input_precision(original_node);
+                if (restored) {
+                    original_node->validate_and_infer_types();
+                    rewritten = true;
+                }
             }
         }
     }
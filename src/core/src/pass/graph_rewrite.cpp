@@ -14,6 +14,7 @@
 
 #include "openvino/cc/pass/itt.hpp"
 #include "openvino/op/util/multi_subgraph_base.hpp"
+#include "openvino/pass/pass_profile.hpp"
 #include "openvino/pass/pattern/op/wrap_type.hpp"
 #include "openvino/util/log.hpp"
 #include "perf_counters.hpp"
@@ -134,6 +135,11 @@ bool ov::pass::GraphRewrite::apply_matcher_passes(std::shared_ptr<Model> f,
         // including ones triggered by parent type info.
     }
 
+    // the statistics are accumulated locally and reported to the thread counters once
+    size_t visited_nodes = 0;
+    size_t matcher_invocations = 0;
+    size_t applied_rewrites = 0;
+
     // This lambda preforms execution of particular MatcherPass on given node.
     // It automatically handles nodes registered by MatcherPass during transformation and set
     // transformation callback.
@@ -150,6 +156,7 @@ bool ov::pass::GraphRewrite::apply_matcher_passes(std::shared_ptr<Model> f,
 
         // Apply MatcherPass. In case if it returns true no other MatcherPasses will apply
         // to this node
+        ++matcher_invocations;
         bool status = m_pass->apply(node);
 
         // In case if MatcherPass registered nodes they will be added to the beginning of execution
@@ -176,6 +183,7 @@ bool ov::pass::GraphRewrite::apply_matcher_passes(std::shared_ptr<Model> f,
         auto node = weak_node.lock();
         if (!node)
             continue;
+        ++visited_nodes;
 
         // Recursive apply Matchers for sub-graph based nodes
         if (auto sub_graph_node = std::dynamic_pointer_cast<ov::op::util::MultiSubGraphOp>(node)) {
@@ -217,6 +225,7 @@ bool ov::pass::GraphRewrite::apply_matcher_passes(std::shared_ptr<Model> f,
             for (size_t matcher_index : matcher_passes_to_run) {
                 if (run_matcher_pass(m_matchers[matcher_index], node)) {
                     rewritten = true;
+                    ++applied_rewrites;
                     break;
                 }
             }
@@ -230,11 +239,16 @@ bool ov::pass::GraphRewrite::apply_matcher_passes(std::shared_ptr<Model> f,
 
                 if (run_matcher_pass(m_pass, node)) {
                     rewritten = true;
+                    ++applied_rewrites;
                     break;
                 }
             }
         }
     }
+    auto& counters = RewriteCounters::get_thread_local();
+    counters.visited_nodes += visited_nodes;
+    counters.matcher_invocations += matcher_invocations;
+    counters.applied_rewrites += applied_rewrites;
     return rewritten;
 }
 
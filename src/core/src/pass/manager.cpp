@@ -5,14 +5,22 @@
 #include "openvino/pass/manager.hpp"
 
 #include <algorithm>
+#include <atomic>
+#include <deque>
 #include <iomanip>
 #include <iostream>
 #include <memory>
 #include <mutex>
+#include <numeric>
 #include <unordered_map>
 
 #include "itt.hpp"
+#include "openvino/core/graph_util.hpp"
+#include "openvino/core/parallel.hpp"
+#include "openvino/op/util/op_types.hpp"
+#include "openvino/op/util/variable_extension.hpp"
 #include "openvino/pass/graph_rewrite.hpp"
+#include "openvino/pass/pass_profile.hpp"
 #include "openvino/pass/visualize_tree.hpp"
 #include "openvino/util/env_util.hpp"
 #include "openvino/util/log.hpp"
@@ -89,6 +97,111 @@ private:
     bool m_active = false;
     std::chrono::nanoseconds m_last_time = std::chrono::high_resolution_clock::duration::zero();
 };
+
+// Provides GraphRewrite execution over the part of the model nodes
+class SubgraphRewrite : public ov::pass::GraphRewrite {
+public:
+    explicit SubgraphRewrite(const std::shared_ptr<ov::pass::MatcherPass>& pass) : GraphRewrite(pass) {}
+
+    bool run_on_nodes(const std::shared_ptr<ov::Model>& model, std::deque<std::weak_ptr<ov::Node>> nodes) {
+        return apply_matcher_passes(model, std::move(nodes));
+    }
+};
+
+// Splits the model into the weakly connected components. Each component is represented by its results, sinks and
+// parameters, the nodes of the component are collected from them, so the split stays valid while the passes change
+// the nodes inside the components. The stateful operations sharing a variable are kept in the same component.
+std::vector<ov::NodeVector> split_into_disjoint_subgraphs(const std::shared_ptr<ov::Model>& model) {
+    const auto ordered_ops = model->get_ordered_ops();
+    std::unordered_map<const ov::Node*, size_t> node_index;
+    node_index.reserve(ordered_ops.size());
+    for (size_t i = 0; i < ordered_ops.size(); ++i) {
+        node_index.emplace(ordered_ops[i].get(), i);
+    }
+
+    std::vector<size_t> parent(ordered_ops.size());
+    std::iota(parent.begin(), parent.end(), 0);
+    auto find_root = [&](size_t i) {
+        while (parent[i] != i) {
+            parent[i] = parent[parent[i]];
+            i = parent[i];
+        }
+        return i;
+    };
+    auto unite = [&](size_t a, size_t b) {
+        a = find_root(a);
+        b = find_root(b);
+        if (a != b)
+            parent[std::max(a, b)] = std::min(a, b);
+    };
+
+    std::unordered_map<const void*, size_t> variable_users;
+    for (size_t i = 0; i < ordered_ops.size(); ++i) {
+        for (const auto& input : ordered_ops[i]->input_values()) {
+            unite(i, node_index.at(input.get_node()));
+        }
+        if (auto variable_op = std::dynamic_pointer_cast<ov::op::util::VariableExtension>(ordered_ops[i])) {
+            auto it = variable_users.emplace(variable_op->get_variable().get(), i).first;
+            unite(i, it->second);
+        }
+    }
+
+    std::vector<ov::NodeVector> subgraphs;
+    std::unordered_map<size_t, size_t> root_to_subgraph;
+    for (size_t i = 0; i < ordered_ops.size(); ++i) {
+        const auto& op = ordered_ops[i];
+        if (!ov::op::util::is_output(op) && !ov::op::util::is_sink(op) && !ov::op::util::is_parameter(op))
+            continue;
+        auto it = root_to_subgraph.emplace(find_root(i), subgraphs.size()).first;
+        if (it->second == subgraphs.size())
+            subgraphs.emplace_back();
+        subgraphs[it->second].push_back(op);
+    }
+    return subgraphs;
+}
+
+// Applies the instances of the matcher pass to the disjoint subgraphs of the model in parallel
+bool run_on_disjoint_subgraphs(const std::shared_ptr<ov::Model>& model,
+                               const std::vector<ov::NodeVector>& subgraphs,
+                               const std::function<std::shared_ptr<ov::pass::MatcherPass>()>& factory,
+                               const std::shared_ptr<ov::pass::PassConfig>& pass_config) {
+    std::atomic<bool> applied{false};
+    std::atomic<size_t> visited_nodes{0};
+    std::atomic<size_t> matcher_invocations{0};
+    std::atomic<size_t> applied_rewrites{0};
+    std::exception_ptr exception;
+    std::mutex exception_mutex;
+    ov::parallel_for(subgraphs.size(), [&](size_t i) {
+        // the counters of the worker thread are restored, the totals are reported to the calling thread
+        auto& counters = ov::pass::RewriteCounters::get_thread_local();
+        const auto initial_counters = counters;
+        try {
+            // the nodes are collected for each pass, as the previous passes may replace them
+            const auto ordered_ops = ov::topological_sort(subgraphs[i]);
+            std::deque<std::weak_ptr<ov::Node>> nodes(ordered_ops.begin(), ordered_ops.end());
+            auto pass = factory();
+            pass->set_pass_config(pass_config);
+            if (SubgraphRewrite(pass).run_on_nodes(model, std::move(nodes)))
+                applied = true;
+        } catch (...) {
+            std::lock_guard<std::mutex> lock(exception_mutex);
+            if (!exception)
+                exception = std::current_exception();
+        }
+        visited_nodes += counters.visited_nodes - initial_counters.visited_nodes;
+        matcher_invocations += counters.matcher_invocations - initial_counters.matcher_invocations;
+        applied_rewrites += counters.applied_rewrites - initial_counters.applied_rewrites;
+        counters = initial_counters;
+    });
+    if (exception)
+        std::rethrow_exception(exception);
+
+    auto& counters = ov::pass::RewriteCounters::get_thread_local();
+    counters.visited_nodes += visited_nodes;
+    counters.matcher_invocations += matcher_invocations;
+    counters.applied_rewrites += applied_rewrites;
+    return applied;
+}
 }  // namespace
 
 bool ov::pass::Manager::run_passes(shared_ptr<ov::Model> func) {
@@ -103,6 +216,10 @@ bool ov::pass::Manager::run_passes(shared_ptr<ov::Model> func) {
     bool pass_applied = false;
     bool function_changed = false;
     bool needs_validate = false;
+    // the model is split once for the consecutive passes applied to the disjoint subgraphs, any other pass may
+    // connect the subgraphs
+    std::vector<NodeVector> subgraphs;
+    bool subgraphs_valid = false;
     for (auto& pass : m_pass_list) {
         if (m_pass_config->is_disabled(pass->get_type_info())) {
             OPENVINO_DEBUG << "Pass " << pass->get_name() << " is disabled";
@@ -112,6 +229,8 @@ bool ov::pass::Manager::run_passes(shared_ptr<ov::Model> func) {
         OV_ITT_SCOPE(FIRST_INFERENCE, ov::itt::domains::ov_pass, ov::pass::perf_counters()[pass->get_type_info()]);
 
         pass_timer.start();
+        auto profile_scope = PassProfileScope::get_active();
+        const auto profile_index = profile_scope ? profile_scope->start_pass(pass->get_name()) : 0;
 
         if (auto matcher_pass = dynamic_pointer_cast<MatcherPass>(pass)) {
             // This checks is to skip the graph transformation when the graph pass relies on
@@ -119,17 +238,32 @@ bool ov::pass::Manager::run_passes(shared_ptr<ov::Model> func) {
             if (matcher_pass->get_property(PassProperty::REQUIRE_STATIC_SHAPE) && func->is_dynamic()) {
                 OPENVINO_DEBUG << "Pass " << pass->get_name() << " requires static shape but the "
                                << "model is dynamic. Skipping this transformation";
+                if (profile_scope)
+                    profile_scope->finish_pass(profile_index, std::chrono::nanoseconds::zero(), false);
                 continue;
             }
-            // GraphRewrite is a temporary container for MatcherPass to make execution
-            // on on entire ov::Model
-            pass_applied = GraphRewrite(matcher_pass).run_on_model(func);
+            const auto factory = m_parallel_matcher_passes ? m_matcher_pass_factories.find(pass.get())
+                                                           : m_matcher_pass_factories.end();
+            if (factory != m_matcher_pass_factories.end() && !subgraphs_valid) {
+                subgraphs = split_into_disjoint_subgraphs(func);
+                subgraphs_valid = true;
+            }
+            if (factory != m_matcher_pass_factories.end() && subgraphs.size() > 1) {
+                pass_applied = run_on_disjoint_subgraphs(func, subgraphs, factory->second, m_pass_config);
+            } else {
+                // GraphRewrite is a temporary container for MatcherPass to make execution
+                // on on entire ov::Model
+                pass_applied = GraphRewrite(matcher_pass).run_on_model(func);
+                subgraphs_valid = subgraphs_valid && factory != m_matcher_pass_factories.end();
+            }
         } else if (auto function_pass = dynamic_pointer_cast<ModelPass>(pass)) {
             // This checks is to skip the graph transformation when the graph pass relies on
             // static shape but the function state is dynamic.
             if (function_pass->get_property(PassProperty::REQUIRE_STATIC_SHAPE) && func->is_dynamic()) {
                 OPENVINO_DEBUG << "Pass " << pass->get_name() << " requires static shape but the "
                                << "model is dynamic. Skipping this transformation";
+                if (profile_scope)
+                    profile_scope->finish_pass(profile_index, std::chrono::nanoseconds::zero(), false);
                 continue;
             }
 
@@ -140,6 +274,7 @@ bool ov::pass::Manager::run_passes(shared_ptr<ov::Model> func) {
                 }
             } else {
                 pass_applied = function_pass->run_on_model(func);
+                subgraphs_valid = false;
             }
         }
 
@@ -158,6 +293,9 @@ bool ov::pass::Manager::run_passes(shared_ptr<ov::Model> func) {
         }
         index++;
         pass_timer.stop();
+        if (profile_scope) {
+            profile_scope->finish_pass(profile_index, pass_timer.get_timer_value(), pass_applied);
+        }
         if (profile_enabled) {
             cout << setw(7) << pass_timer.get_milliseconds() << "ms" << (pass_applied ? " + " : "   ")
                  << pass->get_name() << "\n";
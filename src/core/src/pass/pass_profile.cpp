@@ -0,0 +1,55 @@
+// Copyright (C) 2018-2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "openvino/pass/pass_profile.hpp"
+
+namespace ov {
+namespace pass {
+namespace {
+thread_local PassProfileScope* active_scope = nullptr;
+}  // namespace
+
+PassProfileScope::PassProfileScope() : m_parent(active_scope) {
+    active_scope = this;
+}
+
+PassProfileScope::~PassProfileScope() {
+    active_scope = m_parent;
+}
+
+PassProfileScope* PassProfileScope::get_active() {
+    return active_scope;
+}
+
+size_t PassProfileScope::start_pass(const std::string& name) {
+    const auto& counters = RewriteCounters::get_thread_local();
+    PassProfile profile;
+    profile.name = name;
+    profile.depth = m_depth++;
+    // keep the counters values at the pass start, they are replaced by the difference when the pass is finished
+    profile.visited_nodes = counters.visited_nodes;
+    profile.matcher_invocations = counters.matcher_invocations;
+    profile.applied_rewrites = counters.applied_rewrites;
+    m_profile.push_back(std::move(profile));
+    return m_profile.size() - 1;
+}
+
+void PassProfileScope::finish_pass(size_t index, std::chrono::nanoseconds time, bool applied) {
+    const auto& counters = RewriteCounters::get_thread_local();
+    auto& profile = m_profile.at(index);
+    profile.time = time;
+    profile.applied = applied;
+    profile.visited_nodes = counters.visited_nodes - profile.visited_nodes;
+    profile.matcher_invocations = counters.matcher_invocations - profile.matcher_invocations;
+    profile.applied_rewrites = counters.applied_rewrites - profile.applied_rewrites;
+    --m_depth;
+}
+
+RewriteCounters& RewriteCounters::get_thread_local() {
+    static thread_local RewriteCounters counters;
+    return counters;
+}
+
+}  // namespace pass
+}  // namespace ov
@@ -8,6 +8,7 @@
 #include <cassert>
 #include <cstdint>
 #include <fstream>
+#include <mutex>
 #include <openvino/cc/pass/itt.hpp>
 #include <unordered_map>
 #include <unordered_set>
@@ -16,14 +17,17 @@
 #include "openvino/core/except.hpp"
 #include "openvino/core/meta_data.hpp"
 #include "openvino/core/model.hpp"
+#include "openvino/core/parallel.hpp"
 #include "openvino/core/type/float16.hpp"
 #include "openvino/op/util/framework_node.hpp"
 #include "openvino/opsets/opset1.hpp"
 #include "openvino/pass/constant_folding.hpp"
 #include "openvino/reference/convert.hpp"
 #include "openvino/runtime/aligned_buffer.hpp"
+#include "openvino/runtime/shared_buffer.hpp"
 #include "openvino/runtime/string_aligned_buffer.hpp"
 #include "openvino/util/file_util.hpp"
+#include "openvino/util/mmap_object.hpp"
 #include "pugixml.hpp"
 #include "transformations/hash.hpp"
 #include "transformations/rt_info/disable_fp16_compression.hpp"
@@ -96,11 +100,21 @@ public:
           m_enable_compression(enable_compression),
           m_blob_offset(bin_data.tellp()) {}
 
-    FilePosition write(const char* ptr,
-                       size_t size,
-                       size_t* new_size,
-                       bool compress_to_fp16 = false,
-                       ov::element::Type src_type = ov::element::dynamic) {
+    virtual ~ConstantWriter() = default;
+
+    // writes the data of the Constant, the buffer owning the data is known
+    virtual FilePosition write(const std::shared_ptr<ov::AlignedBuffer>& buffer,
+                               size_t* new_size,
+                               bool compress_to_fp16 = false,
+                               ov::element::Type src_type = ov::element::dynamic) {
+        return write(static_cast<const char*>(buffer->get_ptr()), buffer->size(), new_size, compress_to_fp16, src_type);
+    }
+
+    virtual FilePosition write(const char* ptr,
+                               size_t size,
+                               size_t* new_size,
+                               bool compress_to_fp16 = false,
+                               ov::element::Type src_type = ov::element::dynamic) {
         const FilePosition write_pos = m_binary_output.tellp();
         const auto offset = write_pos - m_blob_offset;
         *new_size = size;
@@ -563,13 +577,9 @@ public:
             }
         } else if (const auto& a = ov::as_type<ov::AttributeAdapter<std::shared_ptr<ov::AlignedBuffer>>>(&adapter)) {
             if (name == "value" && translate_type_name(m_node_type_name) == "Const") {
-                const int64_t size = a->get()->size();
                 size_t new_size;
-                int64_t offset = m_constant_write_handler.write(static_cast<const char*>(a->get()->get_ptr()),
-                                                                size,
-                                                                &new_size,
-                                                                m_compress_to_fp16,
-                                                                m_output_element_type);
+                int64_t offset =
+                    m_constant_write_handler.write(a->get(), &new_size, m_compress_to_fp16, m_output_element_type);
 
                 m_xml_node.append_attribute("offset").set_value(static_cast<unsigned long long>(offset));
                 m_xml_node.append_attribute("size").set_value(static_cast<unsigned long long>(new_size));
@@ -1153,7 +1163,7 @@ std::string provide_bin_path(const std::string& xmlPath, const std::string& binP
 }
 
 void serializeFunc(std::ostream& xml_file,
-                   std::ostream& bin_file,
+                   ConstantWriter& constant_write_handler,
                    std::shared_ptr<ov::Model> model,
                    ov::pass::Serialize::Version ver,
                    bool deterministic = false) {
@@ -1177,14 +1187,22 @@ void serializeFunc(std::ostream& xml_file,
     std::string name = "net";
     pugi::xml_document xml_doc;
     pugi::xml_node net_node = xml_doc.append_child(name.c_str());
-    ConstantWriter constant_write_handler(bin_file);
     XmlSerializer visitor(net_node, name, constant_write_handler, version, deterministic);
     visitor.on_attribute(name, model);
 
     xml_doc.save(xml_file);
     xml_file.flush();
+}
+
+void serializeFunc(std::ostream& xml_file,
+                   std::ostream& bin_file,
+                   std::shared_ptr<ov::Model> model,
+                   ov::pass::Serialize::Version ver,
+                   bool deterministic = false) {
+    ConstantWriter constant_write_handler(bin_file);
+    serializeFunc(xml_file, constant_write_handler, model, ver, deterministic);
     bin_file.flush();
-};
+}
 
 }  // namespace
 
@@ -1357,6 +1375,158 @@ public:
         return n;
     }
 };
+
+// Returns the file mapping which holds the Constant data, the weights read from IR with mmap are shared by the
+// Constants through a sub-buffer
+std::shared_ptr<ov::MappedMemory> get_mapped_memory(const std::shared_ptr<ov::AlignedBuffer>& buffer) {
+    using MappedBuffer = ov::SharedBuffer<std::shared_ptr<ov::MappedMemory>>;
+    using SubBuffer = ov::SharedBuffer<std::shared_ptr<ov::AlignedBuffer>>;
+    if (const auto mapped = std::dynamic_pointer_cast<MappedBuffer>(buffer))
+        return mapped->get_shared_object();
+    if (const auto sub_buffer = std::dynamic_pointer_cast<SubBuffer>(buffer)) {
+        if (const auto mapped = std::dynamic_pointer_cast<MappedBuffer>(sub_buffer->get_shared_object()))
+            return mapped->get_shared_object();
+    }
+    return nullptr;
+}
+
+// Digests of the Constant data mapped from the weights files. The files are mapped read-only, so unlike the other
+// Constant buffers the data can't be modified in place and its digest is valid while the mapping is alive. The digest
+// is reused by the subsequent hash calculations of the models read from the same mapping (clones, compilations for
+// several devices). The entry is keyed by the data region and dropped once the file is unmapped, since the addresses
+// may be reused.
+class MappedDigestCache {
+public:
+    static MappedDigestCache& get() {
+        static MappedDigestCache cache;
+        return cache;
+    }
+
+    bool find(const std::shared_ptr<ov::MappedMemory>& mapping, const char* data, size_t size, uint64_t& digest) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        auto it = m_entries.find({data, size});
+        if (it == m_entries.end() || it->second.mapping.lock() != mapping)
+            return false;
+        digest = it->second.digest;
+        return true;
+    }
+
+    void insert(const std::shared_ptr<ov::MappedMemory>& mapping, const char* data, size_t size, uint64_t digest) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (m_entries.size() >= m_prune_threshold) {
+            for (auto it = m_entries.begin(); it != m_entries.end();) {
+                it = it->second.mapping.expired() ? m_entries.erase(it) : std::next(it);
+            }
+            m_prune_threshold = std::max(2 * m_entries.size(), min_prune_threshold);
+        }
+        m_entries[{data, size}] = {mapping, digest};
+    }
+
+private:
+    struct Region {
+        const char* data;
+        size_t size;
+
+        bool operator==(const Region& other) const {
+            return data == other.data && size == other.size;
+        }
+    };
+    struct RegionHash {
+        size_t operator()(const Region& region) const {
+            return std::hash<const char*>()(region.data) ^ (std::hash<size_t>()(region.size) << 1);
+        }
+    };
+    struct Entry {
+        std::weak_ptr<ov::MappedMemory> mapping;
+        uint64_t digest;
+    };
+
+    static constexpr size_t min_prune_threshold = 1024;
+
+    std::mutex m_mutex;
+    std::unordered_map<Region, Entry, RegionHash> m_entries;
+    size_t m_prune_threshold = min_prune_threshold;
+};
+
+/**
+ * Replaces the Constant data with the digest of the data, the digests are combined in the order of the Constants.
+ * Unlike the regular serialization the data is neither copied into the stream, nor compressed, nor deduplicated.
+ */
+class ConstantDigestWriter final : public ConstantWriter {
+public:
+    explicit ConstantDigestWriter(std::ostream& bin_data) : ConstantWriter(bin_data, false) {}
+
+    FilePosition write(const std::shared_ptr<ov::AlignedBuffer>& buffer,
+                       size_t* new_size,
+                       bool compress_to_fp16,
+                       ov::element::Type src_type) override {
+        const auto size = buffer->size();
+        // the buffer may be shared by several Constants of the model. The digests of the other buffers are not kept
+        // between the hash calculations, since their data can be modified in place (get_data_ptr_nc(), shared
+        // ov::Tensor)
+        auto it = m_digests.find(buffer.get());
+        if (it == m_digests.end()) {
+            const auto* data = static_cast<const char*>(buffer->get_ptr());
+            uint64_t digest = 0;
+            const auto mapping = get_mapped_memory(buffer);
+            if (!mapping || !MappedDigestCache::get().find(mapping, data, size, digest)) {
+                digest = compute_digest(data, size);
+                if (mapping)
+                    MappedDigestCache::get().insert(mapping, data, size, digest);
+            }
+            it = m_digests.emplace(buffer.get(), digest).first;
+        }
+        return append(it->second, size, new_size, compress_to_fp16, src_type);
+    }
+
+    FilePosition write(const char* ptr,
+                       size_t size,
+                       size_t* new_size,
+                       bool compress_to_fp16,
+                       ov::element::Type src_type) override {
+        return append(compute_digest(ptr, size), size, new_size, compress_to_fp16, src_type);
+    }
+
+    uint64_t get_result() const {
+        return m_seed;
+    }
+
+private:
+    static constexpr size_t block_size = 1024 * 1024;
+
+    static uint64_t compute_digest(const char* ptr, size_t size) {
+        const size_t num_blocks = (size + block_size - 1) / block_size;
+        if (num_blocks <= 1)
+            return ::hash_combine(ptr, static_cast<int64_t>(size));
+
+        std::vector<uint64_t> block_digests(num_blocks);
+        ov::parallel_for(num_blocks, [&](size_t block) {
+            const auto offset = block * block_size;
+            const auto block_bytes = size - offset < block_size ? size - offset : block_size;
+            block_digests[block] = ::hash_combine(ptr + offset, static_cast<int64_t>(block_bytes));
+        });
+        return ::hash_combine(block_digests.data(), static_cast<int64_t>(num_blocks * sizeof(uint64_t)));
+    }
+
+    FilePosition append(uint64_t digest,
+                        size_t size,
+                        size_t* new_size,
+                        bool compress_to_fp16,
+                        ov::element::Type src_type) {
+        m_seed = hash_combine(m_seed, digest);
+        m_seed = hash_combine(m_seed, compress_to_fp16 ? src_type.hash() : size_t{0});
+        // the offsets in the model are the same as in the serialized one without the data deduplication
+        const auto offset = m_offset;
+        m_offset += size;
+        *new_size = size;
+        return offset;
+    }
+
+    uint64_t m_seed = 0;
+    FilePosition m_offset = 0;
+    // the buffers are kept alive by the model during the hash calculation, so their addresses are not reused
+    std::unordered_map<const ov::AlignedBuffer*, uint64_t> m_digests;
+};
 }  // namespace
 
 bool pass::Hash::run_on_model(const std::shared_ptr<ov::Model>& model) {
@@ -1367,11 +1537,12 @@ bool pass::Hash::run_on_model(const std::shared_ptr<ov::Model>& model) {
     std::ostream bin(&binHash);
 
     // Determinism is important for hash calculation
-    serializeFunc(xml, bin, model, Serialize::Version::UNSPECIFIED, true);
+    ConstantDigestWriter constant_digest_writer(bin);
+    serializeFunc(xml, constant_digest_writer, model, Serialize::Version::UNSPECIFIED, true);
 
     uint64_t seed = 0;
     seed = hash_combine(seed, xmlHash.getResult());
-    seed = hash_combine(seed, binHash.getResult());
+    seed = hash_combine(seed, constant_digest_writer.get_result());
 
     m_hash = seed;
     // Return false because we didn't change OpenVINO Model
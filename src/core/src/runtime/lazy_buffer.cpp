@@ -0,0 +1,48 @@
+// Copyright (C) 2018-2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "openvino/runtime/lazy_buffer.hpp"
+
+#include <algorithm>
+#include <memory>
+
+namespace ov {
+
+LazyBuffer::LazyBuffer(size_t byte_size, Generator generator, size_t alignment)
+    : m_generator(std::move(generator)),
+      m_alignment(alignment) {
+    m_allocated_buffer = nullptr;
+    m_aligned_buffer = nullptr;
+    m_byte_size = std::max<size_t>(1, byte_size);
+}
+
+LazyBuffer::~LazyBuffer() = default;
+
+void* LazyBuffer::materialize() {
+    if (auto ptr = m_materialized.load(std::memory_order_acquire))
+        return ptr;
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (auto ptr = m_materialized.load(std::memory_order_relaxed))
+        return ptr;
+
+    std::unique_ptr<char[]> allocated(new char[m_byte_size + m_alignment]);
+    char* aligned = allocated.get();
+    const size_t mod = m_alignment != 0 ? reinterpret_cast<size_t>(aligned) % m_alignment : 0;
+    if (mod != 0)
+        aligned += m_alignment - mod;
+    m_generator(aligned, m_byte_size);
+    m_generator = nullptr;
+
+    m_allocated_buffer = allocated.release();
+    m_aligned_buffer = aligned;
+    m_materialized.store(aligned, std::memory_order_release);
+    return aligned;
+}
+
+bool LazyBuffer::is_materialized() const {
+    return m_materialized.load(std::memory_order_acquire) != nullptr;
+}
+
+}  // namespace ov
@@ -4,6 +4,7 @@
 
 #pragma once
 
+#include <atomic>
 #include <memory>
 #include <openvino/core/except.hpp>
 #include <openvino/core/node.hpp>
@@ -22,6 +23,7 @@ public:
     }
 
 private:
-    bool m_use_topological_cache;
+    // the matcher passes may be applied to the disjoint subgraphs of the model in parallel
+    std::atomic_bool m_use_topological_cache;
 };
 }  // namespace ov
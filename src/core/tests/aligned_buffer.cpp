@@ -4,7 +4,12 @@
 
 #include "openvino/runtime/aligned_buffer.hpp"
 
+#include <cstring>
+#include <istream>
+
 #include "gtest/gtest.h"
+#include "openvino/runtime/lazy_buffer.hpp"
+#include "openvino/runtime/shared_buffer.hpp"
 
 using namespace ov;
 
@@ -33,3 +38,56 @@ TEST(aligned_buffer, move) {
         EXPECT_NE(buffer2.get_ptr(), nullptr);
     }
 }
+
+TEST(aligned_buffer, owning_shared_stream_buffer) {
+    std::string data = "header\n0123456789";
+    auto buffer = std::make_shared<SharedBuffer<std::string*>>(&data[0], data.size(), &data);
+    OwningSharedStreamBuffer stream_buffer(buffer);
+    std::istream stream(&stream_buffer);
+
+    std::string header;
+    std::getline(stream, header);
+    EXPECT_EQ(header, "header");
+    EXPECT_EQ(stream.tellg(), 7);
+    EXPECT_EQ(stream_buffer.get_offset(), 7);
+
+    char chars[4] = {};
+    stream.seekg(3, std::ios_base::cur);
+    stream.read(chars, 3);
+    EXPECT_STREQ(chars, "345");
+
+    stream.seekg(0, std::ios_base::end);
+    EXPECT_EQ(stream.tellg(), static_cast<std::streamoff>(data.size()));
+    stream.read(chars, 1);
+    EXPECT_TRUE(stream.eof());
+
+    EXPECT_EQ(stream_buffer.get_buffer(), buffer);
+    EXPECT_EQ(stream_buffer.get_buffer()->get_ptr(), static_cast<void*>(&data[0]));
+}
+
+TEST(aligned_buffer, lazy_buffer) {
+    size_t generated = 0;
+    auto source = std::make_shared<int>(7);
+    std::weak_ptr<int> source_ref = source;
+    LazyBuffer buffer(100, [&generated, source](void* data, size_t size) {
+        std::memset(data, *source, size);
+        ++generated;
+    });
+    source.reset();
+    EXPECT_EQ(buffer.size(), 100);
+    EXPECT_EQ(buffer.get_ptr(), nullptr);
+    EXPECT_FALSE(buffer.is_materialized());
+    EXPECT_FALSE(source_ref.expired());
+
+    auto data = static_cast<const uint8_t*>(buffer.materialize());
+    ASSERT_NE(data, nullptr);
+    EXPECT_TRUE(buffer.is_materialized());
+    EXPECT_EQ(reinterpret_cast<size_t>(data) % 64, 0);
+    EXPECT_EQ(data[0], 7);
+    EXPECT_EQ(data[99], 7);
+    EXPECT_EQ(buffer.get_ptr(), data);
+    // the generator is released with the captured objects
+    EXPECT_TRUE(source_ref.expired());
+    EXPECT_EQ(buffer.materialize(), data);
+    EXPECT_EQ(generated, 1);
+}
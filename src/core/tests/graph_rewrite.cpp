@@ -8,6 +8,7 @@
 
 #include "common_test_utils/ov_test_utils.hpp"
 #include "openvino/core/rtti.hpp"
+#include "openvino/op/abs.hpp"
 #include "openvino/op/constant.hpp"
 #include "openvino/op/divide.hpp"
 #include "openvino/op/op.hpp"
@@ -15,7 +16,9 @@
 #include "openvino/op/result.hpp"
 #include "openvino/op/tanh.hpp"
 #include "openvino/pass/manager.hpp"
+#include "openvino/pass/pass_profile.hpp"
 #include "openvino/pass/pattern/op/label.hpp"
+#include "openvino/pass/pattern/op/wrap_type.hpp"
 
 using namespace ::testing;
 using namespace std;
@@ -442,3 +445,78 @@ TEST(GraphRewriteTest, nodes_use_count) {
     m.register_pass<CheckConsumers>();
     ASSERT_NO_THROW(m.run_passes(f));
 }
+
+// Replaces Relu with Abs without registering the new node
+class ReluToAbs : public ov::pass::MatcherPass {
+public:
+    OPENVINO_RTTI("ReluToAbs");
+    ReluToAbs() {
+        auto relu = pattern::wrap_type<op::v0::Relu>();
+        ov::matcher_pass_callback callback = [](pattern::Matcher& m) {
+            auto node = m.get_match_root();
+            ov::replace_node(node, std::make_shared<op::v0::Abs>(node->input_value(0)));
+            return true;
+        };
+        register_matcher(std::make_shared<pattern::Matcher>(relu, "ReluToAbs"), callback);
+    }
+};
+
+class AbsAbsElimination : public ov::pass::MatcherPass {
+public:
+    OPENVINO_RTTI("AbsAbsElimination");
+    AbsAbsElimination() {
+        auto abs = pattern::wrap_type<op::v0::Abs>({pattern::wrap_type<op::v0::Abs>()});
+        ov::matcher_pass_callback callback = [](pattern::Matcher& m) {
+            auto node = m.get_match_root();
+            return ov::replace_output_update_name(node->output(0), node->input_value(0));
+        };
+        register_matcher(std::make_shared<pattern::Matcher>(abs, "AbsAbsElimination"), callback);
+    }
+};
+
+class AbsReluRewrite : public ov::pass::GraphRewrite {
+public:
+    OPENVINO_RTTI("AbsReluRewrite");
+    AbsReluRewrite() {
+        add_matcher<AbsAbsElimination>();
+        add_matcher<ReluToAbs>();
+    }
+};
+
+namespace {
+// many branches are not changed by the rewrite, a few of them have Abs -> Relu, which is replaced with Abs -> Abs
+// and then eliminated
+std::shared_ptr<Model> get_abs_relu_model(size_t branches, size_t rewritten_branches) {
+    ParameterVector params;
+    OutputVector results;
+    for (size_t i = 0; i < branches; ++i) {
+        params.push_back(std::make_shared<op::v0::Parameter>(element::f32, Shape{2}));
+        Output<Node> output = std::make_shared<op::v0::Abs>(params.back());
+        if (i < rewritten_branches) {
+            output = std::make_shared<op::v0::Relu>(output);
+        }
+        results.push_back(std::make_shared<op::v0::Tanh>(output));
+    }
+    return std::make_shared<Model>(results, params);
+}
+}  // namespace
+
+TEST(GraphRewriteTest, matcher_invocations) {
+    auto model = get_abs_relu_model(100, 10);
+    PassProfileScope profile_scope;
+    pass::Manager manager;
+    // the nodes created by ReluToAbs are not visited, so the second run is needed to eliminate them
+    manager.register_pass<AbsReluRewrite>();
+    manager.register_pass<AbsReluRewrite>();
+    EXPECT_TRUE(manager.run_passes(model));
+    ASSERT_EQ(count_ops_of_type<op::v0::Relu>(model), 0);
+    ASSERT_EQ(count_ops_of_type<op::v0::Abs>(model), 100);
+
+    const auto& profile = profile_scope.get_profile();
+    ASSERT_EQ(profile.size(), 2u);
+    // the matchers are invoked only for the nodes of the root types: 100 Abs and 10 Relu nodes, then 110 Abs nodes
+    EXPECT_EQ(profile[0].matcher_invocations, 110u);
+    EXPECT_EQ(profile[0].applied_rewrites, 10u);
+    EXPECT_EQ(profile[1].matcher_invocations, 110u);
+    EXPECT_EQ(profile[1].applied_rewrites, 10u);
+}
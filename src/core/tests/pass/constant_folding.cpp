@@ -13,9 +13,11 @@
 #include "openvino/op/acosh.hpp"
 #include "openvino/op/add.hpp"
 #include "openvino/op/constant.hpp"
+#include "openvino/op/convert.hpp"
 #include "openvino/op/convert_like.hpp"
 #include "openvino/op/loop.hpp"
 #include "openvino/op/multiply.hpp"
+#include "openvino/op/subtract.hpp"
 #include "ov_ops/type_relaxed.hpp"
 #include "transformations/common_optimizations/disable_shapeof_constant_folding.hpp"
 #include "transformations/utils/utils.hpp"
@@ -3954,6 +3956,120 @@ TEST(constant_folding, sq_diff) {
     ASSERT_NE(res_node, nullptr);
 }
 
+TEST(constant_folding, independent_large_subgraphs) {
+    // the branches are folded in parallel, the large element-wise operations are evaluated in parallel as well
+    const size_t branches = 8;
+    const Shape weights_shape{64, 2048};
+    ResultVector results;
+    for (size_t b = 0; b < branches; ++b) {
+        vector<float> weights(shape_size(weights_shape));
+        for (size_t i = 0; i < weights.size(); ++i)
+            weights[i] = static_cast<float>((i + b) % 17);
+        vector<float> scales(weights_shape[0]);
+        for (size_t i = 0; i < scales.size(); ++i)
+            scales[i] = static_cast<float>(i % 5 + b);
+
+        auto weights_const = op::v0::Constant::create(element::f32, weights_shape, weights);
+        auto scales_const = op::v0::Constant::create(element::f32, Shape{weights_shape[0], 1}, scales);
+        auto shift_const = op::v0::Constant::create(element::f32, weights_shape, vector<float>(weights.size(), 1.f));
+        auto multiply = make_shared<op::v1::Multiply>(weights_const, scales_const);
+        auto add = make_shared<op::v1::Add>(multiply, shift_const);
+        results.push_back(make_shared<op::v0::Result>(add));
+    }
+    auto model = make_shared<Model>(results, ParameterVector{});
+
+    run_constant_folding(model);
+
+    EXPECT_EQ(count_ops_of_type<op::v1::Multiply>(model), 0);
+    EXPECT_EQ(count_ops_of_type<op::v1::Add>(model), 0);
+    for (size_t b = 0; b < branches; ++b) {
+        const auto values = get_result_constant_data<float>(model, b);
+        ASSERT_EQ(values.size(), shape_size(weights_shape));
+        for (size_t i = 0; i < values.size(); ++i) {
+            const auto scale = static_cast<float>(i / weights_shape[1] % 5 + b);
+            const auto expected = static_cast<float>((i + b) % 17) * scale + 1.f;
+            ASSERT_EQ(values[i], expected) << "branch " << b << " index " << i;
+        }
+    }
+}
+
+TEST(constant_folding, weights_decompression_chain) {
+    // the large u8 decompression chain is folded lazily: the data is evaluated on the first access, the source
+    // Constants are released after it
+    const Shape weights_shape{512, 1024};
+    vector<uint8_t> weights(shape_size(weights_shape));
+    for (size_t i = 0; i < weights.size(); ++i)
+        weights[i] = static_cast<uint8_t>(i % 251);
+    vector<float> scales(weights_shape[0]);
+    for (size_t i = 0; i < scales.size(); ++i)
+        scales[i] = 0.5f * static_cast<float>(i % 7 + 1);
+
+    auto weights_const = op::v0::Constant::create(element::u8, weights_shape, weights);
+    auto convert = make_shared<op::v0::Convert>(weights_const, element::f32);
+    auto zero_point = op::v0::Constant::create(element::f32, Shape{}, {128});
+    auto subtract = make_shared<op::v1::Subtract>(convert, zero_point);
+    auto scale = op::v0::Constant::create(element::f32, Shape{weights_shape[0], 1}, scales);
+    auto multiply = make_shared<op::v1::Multiply>(subtract, scale);
+    auto model = make_shared<Model>(make_shared<op::v0::Result>(multiply), ParameterVector{});
+    weak_ptr<Node> weights_ref = weights_const;
+    weak_ptr<Node> scale_ref = scale;
+    weights_const.reset();
+    convert.reset();
+    zero_point.reset();
+    subtract.reset();
+    scale.reset();
+    multiply.reset();
+
+    run_constant_folding(model);
+
+    EXPECT_EQ(count_ops_of_type<op::v0::Convert>(model), 0);
+    EXPECT_EQ(count_ops_of_type<op::v1::Subtract>(model), 0);
+    EXPECT_EQ(count_ops_of_type<op::v1::Multiply>(model), 0);
+    auto result = get_result_constant(model);
+    ASSERT_TRUE(result);
+    EXPECT_EQ(result->get_element_type(), element::f32);
+    EXPECT_EQ(result->get_shape(), weights_shape);
+    EXPECT_EQ(result->get_byte_size(), shape_size(weights_shape) * sizeof(float));
+    // the chain isn't evaluated yet, so it still references the source Constants
+    EXPECT_FALSE(weights_ref.expired());
+    EXPECT_FALSE(scale_ref.expired());
+
+    const auto values = result->cast_vector<float>();
+    EXPECT_TRUE(weights_ref.expired());
+    EXPECT_TRUE(scale_ref.expired());
+    for (size_t i = 0; i < values.size(); ++i) {
+        const auto expected = (static_cast<float>(weights[i]) - 128.f) * scales[i / weights_shape[1]];
+        ASSERT_EQ(values[i], expected) << "index " << i;
+    }
+    // the data is evaluated once
+    EXPECT_EQ(result->get_data_ptr(), result->get_data_ptr());
+}
+
+TEST(constant_folding, weights_decompression_chain_not_lazy) {
+    // only the large chains starting with the u8/i8 weights are folded lazily
+    const auto check = [](const element::Type& type, const Shape& shape) {
+        auto weights_const = op::v0::Constant::create(type, shape, {3});
+        auto convert = make_shared<op::v0::Convert>(weights_const, element::f32);
+        auto scale = op::v0::Constant::create(element::f32, Shape{}, {0.5f});
+        auto multiply = make_shared<op::v1::Multiply>(convert, scale);
+        auto model = make_shared<Model>(make_shared<op::v0::Result>(multiply), ParameterVector{});
+        weak_ptr<Node> weights_ref = weights_const;
+        weights_const.reset();
+        convert.reset();
+        multiply.reset();
+
+        run_constant_folding(model);
+
+        EXPECT_TRUE(weights_ref.expired()) << type << " " << shape;
+        const auto values = get_result_constant_data<float>(model, 0);
+        EXPECT_EQ(values, vector<float>(shape_size(shape), 1.5f)) << type << " " << shape;
+    };
+    check(element::u8, Shape{16, 16});
+    check(element::i8, Shape{16, 16});
+    check(element::f16, Shape{512, 1024});
+    check(element::i32, Shape{512, 1024});
+}
+
 class UnsupportedTypesTest : public testing::TestWithParam<element::Type> {};
 
 TEST_P(UnsupportedTypesTest, add_multiply) {
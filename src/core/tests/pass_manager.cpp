@@ -12,12 +12,16 @@
 #include "common_test_utils/test_tools.hpp"
 #include "openvino/core/graph_util.hpp"
 #include "openvino/core/model.hpp"
+#include "openvino/op/abs.hpp"
 #include "openvino/op/add.hpp"
 #include "openvino/op/matmul.hpp"
 #include "openvino/op/multiply.hpp"
 #include "openvino/op/parameter.hpp"
+#include "openvino/op/relu.hpp"
 #include "openvino/pass/manager.hpp"
 #include "openvino/pass/pass.hpp"
+#include "openvino/pass/pass_profile.hpp"
+#include "openvino/pass/pattern/op/wrap_type.hpp"
 
 using namespace ov;
 using namespace std;
@@ -75,6 +79,69 @@ bool validate_list(const std::vector<std::shared_ptr<ov::Node>>& nodes) {
     return rc;
 }
 
+class ReluToAbs : public ov::pass::MatcherPass {
+public:
+    OPENVINO_RTTI("ReluToAbs");
+    ReluToAbs() {
+        auto relu = ov::pass::pattern::wrap_type<ov::op::v0::Relu>();
+        auto callback = [](ov::pass::pattern::Matcher& m) {
+            auto node = m.get_match_root();
+            auto abs = std::make_shared<ov::op::v0::Abs>(node->input_value(0));
+            ov::replace_node(node, abs);
+            return true;
+        };
+        register_matcher(std::make_shared<ov::pass::pattern::Matcher>(relu, "ReluToAbs"), callback);
+    }
+};
+
+class AbsToRelu : public ov::pass::MatcherPass {
+public:
+    OPENVINO_RTTI("AbsToRelu");
+    AbsToRelu() {
+        auto abs = ov::pass::pattern::wrap_type<ov::op::v0::Abs>();
+        auto callback = [](ov::pass::pattern::Matcher& m) {
+            auto node = m.get_match_root();
+            auto relu = std::make_shared<ov::op::v0::Relu>(node->input_value(0));
+            ov::replace_node(node, relu);
+            return true;
+        };
+        register_matcher(std::make_shared<ov::pass::pattern::Matcher>(abs, "AbsToRelu"), callback);
+    }
+};
+
+class NestedManagerPass : public ov::pass::ModelPass {
+public:
+    OPENVINO_RTTI("NestedManagerPass");
+    bool run_on_model(const std::shared_ptr<ov::Model>& model) override {
+        ov::pass::Manager manager;
+        manager.set_per_pass_validation(false);
+        manager.register_pass<ReluToAbs>();
+        return manager.run_passes(model);
+    }
+};
+
+// the independent chains of Relu operations
+std::shared_ptr<ov::Model> make_disjoint_graph(size_t subgraphs, size_t chain_size) {
+    ov::ParameterVector params;
+    ov::OutputVector results;
+    for (size_t i = 0; i < subgraphs; ++i) {
+        params.push_back(std::make_shared<ov::op::v0::Parameter>(ov::element::f32, ov::Shape{2, 2}));
+        ov::Output<ov::Node> output = params.back();
+        for (size_t j = 0; j < chain_size; ++j) {
+            output = std::make_shared<ov::op::v0::Relu>(output);
+        }
+        results.push_back(output);
+    }
+    return std::make_shared<ov::Model>(results, params);
+}
+
+size_t count_relu(const std::shared_ptr<ov::Model>& model) {
+    const auto ops = model->get_ops();
+    return std::count_if(ops.begin(), ops.end(), [](const std::shared_ptr<ov::Node>& node) {
+        return ov::is_type<ov::op::v0::Relu>(node);
+    });
+}
+
 }  // namespace
 
 TEST(pass_manager, add) {
@@ -90,3 +157,83 @@ TEST(pass_manager, add) {
     EXPECT_EQ(node_count, sorted.size());
     EXPECT_TRUE(validate_list(sorted));
 }
+
+TEST(pass_manager, profile) {
+    auto model = make_disjoint_graph(2, 3);
+    ov::pass::PassProfileScope profile_scope;
+
+    ov::pass::Manager manager;
+    manager.set_per_pass_validation(false);
+    manager.register_pass<NestedManagerPass>();
+    manager.register_pass<ReluToAbs>();
+    EXPECT_TRUE(manager.run_passes(model));
+
+    const auto& profile = profile_scope.get_profile();
+    ASSERT_EQ(profile.size(), 3u);
+    EXPECT_EQ(profile[0].name, "NestedManagerPass");
+    EXPECT_EQ(profile[0].depth, 0u);
+    EXPECT_TRUE(profile[0].applied);
+    // the nested pass is recorded after its parent
+    EXPECT_EQ(profile[1].name, "ReluToAbs");
+    EXPECT_EQ(profile[1].depth, 1u);
+    EXPECT_EQ(profile[1].applied_rewrites, 6u);
+    EXPECT_GE(profile[1].visited_nodes, 6u);
+    EXPECT_EQ(profile[0].applied_rewrites, profile[1].applied_rewrites);
+    EXPECT_GE(profile[0].time, profile[1].time);
+
+    EXPECT_EQ(profile[2].name, "ReluToAbs");
+    EXPECT_EQ(profile[2].depth, 0u);
+    EXPECT_FALSE(profile[2].applied);
+    EXPECT_EQ(profile[2].applied_rewrites, 0u);
+}
+
+TEST(pass_manager, parallel_matcher_passes) {
+    auto model = make_disjoint_graph(16, 8);
+    ov::pass::PassProfileScope profile_scope;
+
+    ov::pass::Manager manager;
+    manager.set_parallel_matcher_passes(true);
+    manager.register_parallel_pass<ReluToAbs>();
+    EXPECT_TRUE(manager.run_passes(model));
+    EXPECT_EQ(count_relu(model), 0u);
+    EXPECT_NO_THROW(model->validate_nodes_and_infer_types());
+
+    const auto& profile = profile_scope.get_profile();
+    ASSERT_FALSE(profile.empty());
+    EXPECT_EQ(profile[0].name, "ReluToAbs");
+    EXPECT_EQ(profile[0].applied_rewrites, 16u * 8u);
+}
+
+TEST(pass_manager, parallel_matcher_passes_sequence) {
+    // the model is split once for both passes, the second one is applied to the nodes created by the first one
+    auto model = make_disjoint_graph(16, 8);
+    ov::pass::PassProfileScope profile_scope;
+
+    ov::pass::Manager manager;
+    manager.set_per_pass_validation(false);
+    manager.set_parallel_matcher_passes(true);
+    manager.register_parallel_pass<ReluToAbs>();
+    manager.register_parallel_pass<AbsToRelu>();
+    EXPECT_TRUE(manager.run_passes(model));
+    EXPECT_EQ(count_relu(model), 16u * 8u);
+    EXPECT_NO_THROW(model->validate_nodes_and_infer_types());
+
+    const auto& profile = profile_scope.get_profile();
+    ASSERT_EQ(profile.size(), 2u);
+    EXPECT_EQ(profile[0].applied_rewrites, 16u * 8u);
+    EXPECT_EQ(profile[1].name, "AbsToRelu");
+    EXPECT_EQ(profile[1].applied_rewrites, 16u * 8u);
+}
+
+TEST(pass_manager, parallel_matcher_passes_connected_model) {
+    // the single subgraph is processed by the registered pass instance
+    auto model = make_test_graph();
+    auto relu = std::make_shared<ov::op::v0::Relu>(model->get_results()[0]->input_value(0));
+    model->get_results()[0]->input(0).replace_source_output(relu);
+
+    ov::pass::Manager manager;
+    manager.set_parallel_matcher_passes(true);
+    manager.register_parallel_pass<ReluToAbs>();
+    EXPECT_TRUE(manager.run_passes(model));
+    EXPECT_EQ(count_relu(model), 0u);
+}
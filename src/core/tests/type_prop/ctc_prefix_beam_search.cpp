@@ -0,0 +1,65 @@
+// Copyright (C) 2018-2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "ov_ops/ctc_prefix_beam_search.hpp"
+
+#include <gtest/gtest.h>
+
+#include "common_test_utils/type_prop.hpp"
+#include "openvino/opsets/opset9.hpp"
+
+using namespace std;
+using namespace ov;
+using namespace testing;
+
+TEST(type_prop, ctc_prefix_beam_search) {
+    const auto logits = make_shared<opset9::Parameter>(element::f32, PartialShape{-1, 20, 30});
+    const auto seq_len = make_shared<opset9::Parameter>(element::i32, PartialShape{4});
+    const auto blank = make_shared<opset9::Parameter>(element::i32, PartialShape{});
+    const auto token_scores = make_shared<opset9::Parameter>(element::f32, PartialShape{30});
+
+    const auto op = make_shared<op::internal::CTCPrefixBeamSearch>(logits, seq_len, blank, token_scores, 8, 0.5f);
+    EXPECT_EQ(op->get_beam_size(), 8u);
+    EXPECT_EQ(op->get_lm_weight(), 0.5f);
+    EXPECT_EQ(op->get_output_element_type(0), element::i32);
+    EXPECT_EQ(op->get_output_element_type(1), element::i32);
+    EXPECT_EQ(op->get_output_element_type(2), element::f32);
+    EXPECT_EQ(op->get_output_partial_shape(0), (PartialShape{4, 20}));
+    EXPECT_EQ(op->get_output_partial_shape(1), (PartialShape{4}));
+    EXPECT_EQ(op->get_output_partial_shape(2), (PartialShape{4}));
+}
+
+TEST(type_prop, ctc_prefix_beam_search_default_blank) {
+    const auto logits = make_shared<opset9::Parameter>(element::f32, PartialShape::dynamic());
+    const auto seq_len = make_shared<opset9::Parameter>(element::i64, PartialShape::dynamic());
+
+    const auto op = make_shared<op::internal::CTCPrefixBeamSearch>(logits, seq_len);
+    EXPECT_EQ(op->get_beam_size(), 10u);
+    EXPECT_EQ(op->get_output_partial_shape(0), (PartialShape{-1, -1}));
+    EXPECT_EQ(op->get_output_partial_shape(1), (PartialShape{-1}));
+}
+
+TEST(type_prop, ctc_prefix_beam_search_invalid_input) {
+    const auto logits = make_shared<opset9::Parameter>(element::f32, PartialShape{4, 20, 30});
+    const auto seq_len = make_shared<opset9::Parameter>(element::i32, PartialShape{4});
+    const auto blank = make_shared<opset9::Parameter>(element::i32, PartialShape{});
+
+    OV_EXPECT_THROW(make_shared<op::internal::CTCPrefixBeamSearch>(logits, seq_len, size_t{0}),
+                    NodeValidationFailure,
+                    HasSubstr("beam_size attribute must be greater than zero"));
+    OV_EXPECT_THROW(make_shared<op::internal::CTCPrefixBeamSearch>(
+                        logits,
+                        make_shared<opset9::Parameter>(element::i32, PartialShape{3})),
+                    NodeValidationFailure,
+                    HasSubstr("'sequence_length' input size must be equal to the 'logits' batch size"));
+    OV_EXPECT_THROW(make_shared<op::internal::CTCPrefixBeamSearch>(
+                        logits,
+                        seq_len,
+                        blank,
+                        make_shared<opset9::Parameter>(element::f32, PartialShape{29}),
+                        10,
+                        0.5f),
+                    NodeValidationFailure,
+                    HasSubstr("'token_scores' input must have 1D shape with the number of classes"));
+}
@@ -44,7 +44,11 @@ protected:
     bool supported_impl(const std::vector<ov::Any>& variants) const override;
 
     /// \brief Reads model from file or std::istream
-    /// \param params Can be path to the model file or std::istream
+    /// \param params Can be path to the model file or std::istream, optionally followed by the weights and an ov::AnyMap
+    /// of the options:
+    /// - "IR_RELEASE_XML" (bool, false by default): the xml nodes of the layers are freed during the conversion and the
+    /// rest of the document, including the xml text it was parsed from, right after the model is created. Such input
+    /// model can be converted only once.
     /// \return InputModel::Ptr
     InputModel::Ptr load_impl(const std::vector<ov::Any>& params) const override;
 
@@ -64,6 +64,11 @@ size_t get_ir_version(std::istream& model) {
 bool FrontEnd::supported_impl(const std::vector<ov::Any>& variants) const {
     // Last boolean flag in `variants` (if presented) is reserved for FE configuration
     size_t extra_variants_num = variants.size() > 0 && variants[variants.size() - 1].is<bool>() ? 1 : 0;
+    // as well as the map of the options
+    for (const auto& variant : variants) {
+        if (variant.is<ov::AnyMap>())
+            extra_variants_num++;
+    }
     std::ifstream local_model_stream;
     std::istream* provided_model_stream = nullptr;
 
@@ -118,6 +123,7 @@ InputModel::Ptr FrontEnd::load_impl(const std::vector<ov::Any>& variants) const
     std::ifstream local_model_stream;
     std::istream* provided_model_stream = nullptr;
     std::shared_ptr<ov::AlignedBuffer> weights;
+    bool release_xml = false;
 
     auto create_extensions_map = [&]() -> std::unordered_map<ov::DiscreteTypeInfo, ov::BaseOpExtension::Ptr> {
         std::unordered_map<ov::DiscreteTypeInfo, ov::BaseOpExtension::Ptr> exts;
@@ -130,9 +136,10 @@ InputModel::Ptr FrontEnd::load_impl(const std::vector<ov::Any>& variants) const
 
     auto create_input_model = [&]() -> std::shared_ptr<InputModel> {
         if (provided_model_stream) {
-            return std::make_shared<InputModel>(*provided_model_stream, weights, create_extensions_map());
+            return std::make_shared<InputModel>(*provided_model_stream, weights, create_extensions_map(), release_xml);
         } else if (local_model_stream.is_open()) {
-            auto input_model = std::make_shared<InputModel>(local_model_stream, weights, create_extensions_map());
+            auto input_model =
+                std::make_shared<InputModel>(local_model_stream, weights, create_extensions_map(), release_xml);
             local_model_stream.close();
             return input_model;
         }
@@ -182,6 +189,11 @@ InputModel::Ptr FrontEnd::load_impl(const std::vector<ov::Any>& variants) const
 #endif
         } else if (variant.is<std::shared_ptr<ov::AlignedBuffer>>()) {
             weights = variant.as<std::shared_ptr<ov::AlignedBuffer>>();
+        } else if (variant.is<ov::AnyMap>()) {
+            const auto& options = variant.as<ov::AnyMap>();
+            auto it = options.find("IR_RELEASE_XML");
+            if (it != options.end())
+                release_xml = it->second.as<bool>();
         }
     }
     bool enable_mmap = variants[variants.size() - 1].is<bool>() ? variants[variants.size() - 1].as<bool>() : false;
@@ -205,13 +205,18 @@ class InputModel::InputModelIRImpl {
     std::unordered_map<std::string, ov::OpSet> m_opsets;
     pugi::xml_node m_root;
     pugi::xml_document m_xml_doc;
+    // the document is consumed by the conversion to keep the peak memory low
+    bool m_release_xml = false;
+    bool m_converted = false;
 
 public:
     InputModelIRImpl(std::istream& stream,
                      const std::shared_ptr<ov::AlignedBuffer>& weights,
-                     const std::unordered_map<ov::DiscreteTypeInfo, ov::BaseOpExtension::Ptr>& extensions)
+                     const std::unordered_map<ov::DiscreteTypeInfo, ov::BaseOpExtension::Ptr>& extensions,
+                     bool release_xml)
         : m_weights(weights),
-          m_extensions(extensions) {
+          m_extensions(extensions),
+          m_release_xml(release_xml) {
         pugi::xml_parse_result res = m_xml_doc.load(stream);
         if (res.status != pugi::status_ok) {
             OPENVINO_THROW(res.description(), " at offset ", res.offset);
@@ -227,8 +232,9 @@ public:
 
 InputModel::InputModel(std::istream& stream,
                        const std::shared_ptr<ov::AlignedBuffer>& weights,
-                       const std::unordered_map<ov::DiscreteTypeInfo, ov::BaseOpExtension::Ptr>& extensions) {
-    _impl = std::make_shared<InputModelIRImpl>(stream, weights, extensions);
+                       const std::unordered_map<ov::DiscreteTypeInfo, ov::BaseOpExtension::Ptr>& extensions,
+                       bool release_xml) {
+    _impl = std::make_shared<InputModelIRImpl>(stream, weights, extensions, release_xml);
 }
 
 std::shared_ptr<ov::Model> InputModel::convert() {
@@ -236,15 +242,32 @@ std::shared_ptr<ov::Model> InputModel::convert() {
 }
 
 std::shared_ptr<ov::Model> InputModel::InputModelIRImpl::convert() {
+    OPENVINO_ASSERT(!m_converted, "IR input model created with IR_RELEASE_XML can be converted only once");
+    m_converted = m_release_xml;
     std::unordered_map<std::string, std::shared_ptr<ov::op::util::Variable>> variables;
 
-    // Load default opsets
-    size_t version = static_cast<size_t>(ov::util::pugixml::get_uint64_attr(m_root, "version", 0));
-    ov::XmlDeserializer visitor(m_root, m_weights, m_opsets, m_extensions, variables, version);
+    // the whole document including the xml text buffer is freed as soon as the model is created or the conversion fails
+    auto release_xml = [this] {
+        if (m_release_xml) {
+            m_root = {};
+            m_xml_doc.reset();
+        }
+    };
+
     std::shared_ptr<ov::Model> model;
-    visitor.on_attribute("net", model);
-    model->get_rt_info()["version"] = int64_t(version);
-    parse_pre_process(m_root, m_weights, model);
+    try {
+        // Load default opsets
+        size_t version = static_cast<size_t>(ov::util::pugixml::get_uint64_attr(m_root, "version", 0));
+        // The layers are removed from the document right after the corresponding operations are created
+        ov::XmlDeserializer visitor(m_root, m_weights, m_opsets, m_extensions, variables, version, m_release_xml);
+        visitor.on_attribute("net", model);
+        model->get_rt_info()["version"] = int64_t(version);
+        parse_pre_process(m_root, m_weights, model);
+    } catch (...) {
+        release_xml();
+        throw;
+    }
+    release_xml();
 
     return model;
 }
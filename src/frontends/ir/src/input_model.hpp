@@ -22,8 +22,15 @@ class InputModel : public ov::frontend::InputModel {
 public:
     InputModel(std::istream& stream,
                const std::shared_ptr<ov::AlignedBuffer>& weights,
-               const std::unordered_map<ov::DiscreteTypeInfo, ov::BaseOpExtension::Ptr>& extensions);
-
+               const std::unordered_map<ov::DiscreteTypeInfo, ov::BaseOpExtension::Ptr>& extensions,
+               bool release_xml = false);
+
+    /// \brief Creates the model. If release_xml is set, the xml nodes of the layers are freed as soon as their
+    /// operations are created and the rest of the document right after the model is created, even if the conversion
+    /// fails. The input model can be converted only once then.
+    /// The xml text, which pugixml parses in place, is kept until the whole document is released, so only the node
+    /// and attribute structures are freed during the conversion. Counted on the IR files of the tests, they take
+    /// about 3 times the size of the xml text, i.e. about 3/4 of the document memory.
     std::shared_ptr<Model> convert();
 };
 
@@ -4,11 +4,14 @@
 
 #include "ir_deserializer.hpp"
 
+#include <algorithm>
+#include <mutex>
 #include <pugixml.hpp>
 #include <regex>
 
 #include "openvino/core/except.hpp"
 #include "openvino/core/meta_data.hpp"
+#include "openvino/core/parallel.hpp"
 #include "openvino/core/type/element_type.hpp"
 #include "openvino/op/constant.hpp"
 #include "openvino/op/loop.hpp"
@@ -29,6 +32,34 @@
 
 using namespace ov::util;
 
+namespace {
+// Runs the function for each layer in parallel if the IR is large enough, the first exception is rethrown
+template <typename Func>
+void parallel_for_layers(size_t count, const Func& func) {
+    constexpr size_t min_parallel_count = 256;
+    if (count < min_parallel_count) {
+        for (size_t idx = 0; idx < count; idx++) {
+            func(idx);
+        }
+        return;
+    }
+
+    std::mutex exception_mutex;
+    std::exception_ptr exception;
+    ov::parallel_for(count, [&](size_t idx) {
+        try {
+            func(idx);
+        } catch (...) {
+            std::lock_guard<std::mutex> lock(exception_mutex);
+            if (!exception)
+                exception = std::current_exception();
+        }
+    });
+    if (exception)
+        std::rethrow_exception(exception);
+}
+}  // namespace
+
 ov::XmlDeserializer::IoMap ov::XmlDeserializer::updated_io_map(const pugi::xml_node& node,
                                                                const pugi::xml_node& body_node) {
     if (body_node.empty()) {
@@ -426,9 +457,9 @@ void ov::XmlDeserializer::on_adapter(const std::string& name, ov::ValueAccessor<
         if (body_node.empty()) {
             OPENVINO_THROW("TensorIterator has no body.");
         }
-        model = parse_function(m_node.child(name.c_str()), m_weights);
+        model = parse_function(m_node.child(name.c_str()), m_weights, false);
     } else if (!name.compare("net")) {
-        model = parse_function(m_node, m_weights);
+        model = parse_function(m_node, m_weights, m_release_layers);
     } else {
         OPENVINO_THROW("Error: not recognized adapter name: ", name, ".");
     }
@@ -436,7 +467,8 @@ void ov::XmlDeserializer::on_adapter(const std::string& name, ov::ValueAccessor<
 }
 
 std::shared_ptr<ov::Model> ov::XmlDeserializer::parse_function(const pugi::xml_node& root,
-                                                               const std::shared_ptr<ov::AlignedBuffer>& weights) {
+                                                               const std::shared_ptr<ov::AlignedBuffer>& weights,
+                                                               bool release_layers) {
     // OV_ITT_SCOPE_CHAIN(FIRST_INFERENCE, taskChain, itt::domains::V10Reader_RT, "V10Parser", "Parse");
 
     struct FunctionNodes {
@@ -462,9 +494,15 @@ std::shared_ptr<ov::Model> ov::XmlDeserializer::parse_function(const pugi::xml_n
     std::set<size_t> dfs_used_nodes;
     std::map<size_t /*to-layer-id*/, std::vector<Edge>> edges;
     // Read all layers and store their parameters in params map
-    FOREACH_CHILD (node, root.child("layers"), "layer") {
-        auto node_param = parse_generic_params(node);
-        params[node_param.layerId] = {node, node_param};
+    std::vector<pugi::xml_node> layer_nodes;
+    FOREACH_CHILD (node, root.child("layers"), "layer") { layer_nodes.push_back(node); }
+    std::vector<GenericLayerParams> layer_params(layer_nodes.size());
+    parallel_for_layers(layer_nodes.size(), [&](size_t idx) {
+        layer_params[idx] = parse_generic_params(layer_nodes[idx]);
+    });
+    for (size_t idx = 0; idx < layer_nodes.size(); idx++) {
+        const auto& node_param = layer_params[idx];
+        params[node_param.layerId] = {layer_nodes[idx], node_param};
         if (node_param.type == "Result" || node_param.type == "Assign") {
             outputs.push_back(node_param.layerId);
         }
@@ -485,6 +523,10 @@ std::shared_ptr<ov::Model> ov::XmlDeserializer::parse_function(const pugi::xml_n
         size_t toPort = static_cast<size_t>(pugixml::get_uint64_attr(_ec, "to-port"));
         edges[toLayer].push_back({fromLayer, fromPort, toPort});
     }
+    // the xml handles are copied, since the nodes can't be removed through the const ones
+    pugi::xml_node root_node = root;
+    if (release_layers)
+        root_node.remove_child("edges");
 
     // Run DFS starting from outputs to get nodes topological order
     std::function<void(size_t)> dfs = [&edges, &order, &dfs_used_nodes, &dfs](const size_t id) {
@@ -502,6 +544,40 @@ std::shared_ptr<ov::Model> ov::XmlDeserializer::parse_function(const pugi::xml_n
     std::map<size_t, std::shared_ptr<ov::Node>> id_to_node;
     std::map<std::string, std::shared_ptr<ov::Node>> variable_id_to_read_value;
 
+    auto layers = root.child("layers");
+    auto release_layer = [&](NodeParams& p) {
+        if (release_layers) {
+            layers.remove_child(p.xml);
+            p.xml = {};
+        }
+    };
+
+    // Constants have no inputs and don't modify the deserializer state, so they are created in parallel in advance.
+    // The other operations are connected to their producers and validated in the topological order below.
+    const bool constant_extension =
+        std::any_of(m_extensions.begin(),
+                    m_extensions.end(),
+                    [](const std::pair<const ov::DiscreteTypeInfo, ov::BaseOpExtension::Ptr>& extension) {
+                        return std::string(extension.first.name) == "Constant";
+                    });
+    if (!constant_extension) {
+        std::vector<size_t> constant_ids;
+        for (const auto& layer_id : order) {
+            const auto& p = params[layer_id].params;
+            if (p.type == "Const" && p.inputPorts.empty())
+                constant_ids.push_back(layer_id);
+        }
+        std::vector<std::shared_ptr<ov::Node>> constants(constant_ids.size());
+        parallel_for_layers(constant_ids.size(), [&](size_t idx) {
+            const auto& p = params.at(constant_ids[idx]);
+            constants[idx] = create_node({}, p.xml, weights, p.params);
+        });
+        for (size_t idx = 0; idx < constant_ids.size(); idx++) {
+            id_to_node[constant_ids[idx]] = std::move(constants[idx]);
+            release_layer(params[constant_ids[idx]]);
+        }
+    }
+
     //  Following topological order create OpenVINO operations
     for (auto& layer_id : order) {
         auto& p = params[layer_id];
@@ -526,8 +602,11 @@ std::shared_ptr<ov::Model> ov::XmlDeserializer::parse_function(const pugi::xml_n
             inputs[realInputPortId] = input_node->output(p_output.get_real_output_port_id(e.fromPortId));
         }
 
-        auto node = create_node(inputs, p.xml, weights, p.params);
-        id_to_node[layer_id] = node;
+        auto& node = id_to_node[layer_id];
+        if (!node) {
+            node = create_node(inputs, p.xml, weights, p.params);
+            release_layer(p);
+        }
 
         if (const auto& parameter_node = std::dynamic_pointer_cast<ov::op::v0::Parameter>(node)) {
             io_map.inputs.insert({layer_id, func_nodes.parameters.size()});
@@ -560,6 +639,10 @@ std::shared_ptr<ov::Model> ov::XmlDeserializer::parse_function(const pugi::xml_n
         func_nodes.all.emplace_back(node);
     }
 
+    // the layers, which are not reachable from the outputs
+    if (release_layers)
+        root_node.remove_child(layers);
+
     auto function = std::make_shared<ov::Model>(func_nodes.results,
                                                 func_nodes.sinks,
                                                 func_nodes.parameters,
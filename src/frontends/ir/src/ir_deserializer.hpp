@@ -63,13 +63,15 @@ public:
                              const std::unordered_map<std::string, ov::OpSet>& opsets,
                              const std::unordered_map<ov::DiscreteTypeInfo, ov::BaseOpExtension::Ptr>& extensions,
                              std::unordered_map<std::string, std::shared_ptr<ov::op::util::Variable>>& variables,
-                             size_t version)
+                             size_t version,
+                             bool release_layers = false)
         : m_node(node),
           m_weights(weights),
           m_opsets(opsets),
           m_extensions(extensions),
           m_variables(variables),
-          m_version(version) {}
+          m_version(version),
+          m_release_layers(release_layers) {}
 
     void on_adapter(const std::string& name, ov::ValueAccessor<std::string>& value) override {
         std::string val;
@@ -165,9 +167,12 @@ private:
     /// \brief Traverses xml node representation in order to create ov function for it.
     /// \param node xml node representation
     /// \param weights weights attached to current node
+    /// \param release_layers removes the xml representation of the layers from the document as soon as the
+    /// operations are created, so the peak memory doesn't include both the whole document and the whole model
     /// \return shared pointer to function representing input node
     std::shared_ptr<ov::Model> parse_function(const pugi::xml_node& root,
-                                              const std::shared_ptr<ov::AlignedBuffer>& weights);
+                                              const std::shared_ptr<ov::AlignedBuffer>& weights,
+                                              bool release_layers);
     /// \brief Traverses xml node representation in order to get the purpose attribute of
     /// inputs/outputs in the body of Loop op. \param node xml node representation \return struct
     /// with value of purpuse attribute
@@ -200,5 +205,8 @@ private:
     IoMap io_map;
 
     int64_t m_version;
+
+    // the top level layers are removed from the document during the model creation
+    bool m_release_layers;
 };
 }  // namespace ov
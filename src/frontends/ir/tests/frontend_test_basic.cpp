@@ -2,10 +2,13 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 
+#include <cstring>
+
 #include "frontend_test.hpp"
 #include "openvino/opsets/opset1.hpp"
 #include "openvino/opsets/opset3.hpp"
 #include "openvino/opsets/opset6.hpp"
+#include "openvino/pass/serialize.hpp"
 
 class IRFrontendTests : public ::testing::Test, public IRFrontendTestsImpl {
 protected:
@@ -1400,3 +1403,112 @@ TEST_F(IRFrontendTests, DetectionOutput) {
     ASSERT_NO_THROW(model = getWithIRFrontend(testModel));
     ASSERT_TRUE(!!model);
 }
+
+TEST_F(IRFrontendTests, model_with_many_constants_reading) {
+    // the large IRs are parsed and their constants are created in parallel
+    std::shared_ptr<ov::Model> modelRef;
+    {
+        auto parameter = std::make_shared<ov::opset1::Parameter>(ov::element::f32, ov::Shape{1, 16});
+        ov::Output<ov::Node> output = parameter;
+        for (size_t i = 0; i < 1000; i++) {
+            std::vector<float> values(16, static_cast<float>(i));
+            auto constant = ov::opset1::Constant::create(ov::element::f32, ov::Shape{1, 16}, values);
+            output = std::make_shared<ov::opset1::Add>(output, constant);
+        }
+        auto result = std::make_shared<ov::opset1::Result>(output);
+        modelRef = std::make_shared<ov::Model>(ov::NodeVector{result}, ov::ParameterVector{parameter});
+    }
+
+    std::stringstream xmlStream, binStream;
+    ov::pass::Serialize(xmlStream, binStream).run_on_model(modelRef);
+    const auto weightsContent = binStream.str();
+    ov::Tensor weights(ov::element::u8, ov::Shape{weightsContent.size()});
+    std::memcpy(weights.data(), weightsContent.data(), weightsContent.size());
+
+    std::shared_ptr<ov::Model> model;
+    ASSERT_NO_THROW(model = core.read_model(xmlStream.str(), weights));
+    ASSERT_TRUE(!!model);
+
+    const auto fc = FunctionsComparator::with_default()
+                        .enable(FunctionsComparator::ATTRIBUTES)
+                        .enable(FunctionsComparator::PRECISIONS)
+                        .enable(FunctionsComparator::NAMES)
+                        .enable(FunctionsComparator::CONST_VALUES);
+    const auto res = fc.compare(model, modelRef);
+    EXPECT_TRUE(res.valid) << res.message;
+}
+
+static const char* const release_xml_test_model = R"V0G0N(
+<net name="Network" version="11">
+    <layers>
+        <layer name="input" type="Parameter" id="0" version="opset1">
+            <data element_type="f32" shape="1,3,22,22"/>
+            <output>
+                <port id="0" precision="FP32">
+                    <dim>1</dim>
+                    <dim>3</dim>
+                    <dim>22</dim>
+                    <dim>22</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="output" type="Result" id="1" version="opset1">
+            <input>
+                <port id="0" precision="FP32">
+                    <dim>1</dim>
+                    <dim>3</dim>
+                    <dim>22</dim>
+                    <dim>22</dim>
+                </port>
+            </input>
+        </layer>
+    </layers>
+    <edges>
+        <edge from-layer="0" from-port="0" to-layer="1" to-port="0"/>
+    </edges>
+</net>
+)V0G0N";
+
+TEST_F(IRFrontendTests, input_model_can_be_converted_several_times_by_default) {
+    std::istringstream modelStringStream(release_xml_test_model);
+    std::istream& modelStream = modelStringStream;
+    ov::AnyVector params{&modelStream};
+
+    auto FE = manager.load_by_model(params);
+    ASSERT_TRUE(!!FE);
+    auto inputModel = FE->load(params);
+    ASSERT_TRUE(!!inputModel);
+
+    std::shared_ptr<ov::Model> model, other_model;
+    ASSERT_NO_THROW(model = FE->convert(inputModel));
+    ASSERT_NO_THROW(other_model = FE->convert(inputModel));
+    ASSERT_TRUE(!!model);
+    ASSERT_TRUE(!!other_model);
+    EXPECT_NE(model, other_model);
+
+    const auto fc = FunctionsComparator::with_default()
+                        .enable(FunctionsComparator::ATTRIBUTES)
+                        .enable(FunctionsComparator::PRECISIONS);
+    const auto res = fc.compare(model, other_model);
+    EXPECT_TRUE(res.valid) << res.message;
+}
+
+TEST_F(IRFrontendTests, input_model_is_released_by_conversion) {
+    std::istringstream modelStringStream(release_xml_test_model);
+    std::istream& modelStream = modelStringStream;
+    ov::AnyVector params{&modelStream, ov::AnyMap{{"IR_RELEASE_XML", true}}};
+
+    auto FE = manager.load_by_model(params);
+    ASSERT_TRUE(!!FE);
+    auto inputModel = FE->load(params);
+    ASSERT_TRUE(!!inputModel);
+
+    std::shared_ptr<ov::Model> model;
+    ASSERT_NO_THROW(model = FE->convert(inputModel));
+    ASSERT_TRUE(!!model);
+    EXPECT_EQ(model->get_parameters().size(), 1);
+    EXPECT_EQ(model->get_results().size(), 1);
+
+    // the xml document isn't kept after the conversion
+    EXPECT_THROW(FE->convert(inputModel), ov::Exception);
+}
@@ -48,6 +48,40 @@ public:
      */
     virtual void start_async();
 
+    /**
+     * @brief Receives the completion of the run started by start_async_deferred()
+     */
+    class DeferredCompletion {
+    public:
+        virtual ~DeferredCompletion() = default;
+
+        /**
+         * @brief Called instead of the callback set by set_callback() once the run is completed
+         * @param exception The exception of the run or nullptr
+         */
+        virtual void complete(const std::exception_ptr& exception) = 0;
+    };
+
+    /**
+     * @brief Starts inference of specified input(s) in asynchronous mode like start_async() does, but returns the
+     * first pipeline stage to the caller instead of running it.
+     * @note Used to submit the first stages of several requests to their executor at once. The caller is responsible
+     * to run the returned task on the returned executor. Derived classes which override start_async() should not be
+     * started this way, since the overridden logic is skipped.
+     * @param completion Notified once the run is completed instead of the callback set by set_callback(), which is
+     * kept for the next runs
+     * @return Pair of the first stage executor and the task, the task is empty if the pipeline is stopped.
+     */
+    std::pair<std::shared_ptr<ov::threading::ITaskExecutor>, ov::threading::Task> start_async_deferred(
+        std::shared_ptr<DeferredCompletion> completion);
+
+    /**
+     * @brief Completes the request started by start_async_deferred() which first stage was not run, so the request is
+     * idle again and wait() reports the @p exception. The completion passed to start_async_deferred() is not notified.
+     * @param exception The reason the first stage was not run
+     */
+    void fail_deferred_start(std::exception_ptr exception);
+
     /**
      * @brief Waits for the result to become available.
      */
@@ -71,6 +105,12 @@ public:
      */
     virtual void set_callback(std::function<void(std::exception_ptr)> callback);
 
+    /**
+     * @brief Gets the callback function set by set_callback()
+     * @return The callback function, empty if it was not set
+     */
+    std::function<void(std::exception_ptr)> get_callback() const;
+
     /**
      * @brief Infers specified input(s) in synchronous mode
      * @note blocks all method of InferRequest while request is ongoing (running or waiting in queue)
@@ -277,6 +317,8 @@ private:
         m_sync_callback_executor;  //!< Used to run post inference callback in synchronous pipline
     mutable std::mutex m_mutex;
     std::function<void(std::exception_ptr)> m_callback;
+    // replaces m_callback for the run started by start_async_deferred()
+    std::shared_ptr<DeferredCompletion> m_deferred_completion;
 };
 
 }  // namespace ov
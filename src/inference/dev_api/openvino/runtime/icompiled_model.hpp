@@ -9,6 +9,8 @@
 
 #pragma once
 
+#include <exception>
+#include <functional>
 #include <memory>
 #include <ostream>
 #include <vector>
@@ -97,6 +99,18 @@ public:
      */
     virtual std::shared_ptr<ov::IAsyncInferRequest> create_infer_request() const;
 
+    /**
+     * @brief Starts asynchronous inference of several infer requests created by this compiled model
+     * @note The callbacks of the requests are replaced for this run and restored once each request is completed, the
+     * @p callback is called once all the requests are completed.
+     * Default implementation starts the requests one by one.
+     *
+     * @param requests Infer requests to start
+     * @param callback Function called with the exception of the first failed request or nullptr
+     */
+    virtual void start_async(const std::vector<std::shared_ptr<ov::IAsyncInferRequest>>& requests,
+                             std::function<void(std::exception_ptr)> callback) const;
+
     /**
      * @brief Export compiled model to stream
      *
@@ -181,6 +195,17 @@ protected:
     void set_callback_executor(const std::shared_ptr<ov::threading::ITaskExecutor> callback_executor);
 
     static void set_model_shared_object(ov::Model& model, const std::shared_ptr<void>& shared_object);
+
+    /**
+     * @brief Implementation of start_async() for the requests which pipeline is fully handled by
+     * ov::IAsyncInferRequest. The first stages of all the requests sharing the same executor are submitted to it by a
+     * single ov::threading::ITaskExecutor::run_batch() call.
+     *
+     * @param requests Infer requests to start
+     * @param callback Function called with the exception of the first failed request or nullptr
+     */
+    static void start_async_batched(const std::vector<std::shared_ptr<ov::IAsyncInferRequest>>& requests,
+                                    std::function<void(std::exception_ptr)> callback);
 };
 
 }  // namespace ov
@@ -76,5 +76,13 @@ static constexpr Property<bool, PropertyMutability::RO> compiled_model_runtime_p
  */
 static constexpr Property<float, PropertyMutability::RW> query_model_ratio{"QUERY_MODEL_RATIO"};
 
+/**
+ * @brief Read-only property to check whether the plugin can import a compiled model from the memory mapped cache blob.
+ * In this case the cache manager passes the stream backed by ov::OwningSharedStreamBuffer to ov::IPlugin::import_model,
+ * so the plugin may keep the reference to the blob memory instead of copying the data.
+ * @ingroup ov_dev_api_plugin_api
+ */
+static constexpr Property<bool, PropertyMutability::RO> caching_with_mmap{"CACHING_WITH_MMAP"};
+
 }  // namespace internal
 }  // namespace ov
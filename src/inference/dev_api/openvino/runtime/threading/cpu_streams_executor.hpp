@@ -45,6 +45,8 @@ public:
 
     void run(Task task) override;
 
+    void run_batch(std::vector<Task> tasks) override;
+
     void execute(Task task) override;
 
     int get_stream_id() override;
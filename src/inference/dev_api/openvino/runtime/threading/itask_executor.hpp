@@ -75,6 +75,14 @@ public:
      * @param tasks A vector of tasks to execute
      */
     virtual void run_and_wait(const std::vector<Task>& tasks);
+
+    /**
+     * @brief Execute several ov::Task inside task executor context without waiting for their completion.
+     *        Default run_batch() method implementation calls run() pure virtual method for each task.
+     *        Executors with a task queue should override it to enqueue all the tasks at once.
+     * @param tasks A vector of tasks to start
+     */
+    virtual void run_batch(std::vector<Task> tasks);
 };
 
 }  // namespace threading
@@ -10,6 +10,8 @@
 
 #pragma once
 
+#include <exception>
+#include <functional>
 #include <map>
 #include <memory>
 #include <ostream>
@@ -147,6 +149,20 @@ public:
      */
     InferRequest create_infer_request();
 
+    /**
+     * @brief Starts asynchronous inference of several inference requests with a single call.
+     * Plugins may submit all the requests to the device executor at once, which reduces the scheduling overhead
+     * when many small requests are started.
+     * @note All the requests must be created by this compiled model. The callbacks set to the requests are not called
+     * for this run, @p callback is the only completion notification of the batch. They are restored once the request is
+     * completed. A request which is cancelled or can't be started is reported as failed.
+     *
+     * @param requests Inference requests to start.
+     * @param callback Function called once all the requests are completed. It takes the exception of the first failed
+     * request, or nullptr if all the requests succeeded.
+     */
+    void start_async(const std::vector<InferRequest>& requests, std::function<void(std::exception_ptr)> callback);
+
     /**
      * @brief Exports the current compiled model to an output stream `std::ostream`.
      * The exported model can also be imported via the ov::Core::import_model method.
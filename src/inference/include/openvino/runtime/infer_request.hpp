@@ -9,6 +9,8 @@
  */
 #pragma once
 
+#include <exception>
+#include <functional>
 #include <map>
 #include <memory>
 #include <string>
@@ -19,10 +21,20 @@
 #include "openvino/runtime/tensor.hpp"
 #include "openvino/runtime/variable_state.hpp"
 
+#if defined(__cpp_impl_coroutine) && defined(__has_include)
+#    if __has_include(<coroutine>)
+#        include <coroutine>
+#        define OPENVINO_RUNTIME_COROUTINES_SUPPORTED
+#    endif
+#endif
+
 namespace ov {
 
 class CompiledModel;
 class IAsyncInferRequest;
+#ifdef OPENVINO_RUNTIME_COROUTINES_SUPPORTED
+class InferRequestAwaiter;
+#endif
 
 /**
  * @brief This is a class of infer request that can be run in asynchronous or synchronous manners.
@@ -307,6 +319,33 @@ public:
      */
     void set_callback(std::function<void(std::exception_ptr)> callback);
 
+#ifdef OPENVINO_RUNTIME_COROUTINES_SUPPORTED
+    /**
+     * @brief Starts inference of specified input(s) in asynchronous mode and returns an awaitable object,
+     * so the inference can be awaited from a C++20 coroutine: `co_await request.infer_async();`
+     * The coroutine is resumed from the request completion callback on the completing thread. The inference exception
+     * (if any) is rethrown from the `co_await` expression.
+     * @note The awaiter replaces the callback set to the request and resets it to a no-op one on completion.
+     * @warning The request is idle when the coroutine is resumed, so it can be awaited again, but the completion is
+     * published to wait() only once the callback returns. Until the next suspension the coroutine must neither call
+     * wait() nor release the last reference to the request, use an executor resuming it on another thread to do so.
+     * @return Awaitable object.
+     */
+    InferRequestAwaiter infer_async();
+
+    /**
+     * @brief Starts inference of specified input(s) in asynchronous mode and returns an awaitable object which
+     * resumes the awaiting coroutine using the @p executor.
+     * @tparam Executor Type of a callable object taking `std::coroutine_handle<>`, which is responsible to resume it.
+     * It is called from the request completion callback on the completing thread, and may resume the handle inline or
+     * post it to another thread.
+     * @param executor Executor reference, the executor must outlive the awaiting.
+     * @return Awaitable object.
+     */
+    template <typename Executor>
+    InferRequestAwaiter infer_async(Executor& executor);
+#endif
+
     /**
      * @brief Gets state control interface for the given infer request.
      *
@@ -354,4 +393,90 @@ public:
     bool operator==(const InferRequest& other) const noexcept;
 };
 
+#ifdef OPENVINO_RUNTIME_COROUTINES_SUPPORTED
+/**
+ * @brief Awaitable object returned by InferRequest::infer_async().
+ * It starts the inference when the coroutine is suspended and resumes the coroutine from the request completion
+ * callback, so awaiting spawns no thread and doesn't allocate: the callback captures only the awaiter pointer.
+ * @ingroup ov_runtime_cpp_api
+ */
+class InferRequestAwaiter {
+public:
+    /**
+     * @brief Function resuming the coroutine on behalf of a user-supplied executor.
+     */
+    using Resume = void (*)(void* executor, std::coroutine_handle<> handle);
+
+    /**
+     * @brief Constructs the awaiter for the given request.
+     * @param request Infer request to start, it must outlive the awaiting.
+     * @param executor Opaque pointer passed to @p resume.
+     * @param resume Function resuming the coroutine, if nullptr the coroutine is resumed on the completing thread.
+     */
+    explicit InferRequestAwaiter(InferRequest& request, void* executor = nullptr, Resume resume = nullptr) noexcept
+        : m_request(request),
+          m_executor(executor),
+          m_resume(resume) {}
+
+    bool await_ready() const noexcept {
+        return false;
+    }
+
+    bool await_suspend(std::coroutine_handle<> handle) {
+        m_handle = handle;
+        m_request.set_callback([this](std::exception_ptr exception) {
+            complete(exception);
+        });
+        try {
+            m_request.start_async();
+        } catch (...) {
+            // the request isn't started, so the coroutine continues right away and rethrows the exception
+            m_request.set_callback(reset_callback);
+            m_exception = std::current_exception();
+            return false;
+        }
+        // the coroutine may be already resumed by the completing thread here, so the awaiter must not be accessed
+        return true;
+    }
+
+    void await_resume() const {
+        if (m_exception) {
+            std::rethrow_exception(m_exception);
+        }
+    }
+
+private:
+    static void reset_callback(std::exception_ptr) {}
+
+    void complete(std::exception_ptr exception) {
+        m_exception = exception;
+        // The request keeps the callback after the completion, so it's replaced before the awaiter is gone. The
+        // no-op one isn't replaced back by the request, unlike an empty one, and the resumed coroutine may set its own.
+        m_request.set_callback(reset_callback);
+        if (m_resume) {
+            m_resume(m_executor, m_handle);
+        } else {
+            m_handle.resume();
+        }
+    }
+
+    InferRequest& m_request;
+    void* m_executor = nullptr;
+    Resume m_resume = nullptr;
+    std::coroutine_handle<> m_handle;
+    std::exception_ptr m_exception = nullptr;
+};
+
+inline InferRequestAwaiter InferRequest::infer_async() {
+    return InferRequestAwaiter{*this};
+}
+
+template <typename Executor>
+InferRequestAwaiter InferRequest::infer_async(Executor& executor) {
+    return InferRequestAwaiter{*this, &executor, [](void* executor, std::coroutine_handle<> handle) {
+                                   (*static_cast<Executor*>(executor))(handle);
+                               }};
+}
+#endif
+
 }  // namespace ov
@@ -5,6 +5,7 @@
 #include "openvino/runtime/compiled_model.hpp"
 
 #include "openvino/core/except.hpp"
+#include "openvino/runtime/iasync_infer_request.hpp"
 #include "openvino/runtime/icompiled_model.hpp"
 #include "openvino/runtime/properties.hpp"
 
@@ -128,6 +129,21 @@ InferRequest CompiledModel::create_infer_request() {
     OV_COMPILED_MODEL_CALL_STATEMENT(return {_impl->create_infer_request(), _so});
 }
 
+void CompiledModel::start_async(const std::vector<InferRequest>& requests,
+                                std::function<void(std::exception_ptr)> callback) {
+    OV_COMPILED_MODEL_CALL_STATEMENT({
+        std::vector<std::shared_ptr<ov::IAsyncInferRequest>> impls;
+        impls.reserve(requests.size());
+        for (auto&& request : requests) {
+            OPENVINO_ASSERT(request._impl != nullptr, "InferRequest was not initialized.");
+            OPENVINO_ASSERT(request._impl->get_compiled_model().get() == _impl.get(),
+                            "InferRequest was created by another compiled model.");
+            impls.emplace_back(request._impl);
+        }
+        _impl->start_async(impls, std::move(callback));
+    });
+}
+
 void CompiledModel::export_model(std::ostream& networkModel) {
     OV_COMPILED_MODEL_CALL_STATEMENT(_impl->export_model(networkModel));
 }
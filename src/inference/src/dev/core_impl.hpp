@@ -96,10 +96,13 @@ private:
 
     struct CacheContent {
         explicit CacheContent(const std::shared_ptr<ov::ICacheManager>& cache_manager,
+                              bool mmap_enabled = false,
                               const std::string model_path = {})
             : cacheManager(cache_manager),
+              mmapEnabled(mmap_enabled),
               modelPath(model_path) {}
         std::shared_ptr<ov::ICacheManager> cacheManager;
+        bool mmapEnabled = false;
         std::string blobId = {};
         std::string modelPath = {};
     };
@@ -159,7 +162,7 @@ private:
     bool device_supports_model_caching(const ov::Plugin& plugin) const;
 
     bool device_supports_property(const ov::Plugin& plugin, const ov::PropertyName& key) const;
-    bool device_supports_internal_property(const ov::Plugin& plugin, const ov::PropertyName& key) const;
+    static bool device_supports_internal_property(const ov::Plugin& plugin, const ov::PropertyName& key);
 
     OPENVINO_DEPRECATED("Don't use this method, it will be removed soon")
     bool device_supports_cache_dir(const ov::Plugin& plugin) const;
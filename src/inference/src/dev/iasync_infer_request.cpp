@@ -97,6 +97,11 @@ void ov::IAsyncInferRequest::set_callback(std::function<void(std::exception_ptr)
     m_callback = std::move(callback);
 }
 
+std::function<void(std::exception_ptr)> ov::IAsyncInferRequest::get_callback() const {
+    std::lock_guard<std::mutex> lock{m_mutex};
+    return m_callback;
+}
+
 std::vector<ov::SoPtr<ov::IVariableState>> ov::IAsyncInferRequest::query_state() const {
     check_state();
     return m_sync_request->query_state();
@@ -145,12 +150,19 @@ ov::threading::Task ov::IAsyncInferRequest::make_next_stage_task(
                 auto lastStageTask = [this, currentException]() mutable {
                     auto promise = std::move(m_promise);
                     std::function<void(std::exception_ptr)> callback;
+                    std::shared_ptr<DeferredCompletion> deferred_completion;
                     {
                         std::lock_guard<std::mutex> lock{m_mutex};
                         m_state = InferState::IDLE;
-                        std::swap(callback, m_callback);
+                        if (m_deferred_completion) {
+                            std::swap(deferred_completion, m_deferred_completion);
+                        } else {
+                            std::swap(callback, m_callback);
+                        }
                     }
-                    if (callback) {
+                    if (deferred_completion) {
+                        deferred_completion->complete(currentException);
+                    } else if (callback) {
                         try {
                             callback(currentException);
                         } catch (...) {
@@ -184,6 +196,33 @@ void ov::IAsyncInferRequest::start_async() {
     });
 }
 
+std::pair<std::shared_ptr<ov::threading::ITaskExecutor>, ov::threading::Task>
+ov::IAsyncInferRequest::start_async_deferred(std::shared_ptr<DeferredCompletion> completion) {
+    std::pair<std::shared_ptr<ov::threading::ITaskExecutor>, ov::threading::Task> first_stage;
+    infer_impl([&] {
+        auto& first_stage_executor = std::get<Stage_e::EXECUTOR>(m_pipeline.front());
+        OPENVINO_ASSERT(nullptr != first_stage_executor);
+        first_stage = {first_stage_executor,
+                       make_next_stage_task(m_pipeline.begin(), m_pipeline.end(), m_callback_executor)};
+        // set last, so a failed start doesn't leave it installed. The request is busy, so the last stage of the
+        // previous run, which reads the member under the lock, is already done.
+        m_deferred_completion = std::move(completion);
+    });
+    return first_stage;
+}
+
+void ov::IAsyncInferRequest::fail_deferred_start(std::exception_ptr exception) {
+    auto promise = std::move(m_promise);
+    {
+        std::lock_guard<std::mutex> lock{m_mutex};
+        m_deferred_completion = {};
+        if (m_state != InferState::STOP) {
+            m_state = InferState::IDLE;
+        }
+    }
+    promise.set_exception(exception);
+}
+
 void ov::IAsyncInferRequest::check_state() const {
     std::lock_guard<std::mutex> lock{m_mutex};
     switch (m_state) {
@@ -4,12 +4,113 @@
 
 #include "openvino/runtime/icompiled_model.hpp"
 
+#include <algorithm>
+#include <atomic>
+#include <iterator>
+#include <mutex>
+
 #include "openvino/core/model.hpp"
+#include "openvino/runtime/exception.hpp"
 #include "openvino/runtime/iasync_infer_request.hpp"
 #include "openvino/runtime/iplugin.hpp"
 #include "openvino/runtime/properties.hpp"
 #include "transformations/utils/utils.hpp"
 
+namespace {
+
+// Counts the completed requests of a batch and calls the batch callback after the last one
+class BatchCompletion : public ov::IAsyncInferRequest::DeferredCompletion {
+public:
+    BatchCompletion(size_t size, std::function<void(std::exception_ptr)> callback)
+        : m_remaining{size},
+          m_callback{std::move(callback)} {}
+
+    void complete(const std::exception_ptr& exception) override {
+        if (exception) {
+            std::lock_guard<std::mutex> lock{m_mutex};
+            if (!m_exception)
+                m_exception = exception;
+        }
+        if (--m_remaining == 0 && m_callback) {
+            std::exception_ptr first_exception;
+            {
+                std::lock_guard<std::mutex> lock{m_mutex};
+                first_exception = m_exception;
+            }
+            m_callback(first_exception);
+        }
+    }
+
+private:
+    std::atomic<size_t> m_remaining;
+    std::function<void(std::exception_ptr)> m_callback;
+    std::mutex m_mutex;
+    std::exception_ptr m_exception = nullptr;
+};
+
+// Replaces the callbacks of the requests by the batch completion for a single run. The callback set by the user is
+// restored when the request is completed or fails to start.
+class BatchCallbacks {
+public:
+    BatchCallbacks(const std::vector<std::shared_ptr<ov::IAsyncInferRequest>>& requests,
+                   std::function<void(std::exception_ptr)> callback)
+        : m_requests{requests},
+          m_batch{std::make_shared<BatchCompletion>(requests.size(), std::move(callback))} {
+        m_user_callbacks.reserve(m_requests.size());
+        for (auto&& request : m_requests) {
+            auto user_callback = request->get_callback();
+            // an empty callback is not restored by the request after the completion, so the batch callback would
+            // stay installed
+            if (!user_callback)
+                user_callback = [](std::exception_ptr) {};
+            m_user_callbacks.emplace_back(std::move(user_callback));
+        }
+        // set all the callbacks in advance, so the busy requests are reported before any request is started
+        for (size_t i = 0; i < m_requests.size(); i++) {
+            try {
+                auto request = m_requests[i].get();
+                auto user_callback = m_user_callbacks[i];
+                auto batch = m_batch;
+                request->set_callback([request, user_callback, batch](std::exception_ptr exception) {
+                    request->set_callback(user_callback);
+                    batch->complete(exception);
+                });
+            } catch (...) {
+                for (size_t j = 0; j < i; j++) {
+                    restore(j);
+                }
+                throw;
+            }
+        }
+    }
+
+    // the request was not started, so its callback is never called
+    void fail(size_t i, const std::exception_ptr& exception) {
+        restore(i);
+        m_batch->complete(exception);
+    }
+
+private:
+    void restore(size_t i) {
+        m_requests[i]->set_callback(m_user_callbacks[i]);
+    }
+
+    const std::vector<std::shared_ptr<ov::IAsyncInferRequest>>& m_requests;
+    std::vector<std::function<void(std::exception_ptr)>> m_user_callbacks;
+    std::shared_ptr<BatchCompletion> m_batch;
+};
+
+std::exception_ptr make_cancelled_exception() {
+    try {
+        ov::Cancelled::create("Infer Request was canceled");
+    } catch (...) {
+        return std::current_exception();
+    }
+    return nullptr;
+}
+
+}  // namespace
+
 ov::ICompiledModel::ICompiledModel(const std::shared_ptr<const ov::Model>& model,
                                    const std::shared_ptr<const ov::IPlugin>& plugin,
                                    const std::shared_ptr<ov::threading::ITaskExecutor>& task_executor,
@@ -120,6 +221,94 @@ std::shared_ptr<ov::IAsyncInferRequest> ov::ICompiledModel::create_infer_request
     return create_async_infer_request();
 }
 
+void ov::ICompiledModel::start_async(const std::vector<std::shared_ptr<ov::IAsyncInferRequest>>& requests,
+                                     std::function<void(std::exception_ptr)> callback) const {
+    if (requests.empty()) {
+        if (callback)
+            callback(nullptr);
+        return;
+    }
+    BatchCallbacks callbacks{requests, std::move(callback)};
+    for (size_t i = 0; i < requests.size(); i++) {
+        try {
+            requests[i]->start_async();
+        } catch (...) {
+            callbacks.fail(i, std::current_exception());
+        }
+    }
+}
+
+void ov::ICompiledModel::start_async_batched(const std::vector<std::shared_ptr<ov::IAsyncInferRequest>>& requests,
+                                             std::function<void(std::exception_ptr)> callback) {
+    if (requests.empty()) {
+        if (callback)
+            callback(nullptr);
+        return;
+    }
+    // the requests report the completion to the batch directly, so their own callbacks are not touched
+    auto batch = std::make_shared<BatchCompletion>(requests.size(), std::move(callback));
+
+    // The first stages are run once: if run_batch() throws, the stages which were not taken by the executor are
+    // claimed back and their requests are failed instead of being left busy.
+    struct FirstStages {
+        explicit FirstStages(size_t size) : tasks(size), claimed(size) {}
+
+        std::vector<ov::threading::Task> tasks;
+        std::vector<std::atomic<bool>> claimed;
+    };
+    auto stages = std::make_shared<FirstStages>(requests.size());
+    struct ExecutorBatch {
+        std::shared_ptr<ov::threading::ITaskExecutor> executor;
+        std::vector<ov::threading::Task> tasks;
+        std::vector<size_t> requests;
+    };
+
+    // usually all the requests share the same executor, so linear search is cheaper than a map
+    std::vector<ExecutorBatch> batches;
+    for (size_t i = 0; i < requests.size(); i++) {
+        stages->claimed[i] = false;
+        try {
+            auto first_stage = requests[i]->start_async_deferred(batch);
+            if (!first_stage.second) {
+                // the request pipeline is stopped, so the request will never be completed
+                batch->complete(make_cancelled_exception());
+                continue;
+            }
+            auto it = std::find_if(batches.begin(), batches.end(), [&](const ExecutorBatch& item) {
+                return item.executor == first_stage.first;
+            });
+            if (it == batches.end()) {
+                batches.push_back({first_stage.first, {}, {}});
+                batches.back().tasks.reserve(requests.size());
+                batches.back().requests.reserve(requests.size());
+                it = std::prev(batches.end());
+            }
+            stages->tasks[i] = std::move(first_stage.second);
+            it->tasks.emplace_back([stages, i] {
+                if (!stages->claimed[i].exchange(true))
+                    stages->tasks[i]();
+            });
+            it->requests.push_back(i);
+        } catch (...) {
+            batch->complete(std::current_exception());
+        }
+    }
+
+    for (auto&& item : batches) {
+        try {
+            item.executor->run_batch(std::move(item.tasks));
+        } catch (...) {
+            const auto exception = std::current_exception();
+            for (auto&& request : item.requests) {
+                if (!stages->claimed[request].exchange(true)) {
+                    requests[request]->fail_deferred_start(exception);
+                    batch->complete(exception);
+                }
+            }
+        }
+    }
+}
+
 const std::shared_ptr<const ov::IPlugin>& ov::ICompiledModel::get_plugin() const {
     return m_plugin;
 }
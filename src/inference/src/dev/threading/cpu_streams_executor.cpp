@@ -389,6 +389,20 @@ struct CPUStreamsExecutor::Impl {
         _queueCondVar.notify_one();
     }
 
+    void Enqueue(std::vector<Task> tasks) {
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            for (auto&& task : tasks) {
+                _taskQueue.emplace(std::move(task));
+            }
+        }
+        if (tasks.size() > 1) {
+            _queueCondVar.notify_all();
+        } else {
+            _queueCondVar.notify_one();
+        }
+    }
+
     void Enqueue_sub(Task task, int id) {
         _subTaskThread[id]->que_push(std::move(task));
     }
@@ -524,6 +538,16 @@ void CPUStreamsExecutor::run(Task task) {
     }
 }
 
+void CPUStreamsExecutor::run_batch(std::vector<Task> tasks) {
+    if (0 == _impl->_config.get_streams()) {
+        for (auto&& task : tasks) {
+            _impl->Defer(std::move(task));
+        }
+    } else {
+        _impl->Enqueue(std::move(tasks));
+    }
+}
+
 void CPUStreamsExecutor::run_sub_stream(Task task, int id) {
     _impl->Enqueue_sub(std::move(task), id);
 }
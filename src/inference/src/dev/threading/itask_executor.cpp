@@ -37,5 +37,11 @@ void ITaskExecutor::run_and_wait(const std::vector<Task>& tasks) {
     }
 }
 
+void ITaskExecutor::run_batch(std::vector<Task> tasks) {
+    for (auto&& task : tasks) {
+        run(std::move(task));
+    }
+}
+
 }  // namespace threading
 }  // namespace ov
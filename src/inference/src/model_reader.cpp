@@ -102,6 +102,20 @@ void update_v10_model(std::shared_ptr<ov::Model>& model, bool frontendMode = fal
         model = prepost.build();
     }
 }
+bool is_ir_frontend(const ov::frontend::FrontEnd::Ptr& frontend) {
+    return frontend->get_name() == "ir";
+}
+
+// The input model is converted once, so the IR frontend may release the xml document during the conversion to lower
+// the peak memory. The option is passed to the selected frontend only, the other ones don't expect it.
+void enable_ir_xml_release(const ov::frontend::FrontEnd::Ptr& frontend, ov::AnyVector& params) {
+    if (!is_ir_frontend(frontend))
+        return;
+    // the trailing boolean flag is reserved for the mmap option
+    auto pos = !params.empty() && params.back().is<bool>() ? params.end() - 1 : params.end();
+    params.insert(pos, ov::AnyMap{{"IR_RELEASE_XML", true}});
+}
+
 }  // namespace
 
 namespace ov {
@@ -138,6 +152,7 @@ std::shared_ptr<ov::Model> read_model(const std::string& modelPath,
     FE = manager.load_by_model(params);
     if (FE) {
         FE->add_extension(extensions);
+        enable_ir_xml_release(FE, params);
         inputModel = FE->load(params);
     }
 
@@ -184,7 +199,12 @@ std::shared_ptr<ov::Model> read_model(const std::string& model,
     FE = manager.load_by_model(params);
     if (FE) {
         FE->add_extension(ov_exts);
+        enable_ir_xml_release(FE, params);
         inputModel = FE->load(params);
+        // the IR frontend has parsed the xml into its own document, so the copy held by the stream is freed before
+        // the conversion
+        if (inputModel && is_ir_frontend(FE))
+            modelStringStream.str(std::string{});
     }
     if (inputModel) {
         auto model = FE->convert(inputModel);
@@ -74,3 +74,8 @@ TEST(ExecutableNetworkOVTests, throwsOnUninitializedGetContext) {
     ov::CompiledModel exec;
     ASSERT_THROW(exec.get_context(), ov::Exception);
 }
+
+TEST(ExecutableNetworkOVTests, throwsOnUninitializedStartAsync) {
+    ov::CompiledModel exec;
+    ASSERT_THROW(exec.start_async({}, {}), ov::Exception);
+}
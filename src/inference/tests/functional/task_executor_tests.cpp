@@ -126,6 +126,28 @@ TEST_P(TaskExecutorTests, canRunMultipleTasksFromMultipleThreads) {
             thread.join();
 }
 
+TEST_P(TaskExecutorTests, canRunBatchOfTasks) {
+    auto taskExecutor = GetParam()();
+    std::atomic_int sharedVar = {0};
+    std::vector<Future> futures;
+    std::vector<Task> tasks;
+    for (int i = 0; i < MAX_NUMBER_OF_TASKS_IN_QUEUE; i++) {
+        auto p = std::make_shared<std::packaged_task<void()>>([&] {
+            ++sharedVar;
+        });
+        futures.emplace_back(p->get_future());
+        tasks.emplace_back([p] {
+            (*p)();
+        });
+    }
+    taskExecutor->run_batch(std::move(tasks));
+    for (auto&& f : futures) {
+        f.wait();
+        ASSERT_NO_THROW(f.get());
+    }
+    ASSERT_EQ(MAX_NUMBER_OF_TASKS_IN_QUEUE, sharedVar);
+}
+
 TEST_P(TaskExecutorTests, executorNotReleasedUntilTasksAreDone) {
     std::mutex mutex_block_emulation;
     std::condition_variable cv_block_emulation;
@@ -6,6 +6,7 @@
 
 #include <gtest/gtest.h>
 
+#include <algorithm>
 #include <chrono>
 #include <fstream>
 #include <string>
@@ -18,6 +19,9 @@
 #include "openvino/op/constant.hpp"
 #include "openvino/op/multiply.hpp"
 #include "openvino/op/parameter.hpp"
+#include "openvino/runtime/shared_buffer.hpp"
+#include "openvino/runtime/tensor.hpp"
+#include "openvino/util/mmap_object.hpp"
 #include "transformations/rt_info/fused_names_attribute.hpp"
 #include "transformations/rt_info/primitives_priority_attribute.hpp"
 
@@ -358,6 +362,115 @@ TEST(NetworkContext_ModelName, HashOfExistingFile) {
     ASSERT_EQ(ModelCache::compute_hash(file1, {{"key", "value"}}), ModelCache::compute_hash(file2, {{"key", "value"}}));
 }
 
+static std::shared_ptr<ov::Model> create_model_with_large_constant(size_t changed_idx) {
+    // larger than the digest block, so the digest of the constant is computed in parallel
+    const size_t size = 3 * 1024 * 1024 + 5;
+    auto data = std::make_shared<ov::op::v0::Parameter>(ov::element::u8, ov::Shape{size});
+    std::vector<uint8_t> values(size, 1);
+    if (changed_idx < size)
+        values[changed_idx] = 2;
+    auto constant = ov::op::v0::Constant::create(ov::element::u8, ov::Shape{size}, values);
+    auto add = std::make_shared<ov::op::v1::Add>(data, constant);
+    auto res = std::make_shared<ov::op::v0::Result>(add);
+    return std::make_shared<ov::Model>(ov::ResultVector{res}, ov::ParameterVector{data});
+}
+
+TEST(NetworkContext, HashWithLargeConstantData) {
+    const size_t size = 3 * 1024 * 1024 + 5;
+    auto model = create_model_with_large_constant(size);
+    const auto hash = ModelCache::compute_hash(model, {});
+    ASSERT_EQ(hash, ModelCache::compute_hash(model, {}));
+    ASSERT_EQ(hash, ModelCache::compute_hash(model->clone(), {}));
+    ASSERT_EQ(hash, ModelCache::compute_hash(create_model_with_large_constant(size), {}));
+    // every byte of the constant affects the hash
+    for (const size_t idx : {size_t{0}, size_t{1024 * 1024}, size_t{size - 1}}) {
+        ASSERT_NE(hash, ModelCache::compute_hash(create_model_with_large_constant(idx), {})) << idx;
+    }
+}
+
+TEST(NetworkContext, HashChangesWithConstantDataModifiedInPlace) {
+    const size_t size = 3 * 1024 * 1024 + 5;
+    ov::Tensor tensor(ov::element::u8, ov::Shape{size});
+    std::fill_n(tensor.data<uint8_t>(), size, uint8_t{1});
+    auto data = std::make_shared<ov::op::v0::Parameter>(ov::element::u8, ov::Shape{size});
+    // the constant shares the tensor memory
+    auto constant = std::make_shared<ov::op::v0::Constant>(tensor);
+    auto add = std::make_shared<ov::op::v1::Add>(data, constant);
+    auto res = std::make_shared<ov::op::v0::Result>(add);
+    auto model = std::make_shared<ov::Model>(ov::ResultVector{res}, ov::ParameterVector{data});
+
+    const auto hash = ModelCache::compute_hash(model, {});
+    ASSERT_EQ(hash, ModelCache::compute_hash(model, {}));
+
+    // modified through the shared tensor
+    tensor.data<uint8_t>()[size / 2] = 2;
+    const auto tensor_modified_hash = ModelCache::compute_hash(model, {});
+    ASSERT_NE(hash, tensor_modified_hash);
+
+    // modified through the constant data pointer
+    const_cast<uint8_t*>(constant->get_data_ptr<uint8_t>())[size - 1] = 3;
+    ASSERT_NE(tensor_modified_hash, ModelCache::compute_hash(model, {}));
+
+    // restored
+    tensor.data<uint8_t>()[size / 2] = 1;
+    tensor.data<uint8_t>()[size - 1] = 1;
+    ASSERT_EQ(hash, ModelCache::compute_hash(model, {}));
+}
+
+static std::shared_ptr<ov::Model> create_model_with_mapped_constant(const std::shared_ptr<ov::MappedMemory>& mapped) {
+    // the weights are shared by the Constants as the IR frontend does
+    auto weights = std::make_shared<ov::SharedBuffer<std::shared_ptr<ov::MappedMemory>>>(mapped->data(),
+                                                                                         mapped->size(),
+                                                                                         mapped);
+    auto buffer =
+        std::make_shared<ov::SharedBuffer<std::shared_ptr<ov::AlignedBuffer>>>(mapped->data(), mapped->size(), weights);
+    const auto size = mapped->size();
+    auto data = std::make_shared<ov::op::v0::Parameter>(ov::element::u8, ov::Shape{size});
+    auto constant = std::make_shared<ov::op::v0::Constant>(ov::element::u8, ov::Shape{size}, buffer);
+    auto add = std::make_shared<ov::op::v1::Add>(data, constant);
+    auto res = std::make_shared<ov::op::v0::Result>(add);
+    return std::make_shared<ov::Model>(ov::ResultVector{res}, ov::ParameterVector{data});
+}
+
+TEST(NetworkContext, HashWithMappedConstantData) {
+    const size_t size = 3 * 1024 * 1024 + 5;
+    const auto file_name = ov::test::utils::generateTestFilePrefix() + "_weights.bin";
+    FileGuard guard(file_name);
+    {
+        std::ofstream str(file_name, std::ios::binary);
+        ASSERT_TRUE(str.good());
+        for (size_t i = 0; i < size; i++)
+            str.put(static_cast<char>(i == size / 2 ? 7 : 1));
+    }
+    std::vector<uint8_t> values(size, 1);
+    values[size / 2] = 7;
+    auto in_memory = ov::op::v0::Constant::create(ov::element::u8, ov::Shape{size}, values);
+    auto data = std::make_shared<ov::op::v0::Parameter>(ov::element::u8, ov::Shape{size});
+    auto add = std::make_shared<ov::op::v1::Add>(data, in_memory);
+    auto res = std::make_shared<ov::op::v0::Result>(add);
+    const auto expected =
+        ModelCache::compute_hash(std::make_shared<ov::Model>(ov::ResultVector{res}, ov::ParameterVector{data}), {});
+
+    {
+        auto mapped = ov::load_mmap_object(file_name);
+        auto model = create_model_with_mapped_constant(mapped);
+        // the second calculation reuses the digest of the mapped data
+        ASSERT_EQ(expected, ModelCache::compute_hash(model, {}));
+        ASSERT_EQ(expected, ModelCache::compute_hash(model, {}));
+        ASSERT_EQ(expected, ModelCache::compute_hash(create_model_with_mapped_constant(mapped), {}));
+    }
+
+    // the file is modified once unmapped, the digest of the previous mapping is not reused
+    {
+        std::fstream str(file_name, std::ios::binary | std::ios::in | std::ios::out);
+        ASSERT_TRUE(str.good());
+        str.seekp(size / 2);
+        str.put(static_cast<char>(1));
+    }
+    auto mapped = ov::load_mmap_object(file_name);
+    ASSERT_NE(expected, ModelCache::compute_hash(create_model_with_mapped_constant(mapped), {}));
+}
+
 TEST(NetworkContext, HashOfSameModelWithClone) {
     auto model1 = create_simple_model();
     // test model with friendly name
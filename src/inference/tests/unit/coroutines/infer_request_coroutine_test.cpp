@@ -0,0 +1,179 @@
+// Copyright (C) 2018-2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <functional>
+#include <future>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include "openvino/core/except.hpp"
+#include "openvino/runtime/infer_request.hpp"
+#include "unit_test_utils/mocks/openvino/runtime/mock_iasync_infer_request.hpp"
+
+#ifndef OPENVINO_RUNTIME_COROUTINES_SUPPORTED
+#    error "InferRequest::infer_async() must be available in a C++20 build"
+#endif
+
+using namespace ::testing;
+namespace {
+
+struct InferRequest_Impl {
+    typedef std::shared_ptr<ov::IAsyncInferRequest> ov::InferRequest::*type;
+    friend type get(InferRequest_Impl);
+};
+
+template <typename Tag, typename Tag::type M>
+struct Rob {
+    friend typename Tag::type get(Tag) {
+        return M;
+    }
+};
+
+template struct Rob<InferRequest_Impl, &ov::InferRequest::_impl>;
+
+struct EagerCoroutine {
+    struct promise_type {
+        EagerCoroutine get_return_object() {
+            return {};
+        }
+        std::suspend_never initial_suspend() noexcept {
+            return {};
+        }
+        std::suspend_never final_suspend() noexcept {
+            return {};
+        }
+        void return_void() {}
+        void unhandled_exception() {
+            std::terminate();
+        }
+    };
+};
+
+struct AwaitResult {
+    std::promise<void> resumed;
+    std::thread::id thread;
+    bool thrown = false;
+    std::string message;
+};
+
+EagerCoroutine await_inference(ov::InferRequest& req, AwaitResult& result) {
+    try {
+        co_await req.infer_async();
+    } catch (const std::exception& ex) {
+        result.thrown = true;
+        result.message = ex.what();
+    }
+    result.thread = std::this_thread::get_id();
+    result.resumed.set_value();
+}
+
+template <typename Executor>
+EagerCoroutine await_inference(ov::InferRequest& req, Executor& executor, AwaitResult& result) {
+    co_await req.infer_async(executor);
+    result.thread = std::this_thread::get_id();
+    result.resumed.set_value();
+}
+
+// Emulates the asynchronous pipeline: start_async() returns immediately, the completion callback set to the request
+// is invoked by the test, like the last pipeline stage does
+class InferRequestCoroutineTests : public ::testing::Test {
+protected:
+    std::shared_ptr<ov::MockIAsyncInferRequest> mock_impl;
+    ov::InferRequest request;
+    std::vector<std::function<void(std::exception_ptr)>> callbacks;
+
+    void SetUp() override {
+        mock_impl.reset(new ov::MockIAsyncInferRequest());
+        request.*get(InferRequest_Impl()) = mock_impl;
+        // the awaiter is resumed from the request callback, so it neither waits for the request nor spawns a thread
+        EXPECT_CALL(*mock_impl, wait()).Times(0);
+        ON_CALL(*mock_impl, set_callback(_)).WillByDefault([this](std::function<void(std::exception_ptr)> callback) {
+            callbacks.push_back(std::move(callback));
+        });
+    }
+
+    // the request completion on another thread
+    void complete(std::exception_ptr exception = nullptr) {
+        ASSERT_FALSE(callbacks.empty());
+        auto callback = callbacks.back();
+        ASSERT_TRUE(callback);
+        std::thread([&] {
+            callback(exception);
+        }).join();
+    }
+};
+
+}  // namespace
+
+TEST(InferRequestCoroutineUninitializedTests, throwsOnUninitializedInferAsync) {
+    ov::InferRequest req;
+    AwaitResult result;
+    await_inference(req, result);
+    ASSERT_TRUE(result.thrown);
+}
+
+TEST_F(InferRequestCoroutineTests, resumesOnCompletingThread) {
+    EXPECT_CALL(*mock_impl, set_callback(_)).Times(2);
+    EXPECT_CALL(*mock_impl, start_async()).Times(1);
+    AwaitResult result;
+    auto resumed = result.resumed.get_future();
+    await_inference(request, result);
+    ASSERT_EQ(std::future_status::timeout, resumed.wait_for(std::chrono::milliseconds(0)));
+    complete();
+    ASSERT_EQ(std::future_status::ready, resumed.wait_for(std::chrono::seconds(0)));
+    ASSERT_FALSE(result.thrown);
+    ASSERT_NE(std::this_thread::get_id(), result.thread);
+    // the awaiter doesn't leave its callback to the request, the no-op one is set before the coroutine is resumed
+    ASSERT_EQ(callbacks.size(), 2u);
+    ASSERT_TRUE(callbacks.back());
+    ASSERT_NO_THROW(callbacks.back()(nullptr));
+}
+
+TEST_F(InferRequestCoroutineTests, rethrowsInferenceException) {
+    EXPECT_CALL(*mock_impl, start_async()).Times(1);
+    AwaitResult result;
+    auto resumed = result.resumed.get_future();
+    await_inference(request, result);
+    complete(std::make_exception_ptr(std::runtime_error("inference failed")));
+    ASSERT_EQ(std::future_status::ready, resumed.wait_for(std::chrono::seconds(0)));
+    ASSERT_TRUE(result.thrown);
+    ASSERT_THAT(result.message, HasSubstr("inference failed"));
+}
+
+TEST_F(InferRequestCoroutineTests, rethrowsStartException) {
+    EXPECT_CALL(*mock_impl, start_async()).WillOnce([] {
+        OPENVINO_THROW("start failed");
+    });
+    AwaitResult result;
+    auto resumed = result.resumed.get_future();
+    await_inference(request, result);
+    // the coroutine isn't suspended, since the request isn't started
+    ASSERT_EQ(std::future_status::ready, resumed.wait_for(std::chrono::seconds(0)));
+    ASSERT_TRUE(result.thrown);
+    ASSERT_THAT(result.message, HasSubstr("start failed"));
+    ASSERT_EQ(std::this_thread::get_id(), result.thread);
+    ASSERT_EQ(callbacks.size(), 2u);
+}
+
+TEST_F(InferRequestCoroutineTests, resumesThroughExecutor) {
+    EXPECT_CALL(*mock_impl, start_async()).Times(1);
+    std::coroutine_handle<> posted;
+    auto executor = [&](std::coroutine_handle<> handle) {
+        posted = handle;
+    };
+    AwaitResult result;
+    auto resumed = result.resumed.get_future();
+    await_inference(request, executor, result);
+    complete();
+    // the executor decides where the coroutine is resumed, here it is the test thread
+    ASSERT_TRUE(posted);
+    ASSERT_EQ(std::future_status::timeout, resumed.wait_for(std::chrono::milliseconds(0)));
+    posted.resume();
+    ASSERT_EQ(std::future_status::ready, resumed.wait_for(std::chrono::seconds(0)));
+    ASSERT_EQ(std::this_thread::get_id(), result.thread);
+}
@@ -4,12 +4,28 @@
 
 #include "async_infer_request.h"
 
+#include "itt.h"
+
 ov::intel_cpu::AsyncInferRequest::AsyncInferRequest(
     const std::shared_ptr<IInferRequest>& request,
     const std::shared_ptr<ov::threading::ITaskExecutor>& task_executor,
-    const std::shared_ptr<ov::threading::ITaskExecutor>& callback_executor)
+    const std::shared_ptr<ov::threading::ITaskExecutor>& callback_executor,
+    const std::shared_ptr<ov::threading::ITaskExecutor>& staging_executor)
     : ov::IAsyncInferRequest(request, task_executor, callback_executor) {
-    static_cast<SyncInferRequest*>(request.get())->set_async_request(this);
+    auto sync_request = static_cast<SyncInferRequest*>(request.get());
+    sync_request->set_async_request(this);
+
+    if (staging_executor && task_executor) {
+        m_pipeline = {{staging_executor,
+                       [sync_request] {
+                           OV_ITT_SCOPED_TASK(itt::domains::intel_cpu, "AsyncInferRequest::stage_inputs");
+                           sync_request->throw_if_canceled();
+                           sync_request->stage_inputs();
+                       }},
+                      {task_executor, [sync_request] {
+                           sync_request->infer();
+                       }}};
+    }
 }
 
 ov::intel_cpu::AsyncInferRequest::~AsyncInferRequest() {
@@ -12,9 +12,14 @@ namespace intel_cpu {
 
 class AsyncInferRequest : public ov::IAsyncInferRequest {
 public:
+    /**
+     * @param staging_executor if not null, the pipeline gets an additional first stage which prepares the request
+     * inputs on this executor, so the staging overlaps with the inference of the previously submitted requests
+     */
     AsyncInferRequest(const std::shared_ptr<IInferRequest>& request,
                       const std::shared_ptr<ov::threading::ITaskExecutor>& task_executor,
-                      const std::shared_ptr<ov::threading::ITaskExecutor>& callback_executor);
+                      const std::shared_ptr<ov::threading::ITaskExecutor>& callback_executor,
+                      const std::shared_ptr<ov::threading::ITaskExecutor>& staging_executor = nullptr);
     ~AsyncInferRequest();
 
     void throw_if_canceled() const;
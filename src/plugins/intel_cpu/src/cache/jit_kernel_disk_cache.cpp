@@ -0,0 +1,202 @@
+// Copyright (C) 2018-2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "jit_kernel_disk_cache.h"
+
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+#include <random>
+
+#include <oneapi/dnnl/dnnl.hpp>
+#if defined(OPENVINO_ARCH_X86_64)
+#    include <cpu/x64/cpu_isa_traits.hpp>
+#endif
+
+#include "openvino/core/except.hpp"
+#include "openvino/core/version.hpp"
+#include "openvino/util/file_util.hpp"
+
+#ifndef _WIN32
+#    include <sys/stat.h>
+#    include <unistd.h>
+#endif
+
+namespace ov {
+namespace intel_cpu {
+
+namespace {
+
+constexpr char entryMagic[8] = {'O', 'V', 'C', 'P', 'U', 'J', 'I', 'T'};
+constexpr uint32_t entryFormatVersion = 2;
+
+// FNV-1a, must be stable across the processes unlike std::hash
+uint64_t fnv1a(const uint8_t* data, size_t size, uint64_t hash = 0xcbf29ce484222325ull) {
+    for (size_t i = 0; i < size; i++) {
+        hash ^= data[i];
+        hash *= 0x100000001b3ull;
+    }
+    return hash;
+}
+
+uint64_t fnv1a(const std::string& str) {
+    return fnv1a(reinterpret_cast<const uint8_t*>(str.data()), str.size());
+}
+
+template <typename T>
+void writeValue(std::ostream& stream, const T& value) {
+    stream.write(reinterpret_cast<const char*>(&value), sizeof(value));
+}
+
+template <typename T>
+bool readValue(std::istream& stream, T& value) {
+    return static_cast<bool>(stream.read(reinterpret_cast<char*>(&value), sizeof(value)));
+}
+
+/* Entry layout:
+ * magic | format version | isa | key size | key | code size | code checksum | code */
+JitKernelDiskCache::EntryPtr readEntry(const std::string& path, const std::string& key, int isa) {
+#ifndef _WIN32
+    struct stat status;
+    if (stat(path.c_str(), &status) != 0 || !S_ISREG(status.st_mode) || status.st_uid != geteuid() ||
+        (status.st_mode & (S_IWGRP | S_IWOTH)) != 0)
+        return nullptr;
+#endif
+    std::ifstream stream(path, std::ios::binary);
+    if (!stream.is_open())
+        return nullptr;
+
+    char magic[sizeof(entryMagic)];
+    uint32_t formatVersion = 0;
+    int32_t storedIsa = 0;
+    uint64_t keySize = 0;
+    if (!stream.read(magic, sizeof(magic)) || std::memcmp(magic, entryMagic, sizeof(magic)) != 0 ||
+        !readValue(stream, formatVersion) || formatVersion != entryFormatVersion || !readValue(stream, storedIsa) ||
+        storedIsa != isa || !readValue(stream, keySize) || keySize != key.size())
+        return nullptr;
+
+    std::string storedKey(keySize, '\0');
+    // different keys may have the same hash in the file name
+    if (!stream.read(&storedKey[0], keySize) || storedKey != key)
+        return nullptr;
+
+    uint64_t codeSize = 0;
+    uint64_t checksum = 0;
+    if (!readValue(stream, codeSize) || !readValue(stream, checksum) || codeSize == 0)
+        return nullptr;
+
+    auto entry = std::make_shared<JitKernelDiskCache::Entry>();
+    entry->code.resize(codeSize);
+    entry->checksum = checksum;
+    entry->isa = isa;
+    if (!stream.read(reinterpret_cast<char*>(entry->code.data()), codeSize) ||
+        !JitKernelDiskCache::verify(*entry, isa))
+        return nullptr;
+
+    return entry;
+}
+
+}  // namespace
+
+JitKernelDiskCache::JitKernelDiskCache(std::string cacheDir) : m_cacheDir(std::move(cacheDir)) {
+    OPENVINO_ASSERT(!m_cacheDir.empty(), "The JIT kernel cache directory is not specified");
+    ov::util::create_directory_recursive(m_cacheDir);
+#ifndef _WIN32
+    // the other users must not be able to plant the code
+    chmod(m_cacheDir.c_str(), S_IRWXU);
+#endif
+}
+
+std::string JitKernelDiskCache::fullKey(const std::string& kernelName, const std::string& kernelKey) const {
+    std::ostringstream key;
+    key << ov::get_openvino_version().buildNumber << ';' << static_cast<int>(dnnl::get_effective_cpu_isa()) << ';'
+        << kernelName << ';' << kernelKey;
+    return key.str();
+}
+
+std::string JitKernelDiskCache::entryPath(const std::string& fullKey) const {
+    std::ostringstream name;
+    name << std::hex << fnv1a(fullKey) << ".bin";
+    return ov::util::path_join({m_cacheDir, name.str()});
+}
+
+bool JitKernelDiskCache::verify(const Entry& entry, int isa) {
+    if (entry.isa != isa || entry.code.empty() || fnv1a(entry.code.data(), entry.code.size()) != entry.checksum)
+        return false;
+#if defined(OPENVINO_ARCH_X86_64)
+    return dnnl::impl::cpu::x64::mayiuse(static_cast<dnnl::impl::cpu::x64::cpu_isa_t>(isa));
+#else
+    return false;
+#endif
+}
+
+JitKernelDiskCache::EntryPtr JitKernelDiskCache::load(const std::string& kernelName,
+                                                      const std::string& kernelKey,
+                                                      int isa) {
+    const auto key = fullKey(kernelName, kernelKey);
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto it = m_entries.find(key);
+    if (it == m_entries.end())
+        it = m_entries.emplace(key, readEntry(entryPath(key), key, isa)).first;
+    return it->second;
+}
+
+void JitKernelDiskCache::store(const std::string& kernelName,
+                               const std::string& kernelKey,
+                               int isa,
+                               const uint8_t* code,
+                               size_t size) {
+    if (!code || size == 0)
+        return;
+
+    const auto key = fullKey(kernelName, kernelKey);
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto& entry = m_entries[key];
+    // the entry which fails the verification is replaced by the regenerated code
+    if (entry && verify(*entry, isa))
+        return;
+    auto newEntry = std::make_shared<Entry>();
+    newEntry->code.assign(code, code + size);
+    newEntry->checksum = fnv1a(code, size);
+    newEntry->isa = isa;
+    entry = newEntry;
+
+    // the entry is written to the temporary file first, so the concurrent processes never read the incomplete one
+    const auto path = entryPath(key);
+    std::ostringstream tmpSuffix;
+    tmpSuffix << ".tmp" << std::hex << std::random_device{}();
+    const auto tmpPath = path + tmpSuffix.str();
+    {
+        std::ofstream stream(tmpPath, std::ios::binary | std::ios::trunc);
+        if (!stream.is_open())
+            return;
+        stream.write(entryMagic, sizeof(entryMagic));
+        writeValue(stream, entryFormatVersion);
+        writeValue(stream, static_cast<int32_t>(isa));
+        writeValue(stream, static_cast<uint64_t>(key.size()));
+        stream.write(key.data(), key.size());
+        writeValue(stream, static_cast<uint64_t>(size));
+        writeValue(stream, newEntry->checksum);
+        stream.write(reinterpret_cast<const char*>(code), size);
+        if (!stream.good()) {
+            stream.close();
+            std::remove(tmpPath.c_str());
+            return;
+        }
+    }
+#ifndef _WIN32
+    // the entries writable by others are not loaded
+    chmod(tmpPath.c_str(), S_IRUSR | S_IWUSR);
+#endif
+    // failing to cache the kernel is not an error, rename doesn't replace the existing file on Windows
+    if (std::rename(tmpPath.c_str(), path.c_str()) != 0) {
+        std::remove(path.c_str());
+        if (std::rename(tmpPath.c_str(), path.c_str()) != 0)
+            std::remove(tmpPath.c_str());
+    }
+}
+
+}   // namespace intel_cpu
+}   // namespace ov
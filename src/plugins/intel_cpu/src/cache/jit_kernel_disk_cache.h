@@ -0,0 +1,78 @@
+// Copyright (C) 2018-2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace ov {
+namespace intel_cpu {
+
+/**
+ * @brief On-disk cache of the generated JIT kernels machine code, enabled by ov::intel_cpu::jit_kernel_cache_dir.
+ *
+ * The instance is owned by the compiled model and shared by its streams. Each kernel is stored in a separate file of
+ * the cache directory. The entry is identified by the full kernel key, which is combined with the plugin build number
+ * and the ISA available on the machine, so the code is never reused by a different plugin version or on a different
+ * CPU. The entries are read lazily, when the kernel is requested for the first time, and validated against the stored
+ * key and the code checksum. The invalid entries are ignored and overwritten by the regenerated code. The kernel
+ * checks the entry with verify() once again right before the code is copied into its executable buffer.
+ *
+ * @attention The loaded code is executed as is: the checksum only detects the truncated or corrupted entries, it
+ * doesn't authenticate them. The directory is created accessible by the owner only and, on POSIX systems, the
+ * entries which are not owned by the current user or are writable by others are ignored, but the directory must
+ * still be trusted.
+ *
+ * @attention Only position independent code can be stored: the kernel must not embed absolute addresses (data
+ * tables, helper functions, labels addressed with the absolute immediate), since they are not valid in another
+ * process. The generic eltwise kernels are stored when all their emitters are position independent (see
+ * jit_emitter::is_position_independent()). The snippets and brgemm kernels are not: they call the oneDNN brgemm
+ * kernels and helpers by the absolute address, the brgemm code itself is generated inside oneDNN and the snippets
+ * kernel key is a hash, not the full description of the generated code.
+ *
+ * The class is thread safe.
+ */
+class JitKernelDiskCache {
+public:
+    using Ptr = std::shared_ptr<JitKernelDiskCache>;
+    struct Entry {
+        std::vector<uint8_t> code;
+        uint64_t checksum;
+        // dnnl::impl::cpu::x64::cpu_isa_t the kernel is generated for
+        int isa;
+    };
+    using EntryPtr = std::shared_ptr<const Entry>;
+
+    explicit JitKernelDiskCache(std::string cacheDir);
+
+    /**
+     * @return the entry previously stored for the kernel generated for the isa or nullptr if there is no valid entry
+     */
+    EntryPtr load(const std::string& kernelName, const std::string& kernelKey, int isa);
+
+    void store(const std::string& kernelName, const std::string& kernelKey, int isa, const uint8_t* code, size_t size);
+
+    /**
+     * @brief Checks that the code of the entry matches its checksum and that the CPU supports the ISA the code is
+     * generated for. Must be called right before the code is made executable.
+     */
+    static bool verify(const Entry& entry, int isa);
+
+private:
+    std::string fullKey(const std::string& kernelName, const std::string& kernelKey) const;
+    std::string entryPath(const std::string& fullKey) const;
+
+    mutable std::mutex m_mutex;
+    const std::string m_cacheDir;
+    // the entries already read or written by the process, nullptr for the missing ones
+    std::unordered_map<std::string, EntryPtr> m_entries;
+};
+
+}   // namespace intel_cpu
+}   // namespace ov
@@ -21,6 +21,7 @@
 
 #include "cpu/x64/cpu_isa_traits.hpp"
 #include <cstring>
+#include <sstream>
 #include <utility>
 
 #if defined(OV_CPU_WITH_ACL)
@@ -51,6 +52,9 @@ CompiledModel::CompiledModel(const std::shared_ptr<ov::Model>& model,
       m_name{model->get_name()},
       m_loaded_from_cache(loaded_from_cache) {
     m_mutex = std::make_shared<std::mutex>();
+    if (!m_cfg.jitKernelCacheDir.empty()) {
+        m_jit_kernel_cache = std::make_shared<JitKernelDiskCache>(m_cfg.jitKernelCacheDir);
+    }
     const auto& core = m_plugin->get_core();
     if (!core)
         OPENVINO_THROW("Unable to get API version. Core is unavailable");
@@ -70,6 +74,12 @@ CompiledModel::CompiledModel(const std::shared_ptr<ov::Model>& model,
         m_callback_executor = m_task_executor;
     }
 
+    if (m_cfg.asyncInputStaging) {
+        // a single helper thread is enough, since staging is a lightweight memory bound task compared to the inference
+        m_staging_executor = m_plugin->get_executor_manager()->get_idle_cpu_streams_executor(
+            IStreamsExecutor::Config{"CPUInputStagingExecutor", 1, 1, IStreamsExecutor::ThreadBindingType::NONE});
+    }
+
     if (m_task_executor)
         set_task_executor(m_task_executor);
     if (m_callback_executor)
@@ -137,7 +147,11 @@ CompiledModel::GraphGuard::Lock CompiledModel::get_graph() const {
                         (m_cfg.lpTransformsMode == Config::On) &&
                         ov::pass::low_precision::LowPrecision::isFunctionQuantized(m_model);
 
-                    ctx = std::make_shared<GraphContext>(m_cfg, weightsCache, isQuantizedFlag, streamsExecutor);
+                    ctx = std::make_shared<GraphContext>(m_cfg,
+                                                         weightsCache,
+                                                         isQuantizedFlag,
+                                                         streamsExecutor,
+                                                         m_jit_kernel_cache);
                 }
                 const std::shared_ptr<const ov::Model> model = m_model;
                 graphLock._graph.CreateGraph(model, ctx);
@@ -167,10 +181,18 @@ std::shared_ptr<ov::IAsyncInferRequest> CompiledModel::create_infer_request() co
     auto async_infer_request =
         std::make_shared<AsyncInferRequest>(std::static_pointer_cast<SyncInferRequest>(internal_request),
                                             get_task_executor(),
-                                            get_callback_executor());
+                                            get_callback_executor(),
+                                            m_staging_executor);
     return async_infer_request;
 }
 
+void CompiledModel::start_async(const std::vector<std::shared_ptr<ov::IAsyncInferRequest>>& requests,
+                                std::function<void(std::exception_ptr)> callback) const {
+    OV_ITT_SCOPED_TASK(itt::domains::intel_cpu, "CompiledModel::start_async");
+    // the CPU requests don't customize the pipeline start, so all the first stages can be enqueued at once
+    start_async_batched(requests, std::move(callback));
+}
+
 std::shared_ptr<const ov::Model> CompiledModel::get_runtime_model() const {
     if (m_graphs.empty())
         OPENVINO_THROW("No graph was found");
@@ -186,6 +208,18 @@ ov::Any CompiledModel::get_property(const std::string& name) const {
         return m_loaded_from_cache;
     }
 
+    if (name == ov::intel_cpu::execution_trace) {
+        return decltype(ov::intel_cpu::execution_trace)::value_type(get_execution_trace());
+    }
+
+    if (name == ov::intel_cpu::hw_perf_counters_report) {
+        return decltype(ov::intel_cpu::hw_perf_counters_report)::value_type(get_hw_perf_counters());
+    }
+
+    if (name == ov::intel_cpu::compile_profile) {
+        return decltype(ov::intel_cpu::compile_profile)::value_type(m_compile_profile);
+    }
+
     Config engConfig = get_graph()._graph.getConfig();
     auto option = engConfig._config.find(name);
     if (option != engConfig._config.end()) {
@@ -299,8 +333,54 @@ ov::Any CompiledModel::get_property(const std::string& name) const {
     OPENVINO_THROW("Unsupported property: ", name);
 }
 
+std::string CompiledModel::get_execution_trace() const {
+    std::stringstream trace;
+    trace << "{\"traceEvents\":[";
+    bool leadingComma = false;
+    for (auto& graph : m_graphs) {
+        // the lock guarantees that no inference is running on the graph, so its nodes and events are not modified
+        GraphGuard::Lock graphLock{graph};
+        if (!graph.IsReady())
+            continue;
+        if (const auto& tracer = graph.getGraphContext()->getExecutionTracer()) {
+            tracer->dump(trace, leadingComma);
+            leadingComma = true;
+        }
+    }
+    trace << "],\"displayTimeUnit\":\"ns\"}";
+    return trace.str();
+}
+
+std::map<std::string, std::map<std::string, uint64_t>> CompiledModel::get_hw_perf_counters() const {
+    std::map<std::string, HwPerfCount> counts;
+    for (auto& graph : m_graphs) {
+        // the lock guarantees that no inference is running on the graph, so the node counters are not modified
+        GraphGuard::Lock graphLock{graph};
+        if (!graph.IsReady() || !graph.getGraphContext()->getHwPerfCounters())
+            continue;
+        graph.GetHwPerfData(counts);
+    }
+    std::map<std::string, std::map<std::string, uint64_t>> report;
+    for (const auto& count : counts) {
+        report.emplace(count.first, count.second.avg());
+    }
+    return report;
+}
+
 void CompiledModel::export_model(std::ostream& modelStream) const {
-    ModelSerializer serializer(modelStream);
+    DescriptorHints hints;
+    if (m_cfg.cacheGraphDescriptors) {
+        auto graphLock = get_graph();
+        for (const auto& node : graphLock._graph.GetNodes()) {
+            const auto* selected = node->getSelectedPrimitiveDescriptor();
+            if (!selected || selected->getDescriptorIndex() < 0)
+                continue;
+            hints[node->getName()] = std::to_string(selected->getDescriptorIndex()) + ":" +
+                                     std::to_string(static_cast<int64_t>(selected->getImplementationType()));
+        }
+    }
+
+    ModelSerializer serializer(modelStream, std::move(hints));
     serializer << m_model;
 }
 
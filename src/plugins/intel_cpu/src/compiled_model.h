@@ -4,6 +4,7 @@
 
 #pragma once
 
+#include <map>
 #include <string>
 #include <vector>
 
@@ -29,12 +30,20 @@ public:
 
     std::shared_ptr<ov::IAsyncInferRequest> create_infer_request() const override;
 
+    void start_async(const std::vector<std::shared_ptr<ov::IAsyncInferRequest>>& requests,
+                     std::function<void(std::exception_ptr)> callback) const override;
+
     void export_model(std::ostream& model) const override;
 
     std::shared_ptr<const ov::Model> get_runtime_model() const override;
 
     ov::Any get_property(const std::string& name) const override;
 
+    // stores the profile of the transformation passes reported by ov::intel_cpu::compile_profile
+    void set_compile_profile(std::string profile) {
+        m_compile_profile = std::move(profile);
+    }
+
     void set_property(const ov::AnyMap& properties) override {
         OPENVINO_THROW_NOT_IMPLEMENTED("It's not possible to set property of an already compiled model. "
                                        "Set property to Core::compile_model during compilation");
@@ -48,6 +57,7 @@ private:
     const std::shared_ptr<const ov::IPlugin> m_plugin;
     std::shared_ptr<ov::threading::ITaskExecutor> m_task_executor = nullptr;      //!< Holds a task executor
     std::shared_ptr<ov::threading::ITaskExecutor> m_callback_executor = nullptr;  //!< Holds a callback executor
+    std::shared_ptr<ov::threading::ITaskExecutor> m_staging_executor = nullptr;   //!< Holds an input staging executor
 
     // Generic synchronization primitive on CompiledModel level.
     // Usage example: helps to avoid data races during CPU Graph initialization in multi-streams scenario
@@ -67,12 +77,22 @@ private:
     // WARNING: Do not use m_graphs directly.
     mutable std::deque<GraphGuard> m_graphs;
     mutable SocketsWeights m_socketWeights;
+    // nullptr unless ov::intel_cpu::jit_kernel_cache_dir is set
+    JitKernelDiskCache::Ptr m_jit_kernel_cache;
 
     /* WARNING: Use get_graph() function to get access to graph in current stream.
      * NOTE: Main thread is interpreted as master thread of external stream so use this function to get access to graphs
      *       even from main thread
      */
     GraphGuard::Lock get_graph() const;
+
+    // merges the execution events of all the streams into a Chrome trace JSON document
+    std::string get_execution_trace() const;
+
+    // the hardware counters of the nodes averaged over all the streams
+    std::map<std::string, std::map<std::string, uint64_t>> get_hw_perf_counters() const;
+
+    std::string m_compile_profile;
 };
 
 }   // namespace intel_cpu
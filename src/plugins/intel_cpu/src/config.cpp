@@ -262,6 +262,38 @@ void Config::readProperties(const ov::AnyMap& prop, const ModelType modelType) {
                                ov::internal::exclusive_async_requests.name(),
                                ". Expected only true/false");
             }
+        } else if (key == ov::intel_cpu::async_input_staging.name()) {
+            try {
+                asyncInputStaging = val.as<bool>();
+            } catch (ov::Exception&) {
+                OPENVINO_THROW("Wrong value ",
+                               val.as<std::string>(),
+                               " for property key ",
+                               ov::intel_cpu::async_input_staging.name(),
+                               ". Expected only true/false");
+            }
+        } else if (key == ov::intel_cpu::cache_graph_descriptors.name()) {
+            try {
+                cacheGraphDescriptors = val.as<bool>();
+            } catch (ov::Exception&) {
+                OPENVINO_THROW("Wrong value ",
+                               val.as<std::string>(),
+                               " for property key ",
+                               ov::intel_cpu::cache_graph_descriptors.name(),
+                               ". Expected only true/false");
+            }
+        } else if (key == ov::intel_cpu::hw_perf_counters.name()) {
+            try {
+                collectHwPerfCounters = val.as<bool>();
+            } catch (ov::Exception&) {
+                OPENVINO_THROW("Wrong value ",
+                               val.as<std::string>(),
+                               " for property key ",
+                               ov::intel_cpu::hw_perf_counters.name(),
+                               ". Expected only true/false");
+            }
+        } else if (key == ov::intel_cpu::jit_kernel_cache_dir.name()) {
+            jitKernelCacheDir = val.as<std::string>();
         } else if (key == ov::intel_cpu::lp_transforms_mode.name()) {
             try {
                 lpTransformsMode = val.as<bool>() ? LPTransformsMode::On : LPTransformsMode::Off;
@@ -316,6 +348,21 @@ void Config::readProperties(const ov::AnyMap& prop, const ModelType modelType) {
             // any negative value will be treated
             // as zero that means disabling the cache
             rtCacheCapacity = std::max(val_i, 0);
+        } else if (ov::intel_cpu::execution_trace_capacity.name() == key) {
+            int val_i = -1;
+            try {
+                ov::Any value = val.as<std::string>();
+                val_i = value.as<int>();
+            } catch (const ov::Exception&) {
+                OPENVINO_THROW("Wrong value ",
+                               val.as<std::string>(),
+                               " for property key ",
+                               ov::intel_cpu::execution_trace_capacity.name(),
+                               ". Expected only integer numbers");
+            }
+            // any negative value will be treated
+            // as zero that means disabling the tracing
+            executionTraceCapacity = std::max(val_i, 0);
         } else if (ov::intel_cpu::denormals_optimization.name() == key) {
             try {
                 denormalsOptMode = val.as<bool>() ? DenormalsOptMode::DO_On : DenormalsOptMode::DO_Off;
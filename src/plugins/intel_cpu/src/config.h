@@ -44,9 +44,13 @@ struct Config {
     };
 
     bool collectPerfCounters = false;
+    bool collectHwPerfCounters = false;
     bool exclusiveAsyncRequests = false;
+    bool asyncInputStaging = false;
+    bool cacheGraphDescriptors = false;
     SnippetsMode snippetsMode = SnippetsMode::Enable;
     std::string dumpToDot = {};
+    std::string jitKernelCacheDir = {};
     std::string device_id = {};
     float fcSparseWeiDecompressionRate = 1.0f;
     uint64_t fcDynamicQuantizationGroupSize = 0;
@@ -57,6 +61,7 @@ struct Config {
     // TODO: Executor cache may leads to incorrect behavior on oneDNN ACL primitives
     size_t rtCacheCapacity = 0ul;
 #endif
+    size_t executionTraceCapacity = 0ul;
     ov::threading::IStreamsExecutor::Config streamExecutorConfig;
     int streams = 1;
     bool streamsChanged = false;
@@ -182,6 +182,7 @@ static const TypeToNameMap& get_type_to_name_tbl() {
         {"Bucketize", Type::Bucketize},
         {"CTCGreedyDecoder", Type::CTCGreedyDecoder},
         {"CTCGreedyDecoderSeqLen", Type::CTCGreedyDecoderSeqLen},
+        {"CTCPrefixBeamSearch", Type::CTCPrefixBeamSearch},
         {"CumSum", Type::CumSum},
         {"DetectionOutput", Type::DetectionOutput},
         {"ExperimentalDetectronDetectionOutput", Type::ExperimentalDetectronDetectionOutput},
@@ -221,6 +222,7 @@ static const TypeToNameMap& get_type_to_name_tbl() {
         {"RoPE", Type::RoPE},
         {"GatherCompressed", Type::Gather},
         {"CausalMaskPreprocess", Type::CausalMaskPreprocess},
+        {"TopKSampling", Type::TopKSampling},
     };
     return type_to_name_tbl;
 }
@@ -306,6 +308,7 @@ std::string NameFromType(const Type type) {
         CASE(Bucketize);
         CASE(CTCGreedyDecoder);
         CASE(CTCGreedyDecoderSeqLen);
+        CASE(CTCPrefixBeamSearch);
         CASE(CumSum);
         CASE(DetectionOutput);
         CASE(ExperimentalDetectronDetectionOutput);
@@ -340,6 +343,7 @@ std::string NameFromType(const Type type) {
         CASE(ScaledDotProductAttention);
         CASE(RoPE);
         CASE(CausalMaskPreprocess);
+        CASE(TopKSampling);
         CASE(Unknown);
     }
 #undef CASE
@@ -84,6 +84,7 @@ enum class Type {
     Bucketize,
     CTCGreedyDecoder,
     CTCGreedyDecoderSeqLen,
+    CTCPrefixBeamSearch,
     CumSum,
     DetectionOutput,
     ExperimentalDetectronDetectionOutput,
@@ -117,6 +118,7 @@ enum class Type {
     ScaledDotProductAttention,
     RoPE,
     CausalMaskPreprocess,
+    TopKSampling,
 };
 
 enum class Algorithm {
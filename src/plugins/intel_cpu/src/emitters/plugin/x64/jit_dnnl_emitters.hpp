@@ -22,6 +22,9 @@ public:
 
     static std::set<std::vector<element::Type>> get_supported_precisions(const std::shared_ptr<ov::Node>& node = nullptr);
 
+    // the oneDNN injector loads its table by the absolute address
+    bool is_position_independent() const override { return false; }
+
 protected:
     jit_dnnl_emitter(dnnl::impl::cpu::x64::jit_generator *host, dnnl::impl::cpu::x64::cpu_isa_t host_isa,
                        dnnl_alg_kind_t algKind, float inpAlpha, float inpBeta,
@@ -230,6 +230,8 @@ public:
 
     size_t get_inputs_num() const override;
     static std::set<std::vector<element::Type>> get_supported_precisions(const std::shared_ptr<ov::Node>& node = nullptr);
+    // powf is called by the absolute address
+    bool is_position_independent() const override { return false; }
 
 private:
     void emit_impl(const std::vector<size_t> &in_vec_idxs, const std::vector<size_t> &out_vec_idxs) const override;
@@ -458,6 +460,8 @@ public:
 
     size_t get_inputs_num() const override;
     static std::set<std::vector<element::Type>> get_supported_precisions(const std::shared_ptr<ov::Node>& node = nullptr);
+    // powf is called by the absolute address
+    bool is_position_independent() const override { return false; }
 
 
 private:
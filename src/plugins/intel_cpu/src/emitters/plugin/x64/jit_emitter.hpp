@@ -55,6 +55,13 @@ public:
      */
     static std::set<std::vector<element::Type>> get_supported_precisions(const std::shared_ptr<ov::Node>& node = nullptr);
 
+    /**
+     * @brief Returns true if the emitted code doesn't depend on its own address or on the addresses of the process,
+     * so it can be copied to another buffer or reused by another process. The emitters which embed an absolute address
+     * (a function, a kernel or a data pointer) must return false.
+     */
+    virtual bool is_position_independent() const { return true; }
+
 #ifdef SNIPPETS_DEBUG_CAPS
     const char *info() const {
         if (!info_.is_initialized())
@@ -77,7 +84,7 @@ protected:
     virtual void prepare_table();
     virtual void register_table_entries() {}
 
-    void load_table_addr() const { h->mov(p_table, *l_table.get()); }
+    void load_table_addr() const { h->lea(p_table, h->ptr[h->rip + *l_table.get()]); }
 
     // we accept only 32bit hexadecimal table values to avoid any rounding
     using table_entry_val_t = uint32_t;
@@ -18,6 +18,7 @@ public:
                               const ov::snippets::lowered::ExpressionPtr& expr);
 
     size_t get_inputs_num() const override {return 1;}
+    bool is_position_independent() const override { return false; }
     static std::set<std::vector<element::Type>> get_supported_precisions(const std::shared_ptr<ov::Node>& node = nullptr) {
         return {{element::i8}, {element::bf16}};
     }
@@ -26,6 +26,7 @@ public:
     jit_brgemm_emitter(dnnl::impl::cpu::x64::jit_generator* h, dnnl::impl::cpu::x64::cpu_isa_t isa, const ov::snippets::lowered::ExpressionPtr& expr);
 
     size_t get_inputs_num() const override { return m_with_scratch ? 3 : 2; }
+    bool is_position_independent() const override { return false; }
     static std::set<std::vector<element::Type>> get_supported_precisions(const std::shared_ptr<ov::Node>& node = nullptr);
 
     static size_t get_in_leading_dim(const VectorDims& shape, const std::vector<size_t>& layout);
@@ -18,6 +18,7 @@ public:
     jit_perf_count_chrono_start_emitter(dnnl::impl::cpu::x64::jit_generator *host, dnnl::impl::cpu::x64::cpu_isa_t host_isa,
                                         const std::shared_ptr<ov::Node>& n);
     size_t get_inputs_num() const override;
+    bool is_position_independent() const override { return false; }
 
 private:
     void emit_impl(const std::vector<size_t> &in_idxs, const std::vector<size_t> &out_idxs) const override;
@@ -31,6 +32,7 @@ public:
     jit_perf_count_chrono_end_emitter(dnnl::impl::cpu::x64::jit_generator *host, dnnl::impl::cpu::x64::cpu_isa_t host_isa,
                                       const std::shared_ptr<ov::Node>& n);
     size_t get_inputs_num() const override;
+    bool is_position_independent() const override { return false; }
 
 private:
     void emit_impl(const std::vector<size_t> &in_idxs, const std::vector<size_t> &out_idxs) const override;
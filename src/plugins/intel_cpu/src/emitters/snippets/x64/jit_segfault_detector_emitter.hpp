@@ -24,6 +24,7 @@ public:
         jit_emitter* target_emitter, bool is_load, bool is_store, std::string target_node_name);
 
     size_t get_inputs_num() const override;
+    bool is_position_independent() const override { return false; }
 
     const jit_emitter* get_target_emitter() const;
 
@@ -0,0 +1,130 @@
+// Copyright (C) 2018-2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "execution_tracer.h"
+
+#include <algorithm>
+#include <iomanip>
+
+#include "edge.h"
+#include "node.h"
+
+namespace ov {
+namespace intel_cpu {
+
+namespace {
+
+int current_thread_id() {
+    // small sequential ids are easier to read in the trace viewers than the native thread ids
+    static std::atomic<int> counter{0};
+    static thread_local int id = counter++;
+    return id;
+}
+
+double to_us(ExecutionTracer::clock::duration duration) {
+    return std::chrono::duration<double, std::micro>(duration).count();
+}
+
+void write_escaped(std::ostream& os, const std::string& str) {
+    for (const char c : str) {
+        switch (c) {
+        case '"':
+            os << "\\\"";
+            break;
+        case '\\':
+            os << "\\\\";
+            break;
+        case '\n':
+            os << "\\n";
+            break;
+        default:
+            if (static_cast<unsigned char>(c) >= 0x20)
+                os << c;
+        }
+    }
+}
+
+void write_dims(std::ostream& os, const VectorDims& dims) {
+    os << '[';
+    for (size_t i = 0; i < dims.size(); i++) {
+        if (i)
+            os << ',';
+        if (dims[i] == Shape::UNDEFINED_DIM)
+            os << '?';
+        else
+            os << dims[i];
+    }
+    os << ']';
+}
+
+}  // namespace
+
+ExecutionTracer::ExecutionTracer(size_t capacity, int streamId) : m_events(capacity), m_streamId(streamId) {}
+
+void ExecutionTracer::record(const Node* node, clock::time_point start, clock::time_point end) {
+    if (m_events.empty())
+        return;
+
+    auto& event = m_events[m_next.fetch_add(1, std::memory_order_relaxed) % m_events.size()];
+    event.node = node;
+    event.start = start;
+    event.end = end;
+    event.threadId = current_thread_id();
+    // the inner vectors keep their capacity, so the buffer stops allocating once it has been filled
+    const size_t numInputs = node ? node->getParentEdges().size() : 0;
+    event.inputDims.resize(numInputs);
+    for (size_t i = 0; i < numInputs; i++) {
+        const auto& dims = node->getParentEdgeAt(i)->getMemory().getShape().getDims();
+        event.inputDims[i].assign(dims.begin(), dims.end());
+    }
+}
+
+size_t ExecutionTracer::dump(std::ostream& os, bool leadingComma) const {
+    const uint64_t next = m_next.load(std::memory_order_relaxed);
+    const uint64_t count = std::min<uint64_t>(next, m_events.size());
+
+    const auto flags = os.flags();
+    const auto precision = os.precision();
+    // the trace timestamps are in microseconds, keep the nanosecond part
+    os << std::fixed << std::setprecision(3);
+
+    if (leadingComma)
+        os << ',';
+    os << "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":" << m_streamId << ",\"args\":{\"name\":\"CPU stream "
+       << m_streamId << "\"}}";
+
+    for (uint64_t i = next - count; i < next; i++) {
+        const auto& event = m_events[i % m_events.size()];
+        os << ",{\"name\":\"";
+        if (event.node) {
+            write_escaped(os, event.node->getName());
+            os << "\",\"cat\":\"";
+            write_escaped(os, event.node->getTypeStr());
+        } else {
+            os << "Infer\",\"cat\":\"InferRequest";
+        }
+        os << "\",\"ph\":\"X\",\"ts\":" << to_us(event.start.time_since_epoch())
+           << ",\"dur\":" << to_us(event.end - event.start)
+           << ",\"pid\":" << m_streamId << ",\"tid\":" << event.threadId << ",\"args\":{";
+        if (event.node) {
+            os << "\"impl\":\"";
+            write_escaped(os, event.node->getPrimitiveDescriptorType());
+            os << "\",\"shape\":\"";
+            for (size_t j = 0; j < event.inputDims.size(); j++) {
+                if (j)
+                    os << ',';
+                write_dims(os, event.inputDims[j]);
+            }
+            os << '"';
+        }
+        os << "}}";
+    }
+
+    os.flags(flags);
+    os.precision(precision);
+    return count;
+}
+
+}   // namespace intel_cpu
+}   // namespace ov
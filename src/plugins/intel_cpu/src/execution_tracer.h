@@ -0,0 +1,84 @@
+// Copyright (C) 2018-2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <ostream>
+#include <vector>
+
+#include "cpu_types.h"
+
+namespace ov {
+namespace intel_cpu {
+
+class Node;
+
+/**
+ * @brief Ring buffer of the node execution events of a single stream.
+ * Each event keeps the start and the end of the node execution, the executing thread, the node input shapes
+ * and refers to the node itself to resolve its name, type and implementation lazily on dump.
+ * When the buffer is full the oldest events are overwritten.
+ */
+class ExecutionTracer {
+public:
+    using Ptr = std::shared_ptr<ExecutionTracer>;
+    using clock = std::chrono::steady_clock;
+
+    ExecutionTracer(size_t capacity, int streamId);
+
+    /**
+     * @brief Records the execution of the node during the scope lifetime. Does nothing if the tracer is null.
+     * The node == nullptr stands for the whole inference request.
+     */
+    class Scope {
+    public:
+        Scope(ExecutionTracer* tracer, const Node* node) : m_tracer(tracer), m_node(node) {
+            if (m_tracer)
+                m_start = clock::now();
+        }
+
+        ~Scope() {
+            if (m_tracer)
+                m_tracer->record(m_node, m_start, clock::now());
+        }
+
+        Scope(const Scope&) = delete;
+        Scope& operator=(const Scope&) = delete;
+
+    private:
+        ExecutionTracer* m_tracer;
+        const Node* m_node;
+        clock::time_point m_start;
+    };
+
+    void record(const Node* node, clock::time_point start, clock::time_point end);
+
+    /**
+     * @brief Writes the retained events in the Chrome trace event format, oldest first. The events are comma separated
+     * and not enclosed into the array, so the output of several tracers can be merged into one "traceEvents" array.
+     * Must not be called concurrently with the inference, which owns the traced nodes.
+     * @return number of the written events
+     */
+    size_t dump(std::ostream& os, bool leadingComma) const;
+
+private:
+    struct Event {
+        const Node* node = nullptr;
+        clock::time_point start;
+        clock::time_point end;
+        int threadId = 0;
+        std::vector<VectorDims> inputDims;
+    };
+
+    std::vector<Event> m_events;
+    std::atomic<uint64_t> m_next{0};
+    int m_streamId;
+};
+
+}   // namespace intel_cpu
+}   // namespace ov
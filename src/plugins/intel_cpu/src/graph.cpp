@@ -1012,6 +1012,22 @@ void Graph::PushInputData(const std::size_t& index, const ov::SoPtr<ITensor>& in
     }
 }
 
+void Graph::PushStagedInputData(const std::size_t& index, const MemoryCPtr& input) {
+    if (!IsReady()) OPENVINO_THROW("Wrong state. Topology not ready.");
+    auto input_itr = inputNodesMap.find(index);
+    if (input_itr == inputNodesMap.end())
+        OPENVINO_THROW("Input tensor with index '", index, "' is not available in the model");
+
+    auto edgeMemory = input_itr->second->getChildEdgeAt(0)->getMemoryPtr();
+    void* inter_data_ptr = edgeMemory->getData();
+    if (input->getData() == inter_data_ptr)
+        return;
+
+    OPENVINO_ASSERT(edgeMemory->getDesc().isCompatible(input->getDesc()),
+                    "Staged memory of the input with index '", index, "' doesn't match the graph input memory");
+    cpu_parallel_memcpy(inter_data_ptr, input->getData(), input->getSize());
+}
+
 // suppose always being shared infer_request intel_cpu::Tensor to Graph if isDynamic.
 void Graph::PullOutputData(std::unordered_map<std::size_t, ov::SoPtr<ITensor>>& output) {
     if (!IsReady())
@@ -1093,10 +1109,14 @@ void Graph::PullOutputData(std::unordered_map<std::size_t, ov::SoPtr<ITensor>>&
 
 void Graph::InferStatic(SyncInferRequest* request) {
     dnnl::stream stream(getEngine());
+    auto* tracer = context->getExecutionTracer().get();
+    auto* hwCounters = context->getHwPerfCounters().get();
 
     for (const auto& node : executableGraphNodes) {
         VERBOSE(node, getConfig().debugCaps.verbose);
         PERF(node, getConfig().collectPerfCounters);
+        HW_PERF(node, hwCounters);
+        ExecutionTracer::Scope trace(tracer, node.get());
 
         if (request)
             request->throw_if_canceled();
@@ -1329,6 +1349,8 @@ void Graph::InferDynamic(SyncInferRequest* request) {
         updateNodes.reset(new UpdateNodesSeq(executableGraphNodes));
     }
     size_t inferCounter = 0;
+    auto* tracer = context->getExecutionTracer().get();
+    auto* hwCounters = context->getHwPerfCounters().get();
 
     for (auto stopIndx : syncIndsWorkSet) {
         updateNodes->run(stopIndx);
@@ -1336,6 +1358,8 @@ void Graph::InferDynamic(SyncInferRequest* request) {
             auto& node = executableGraphNodes[inferCounter];
             VERBOSE(node, getConfig().debugCaps.verbose);
             PERF(node, getConfig().collectPerfCounters);
+            HW_PERF(node, hwCounters);
+            ExecutionTracer::Scope trace(tracer, node.get());
 
             if (request)
                 request->throw_if_canceled();
@@ -1556,6 +1580,25 @@ void Graph::GetPerfData(std::vector<ov::ProfilingInfo>& perfMap) const {
     }
 }
 
+void Graph::GetHwPerfData(std::map<std::string, HwPerfCount>& counts) const {
+    std::function<void(const NodePtr&, const HwPerfCount&)> accumulate = [&](const NodePtr& node,
+                                                                              const HwPerfCount& count) {
+        counts[node->getName()] += count;
+        for (auto& fusedNode : node->fusedWith) {
+            accumulate(fusedNode, count);
+        }
+        for (auto& mergedWith : node->mergedWith) {
+            accumulate(mergedWith, count);
+        }
+    };
+
+    for (const auto& node : graphNodes) {
+        if (node->isConstant())
+            continue;
+        accumulate(node, node->HwPerfCounter());
+    }
+}
+
 void Graph::CreateEdge(const NodePtr& parent,
                        const NodePtr& child,
                        int parentPort,
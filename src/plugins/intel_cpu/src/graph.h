@@ -59,6 +59,7 @@ public:
                      std::string name);
 
     void PushInputData(const std::size_t& index, const ov::SoPtr<ITensor>& input);
+    void PushStagedInputData(const std::size_t& index, const MemoryCPtr& input);
     void PullOutputData(std::unordered_map<std::size_t, ov::SoPtr<ITensor>>& output);
 
     void Infer(SyncInferRequest* request = nullptr);
@@ -102,6 +103,8 @@ public:
     }
 
     void GetPerfData(std::vector<ov::ProfilingInfo> &perfMap) const;
+    // accumulates the hardware counters per node name, the fused and merged nodes get the counters of their host node
+    void GetHwPerfData(std::map<std::string, HwPerfCount>& counts) const;
 
     void CreateEdge(const NodePtr& parent,
                  const NodePtr& child,
@@ -5,9 +5,12 @@
 #pragma once
 
 #include "openvino/runtime/threading/cpu_streams_executor.hpp"
+#include "cache/jit_kernel_disk_cache.h"
 #include "cache/multi_cache.h"
 #include "config.h"
 #include "dnnl_scratch_pad.h"
+#include "execution_tracer.h"
+#include "hw_perf_counters.h"
 #include "weights_cache.hpp"
 
 namespace ov {
@@ -21,11 +24,13 @@ public:
     GraphContext(const Config& config,
                  WeightsSharing::Ptr w_cache,
                  bool isGraphQuantized,
-                 ov::threading::IStreamsExecutor::Ptr streamExecutor = nullptr)
+                 ov::threading::IStreamsExecutor::Ptr streamExecutor = nullptr,
+                 JitKernelDiskCache::Ptr jitKernelCache = nullptr)
         : config(config),
           weightsCache(std::move(w_cache)),
           isGraphQuantizedFlag(isGraphQuantized),
-          streamExecutor(streamExecutor) {
+          streamExecutor(streamExecutor),
+          jitKernelCache(std::move(jitKernelCache)) {
         rtParamsCache = std::make_shared<MultiCache>(config.rtCacheCapacity);
         // primitive/executors can be shared across sub-stream
         // but scratch pad cannot be shared.
@@ -39,6 +44,16 @@ public:
         for (int i = 0; i < numNumaNodes; i++) {
             rtScratchPads.push_back(std::make_shared<DnnlScratchPad>(getEngine(), i));
         }
+        if (config.executionTraceCapacity > 0) {
+            // the context is created in the stream, which the graph is created for
+            executionTracer = std::make_shared<ExecutionTracer>(config.executionTraceCapacity,
+                                                                streamExecutor ? streamExecutor->get_stream_id() : 0);
+        }
+        if (config.collectHwPerfCounters && HwPerfCounters::isSupported()) {
+            // the context is created in the stream, so its threads are attached once here
+            hwPerfCounters = std::make_shared<HwPerfCounters>();
+            hwPerfCounters->attachThreads();
+        }
     }
 
     const Config& getConfig() const {
@@ -80,6 +95,21 @@ public:
         return numNumaNodes;
     }
 
+    // nullptr if the execution tracing is disabled
+    ExecutionTracer::Ptr getExecutionTracer() const {
+        return executionTracer;
+    }
+
+    // nullptr if the hardware counters are not collected
+    HwPerfCounters::Ptr getHwPerfCounters() const {
+        return hwPerfCounters;
+    }
+
+    // nullptr if the JIT kernels are not cached on disk
+    JitKernelDiskCache::Ptr getJitKernelCache() const {
+        return jitKernelCache;
+    }
+
 private:
     Config config;  // network-level config
 
@@ -97,6 +127,12 @@ private:
     ov::threading::CPUStreamsExecutor::Ptr cpuStreamExecutor;   // cpu stream executor for current graph
 
     int numNumaNodes = 1;
+
+    ExecutionTracer::Ptr executionTracer;   // node execution events of the stream, shared with the inner graphs
+
+    HwPerfCounters::Ptr hwPerfCounters;     // hardware counters of the stream threads
+
+    JitKernelDiskCache::Ptr jitKernelCache; // on-disk kernels cache of the compiled model, shared by the streams
 };
 
 }  // namespace intel_cpu
@@ -10,6 +10,7 @@
 #include "nodes/conv.h"
 #include "nodes/deconv.h"
 #include "nodes/eltwise.h"
+#include "nodes/embedding_bag_sum.h"
 #include "nodes/fake_quantize.h"
 #include "nodes/fullyconnected.h"
 #include "nodes/input.h"
@@ -71,6 +72,10 @@ void GraphOptimizer::ApplyCommonGraphOptimizations(Graph &graph) {
     FuseFCAndWeightsDecompression(graph);
     graph.RemoveDroppedNodes();
 
+    OV_ITT_SCOPE_NEXT(FIRST_INFERENCE, taskChain, "FuseEmbeddingBagAndWeightsDecompression");
+    FuseEmbeddingBagAndWeightsDecompression(graph);
+    graph.RemoveDroppedNodes();
+
     OV_ITT_SCOPE_NEXT(FIRST_INFERENCE, taskChain, "FuseConvolutionAndBias");
     FuseConvolutionMatMulDeconvAndBias(graph);
     graph.RemoveDroppedNodes();
@@ -514,6 +519,142 @@ void GraphOptimizer::FuseFCAndWeightsDecompression(Graph &graph) {
     }
 }
 
+void GraphOptimizer::FuseEmbeddingBagAndWeightsDecompression(Graph &graph) {
+    // The embedding tables are read by the embedding bag nodes directly in the compressed form:
+    //   f16/bf16 table -> Convert -> EmbeddingBag
+    //   i8/u8 table -> Convert -> [Subtract] -> Multiply -> EmbeddingBag
+    // so the rows are decompressed on the fly instead of keeping the whole f32 table in memory
+    auto expectedNode = [](NodePtr node, Type expectedType) {
+        return node->getType() == expectedType && node->getChildEdges().size() == 1;
+    };
+
+    auto& graphNodes = graph.GetNodes();
+    for (size_t i = 0; i < graphNodes.size(); i++) {
+        const auto bagNode = graphNodes[i];
+        if (!one_of(bagNode->getType(),
+                    Type::EmbeddingBagOffsetsSum,
+                    Type::EmbeddingBagPackedSum,
+                    Type::EmbeddingSegmentsSum))
+            continue;
+        auto embeddingBagNode = std::dynamic_pointer_cast<node::EmbeddingBagSum>(bagNode);
+        if (!embeddingBagNode)
+            continue;
+
+        const auto tableParent = bagNode->getParentEdgeAt(0)->getParent();
+        if (!tableParent->isConstant())
+            continue;
+
+        if (expectedNode(tableParent, Type::Convert)) {
+            const auto tableNode = tableParent->getParentEdgeAt(0)->getParent();
+            const auto& tablePrecision = tableNode->getOriginalOutputPrecisionAtPort(0);
+            if (!expectedNode(tableNode, Type::Input) || !one_of(tablePrecision, ov::element::f16, ov::element::bf16) ||
+                !one_of(tableParent->getOriginalOutputPrecisionAtPort(0), ov::element::f32, ov::element::bf16))
+                continue;
+
+            CPU_GRAPH_OPTIMIZER_SCOPE(FuseEmbeddingBagAndWeightsDecompression);
+            bagNode->addOriginalLayer(tableParent->getOriginalLayers());
+            graph.DropNode(tableParent);
+            bagNode->setOriginalInputPrecisionAtPort(0, tablePrecision);
+            continue;
+        }
+
+        const auto multiplyNode = tableParent;
+        if (!expectedNode(multiplyNode, Type::Eltwise) || multiplyNode->getAlgorithm() != Algorithm::EltwiseMultiply)
+            continue;
+        const auto multiplyConstNode = multiplyNode->getParentEdgeAt(1)->getParent();
+        if (!expectedNode(multiplyConstNode, Type::Input))
+            continue;
+
+        const auto mulParent = multiplyNode->getParentEdgeAt(0)->getParent();
+        const bool withSubtract = mulParent->getAlgorithm() == Algorithm::EltwiseSubtract;
+        NodePtr subtractNode, subtractConvertNode, subtractConstNode;
+        if (withSubtract) {
+            subtractNode = mulParent;
+            if (!expectedNode(subtractNode, Type::Eltwise))
+                continue;
+            auto subtractParent = subtractNode->getParentEdgeAt(1)->getParent();
+            if (expectedNode(subtractParent, Type::Convert)) {
+                subtractConvertNode = subtractParent;
+                subtractParent = subtractConvertNode->getParentEdgeAt(0)->getParent();
+            }
+            subtractConstNode = subtractParent;
+            if (!expectedNode(subtractConstNode, Type::Input))
+                continue;
+        }
+
+        const auto convertNode = withSubtract ? subtractNode->getParentEdgeAt(0)->getParent() : mulParent;
+        if (!expectedNode(convertNode, Type::Convert))
+            continue;
+        const auto tableNode = convertNode->getParentEdgeAt(0)->getParent();
+        if (!expectedNode(tableNode, Type::Input))
+            continue;
+
+        // Precision limitations
+        const auto& tablePrecision = tableNode->getOriginalOutputPrecisionAtPort(0);
+        if (!one_of(tablePrecision, ov::element::i8, ov::element::u8) ||
+            multiplyNode->getOriginalOutputPrecisionAtPort(0) != ov::element::f32)
+            continue;
+
+        // Shape limitations: the per-tensor or the per-row decompression parameters
+        const auto& tableDims = tableNode->getOutputShapeAtPort(0).getDims();
+        if (tableNode->getOutputShapeAtPort(0) != multiplyNode->getOutputShapeAtPort(0))
+            continue;
+        auto isSupportedShape = [&tableDims](const Shape& shape) {
+            if (shape.getElementsCount() == 1)
+                return true;
+            const auto& dims = shape.getDims();
+            return dims.size() == tableDims.size() && dims[0] == tableDims[0] &&
+                   std::all_of(dims.begin() + 1, dims.end(), [](Dim dim) { return dim == 1; });
+        };
+        if (!isSupportedShape(multiplyConstNode->getOutputShapeAtPort(0)))
+            continue;
+        if (withSubtract && !isSupportedShape(subtractConstNode->getOutputShapeAtPort(0)))
+            continue;
+
+        // Fusion processing
+        CPU_GRAPH_OPTIMIZER_SCOPE(FuseEmbeddingBagAndWeightsDecompression);
+        auto *multiplyInputNode = dynamic_cast<node::Input *>(multiplyConstNode.get());
+        if (!multiplyInputNode) {
+            OPENVINO_THROW("Cannot cast ", multiplyConstNode->getName(), " to Input node.");
+        }
+        embeddingBagNode->fuseDecompressionMultiply(multiplyInputNode->getMemoryPtr());
+
+        if (withSubtract) {
+            auto *subtractInputNode = dynamic_cast<node::Input *>(subtractConstNode.get());
+            if (!subtractInputNode) {
+                OPENVINO_THROW("Cannot cast ", subtractConstNode->getName(), " to Input node.");
+            }
+            embeddingBagNode->fuseDecompressionSubtract(subtractInputNode->getMemoryPtr());
+        }
+
+        bagNode->addOriginalLayer(multiplyNode->getOriginalLayers());
+        bagNode->addOriginalLayer(convertNode->getOriginalLayers());
+
+        if (subtractConvertNode) {
+            bagNode->addOriginalLayer(subtractConvertNode->getOriginalLayers());
+            auto subtractConvertEdge = subtractConvertNode->getChildEdges()[0].lock();
+            graph.RemoveEdge(subtractConvertEdge);
+        }
+        if (withSubtract) {
+            bagNode->addOriginalLayer(subtractNode->getOriginalLayers());
+            auto subtractConstEdge = subtractConstNode->getChildEdges()[0].lock();
+            graph.RemoveEdge(subtractConstEdge);
+        }
+
+        auto multiplyConstEdge = multiplyConstNode->getChildEdges()[0].lock();
+        graph.RemoveEdge(multiplyConstEdge);
+
+        graph.DropNode(convertNode);
+        if (subtractConvertNode)
+            graph.DropNode(subtractConvertNode);
+        if (withSubtract)
+            graph.DropNode(subtractNode);
+        graph.DropNode(multiplyNode);
+
+        bagNode->setOriginalInputPrecisionAtPort(0, tablePrecision);
+    }
+}
+
 void GraphOptimizer::FuseConvolutionMatMulDeconvAndBias(Graph &graph) {
     auto& graphNodes = graph.GetNodes();
 
@@ -0,0 +1,179 @@
+// Copyright (C) 2018-2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "hw_perf_counters.h"
+
+#include <cstring>
+
+#include "openvino/core/parallel.hpp"
+
+#if defined(__linux__)
+#    include <linux/perf_event.h>
+#    include <sys/syscall.h>
+#    include <unistd.h>
+#endif
+
+namespace ov {
+namespace intel_cpu {
+
+namespace {
+
+// the order of the counters in the group, the first one is the group leader
+#if defined(__linux__)
+constexpr uint64_t counterConfigs[] = {PERF_COUNT_HW_CPU_CYCLES,
+                                       PERF_COUNT_HW_INSTRUCTIONS,
+                                       PERF_COUNT_HW_CACHE_MISSES};
+constexpr size_t numCounters = sizeof(counterConfigs) / sizeof(counterConfigs[0]);
+#endif
+
+constexpr uint64_t cacheLineSize = 64;
+
+int64_t current_thread_id() {
+#if defined(__linux__)
+    return static_cast<int64_t>(syscall(SYS_gettid));
+#else
+    return 0;
+#endif
+}
+
+#if defined(__linux__)
+// counts the user space events of the calling thread on any CPU
+int open_counter(uint64_t config, int groupFd) {
+    perf_event_attr attr;
+    std::memset(&attr, 0, sizeof(attr));
+    attr.type = PERF_TYPE_HARDWARE;
+    attr.size = sizeof(attr);
+    attr.config = config;
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+    attr.read_format = PERF_FORMAT_GROUP;
+    return static_cast<int>(syscall(__NR_perf_event_open, &attr, 0, -1, groupFd, 0));
+}
+
+bool open_group(std::vector<int>& fds) {
+    for (const auto config : counterConfigs) {
+        const int fd = open_counter(config, fds.empty() ? -1 : fds.front());
+        if (fd < 0) {
+            for (const auto opened : fds)
+                close(opened);
+            fds.clear();
+            return false;
+        }
+        fds.push_back(fd);
+    }
+    return true;
+}
+#endif
+
+}  // namespace
+
+HwPerfCounters::~HwPerfCounters() {
+#if defined(__linux__)
+    for (const auto& thread : m_threads) {
+        for (const auto fd : thread.fds)
+            close(fd);
+    }
+#endif
+}
+
+bool HwPerfCounters::isSupported() {
+#if defined(__linux__)
+    static const bool supported = [] {
+        std::vector<int> fds;
+        if (!open_group(fds))
+            return false;
+        for (const auto fd : fds)
+            close(fd);
+        return true;
+    }();
+    return supported;
+#else
+    return false;
+#endif
+}
+
+void HwPerfCounters::attachThreads() {
+    parallel_nt(parallel_get_max_threads(), [this](const int, const int) {
+        attachCurrentThread();
+    });
+    // the calling thread executes the nodes, which are not parallelized
+    attachCurrentThread();
+}
+
+void HwPerfCounters::attachCurrentThread() {
+    const auto threadId = current_thread_id();
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (!m_threadIds.insert(threadId).second)
+        return;
+#if defined(__linux__)
+    ThreadCounters thread;
+    if (open_group(thread.fds)) {
+        thread.leaderFd = thread.fds.front();
+        m_threads.push_back(std::move(thread));
+    }
+#endif
+}
+
+HwCounterValues HwPerfCounters::read() const {
+    HwCounterValues values;
+#if defined(__linux__)
+    // PERF_FORMAT_GROUP layout: the number of the counters followed by their values
+    uint64_t buffer[1 + numCounters];
+    std::lock_guard<std::mutex> lock(m_mutex);
+    for (const auto& thread : m_threads) {
+        if (::read(thread.leaderFd, buffer, sizeof(buffer)) != static_cast<ssize_t>(sizeof(buffer)) ||
+            buffer[0] != numCounters)
+            continue;
+        values.cycles += buffer[1];
+        values.instructions += buffer[2];
+        values.llcMisses += buffer[3];
+    }
+#endif
+    return values;
+}
+
+std::map<std::string, uint64_t> HwPerfCount::avg() const {
+    if (num == 0)
+        return {};
+
+    const auto totalNs = std::chrono::duration_cast<std::chrono::nanoseconds>(totalDuration).count();
+    // every LLC miss is approximated as a single cache line transfer, the hardware prefetches are not taken into account
+    const uint64_t bandwidth = totalNs > 0 ? total.llcMisses * cacheLineSize * 1000 / totalNs : 0;
+    return {{"cycles", total.cycles / num},
+            {"instructions", total.instructions / num},
+            {"llc_misses", total.llcMisses / num},
+            {"memory_bandwidth_mb_per_s", bandwidth}};
+}
+
+HwPerfCount& HwPerfCount::operator+=(const HwPerfCount& other) {
+    total.cycles += other.total.cycles;
+    total.instructions += other.total.instructions;
+    total.llcMisses += other.total.llcMisses;
+    totalDuration += other.totalDuration;
+    num += other.num;
+    return *this;
+}
+
+HwPerfHelper::HwPerfHelper(HwPerfCount& count, const HwPerfCounters* counters) : counter(count), counters(counters) {
+    if (!counters)
+        return;
+    startValues = counters->read();
+    startTime = std::chrono::steady_clock::now();
+}
+
+HwPerfHelper::~HwPerfHelper() {
+    if (!counters)
+        return;
+    const auto endTime = std::chrono::steady_clock::now();
+    const auto endValues = counters->read();
+    // the counters are monotonic, the difference is the node contribution
+    counter.total.cycles += endValues.cycles - startValues.cycles;
+    counter.total.instructions += endValues.instructions - startValues.instructions;
+    counter.total.llcMisses += endValues.llcMisses - startValues.llcMisses;
+    counter.totalDuration += endTime - startTime;
+    counter.num++;
+}
+
+}   // namespace intel_cpu
+}   // namespace ov
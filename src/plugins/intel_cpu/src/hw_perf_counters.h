@@ -0,0 +1,108 @@
+// Copyright (C) 2018-2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+namespace ov {
+namespace intel_cpu {
+
+struct HwCounterValues {
+    uint64_t cycles = 0;
+    uint64_t instructions = 0;
+    uint64_t llcMisses = 0;
+};
+
+/**
+ * @brief Hardware performance counters (cycles, instructions, last level cache misses) of the threads of a stream,
+ * collected with perf_event_open. Each thread opens its own group of counters, which counts all the user space events
+ * of the thread. The threads are attached once, when the graph context of the stream is created. A TBB worker may
+ * also execute the tasks of the other streams, so with several streams the values may include their work.
+ * The collection is available on Linux only and depends on the perf_event_paranoid setting.
+ */
+class HwPerfCounters {
+public:
+    using Ptr = std::shared_ptr<HwPerfCounters>;
+
+    HwPerfCounters() = default;
+    ~HwPerfCounters();
+
+    HwPerfCounters(const HwPerfCounters&) = delete;
+    HwPerfCounters& operator=(const HwPerfCounters&) = delete;
+
+    static bool isSupported();
+
+    // opens the counters for the calling thread and the threads of its parallel region (arena), must be called from
+    // the stream the counters belong to
+    void attachThreads();
+
+    // the counter values summed over the attached threads
+    HwCounterValues read() const;
+
+private:
+    void attachCurrentThread();
+
+    struct ThreadCounters {
+        int leaderFd = -1;
+        std::vector<int> fds;
+    };
+
+    mutable std::mutex m_mutex;
+    std::unordered_set<int64_t> m_threadIds;
+    std::vector<ThreadCounters> m_threads;
+};
+
+/**
+ * @brief Accumulates the hardware counters and the wall time of the node executions.
+ */
+class HwPerfCount {
+public:
+    uint32_t count() const {
+        return num;
+    }
+
+    // the counters averaged per execution and the estimated memory bandwidth
+    std::map<std::string, uint64_t> avg() const;
+
+    // merges the executions counted by another instance, e.g. of the same node in another stream
+    HwPerfCount& operator+=(const HwPerfCount& other);
+
+private:
+    HwCounterValues total;
+    std::chrono::steady_clock::duration totalDuration{0};
+    uint32_t num = 0;
+
+    friend class HwPerfHelper;
+};
+
+/**
+ * @brief Counts the node execution in the scope, does nothing if the counters are not collected.
+ */
+class HwPerfHelper {
+public:
+    HwPerfHelper(HwPerfCount& count, const HwPerfCounters* counters);
+    ~HwPerfHelper();
+
+    HwPerfHelper(const HwPerfHelper&) = delete;
+    HwPerfHelper& operator=(const HwPerfHelper&) = delete;
+
+private:
+    HwPerfCount& counter;
+    const HwPerfCounters* counters;
+    HwCounterValues startValues;
+    std::chrono::steady_clock::time_point startTime;
+};
+
+}   // namespace intel_cpu
+}   // namespace ov
+
+#define HW_PERF(_node, _counters) HwPerfHelper hwpc(_node->HwPerfCounter(), _counters);
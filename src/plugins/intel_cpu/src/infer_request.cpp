@@ -62,6 +62,7 @@ void SyncInferRequest::create_infer_request() {
 }
 
 SyncInferRequest::~SyncInferRequest() {
+    release_staged_inputs();
     --(m_compiled_model->m_numRequests);
 }
 
@@ -110,6 +111,9 @@ void SyncInferRequest::infer() {
     m_graph = &(graphLock._graph);
 
     throw_if_canceled();
+    const bool inputs_staged = m_inputs_staged;
+    m_inputs_staged = false;
+
     convert_batched_tensors();
     if (m_batched_tensors.size() > 0) {
         // batched_tensors will be updated for each infer, external_ptr should be update together
@@ -120,6 +124,13 @@ void SyncInferRequest::infer() {
         redefine_memory_for_input_nodes();
     }
 
+    // the inputs were not staged in advance (sync inference or batched tensors) or were staged for the graph of
+    // another stream, so stage them in place to keep the graph input memory pointing to the buffers owned by this
+    // request
+    if (m_graph->getConfig().asyncInputStaging && (!inputs_staged || m_staged_graph != m_graph)) {
+        update_staged_inputs();
+    }
+
     change_default_ptr();
 
     throw_if_canceled();
@@ -131,7 +142,10 @@ void SyncInferRequest::infer() {
 
     push_input_data();
 
-    m_graph->Infer(this);
+    {
+        ExecutionTracer::Scope trace(m_graph->getGraphContext()->getExecutionTracer().get(), nullptr);
+        m_graph->Infer(this);
+    }
 
     throw_if_canceled();
 
@@ -157,6 +171,57 @@ std::vector<ov::ProfilingInfo> SyncInferRequest::get_profiling_info() const {
     return perfMap;
 }
 
+static inline void change_edge_ptr(const EdgePtr& edge, const MemoryPtr& staged) {
+    auto mem = edge->getMemoryPtr();
+    OPENVINO_ASSERT(mem != nullptr, "Edge with name '", edge->name(), "' doesn't have allocated memory object.");
+    auto memMngr = mem->getMemoryMngr();
+    OPENVINO_ASSERT(memMngr);
+    memMngr->setExtBuff(staged->getData(), staged->getSize());
+}
+
+// Makes the edge use its own memory instead of the staged buffer, which is going to be released
+static inline void reset_edge_ptr(const EdgePtr& edge) {
+    auto mem = edge->getMemoryPtr();
+    OPENVINO_ASSERT(mem != nullptr, "Edge with name '", edge->name(), "' doesn't have allocated memory object.");
+    auto memMngr = mem->getMemoryMngr();
+    OPENVINO_ASSERT(memMngr);
+    const auto size = mem->getSize();
+    memMngr->setExtBuff(nullptr, 0);
+    memMngr->resize(size);
+}
+
+// Checks that the memory provided for the graph input will not be modified by the graph, so it may be referenced
+// by the input node child edges directly
+static bool input_memory_can_be_shared(const NodePtr& inputNodePtr) {
+    auto& childEdges = inputNodePtr->getChildEdges();
+    for (auto& childEdge : childEdges) {
+        auto ce = childEdge.lock();
+        if (!ce)
+            OPENVINO_THROW("Node ", inputNodePtr->getName(), " contains empty child edge");
+
+        auto& child = ce->getChild();
+
+        if (child->isConstant()) {
+            return false;
+        }
+
+        // the input memory should be referenced by the children, otherwise it should be written to a
+        // specific location
+        if (ce->inPlace(Edge::LOOK_DOWN)) {
+            return false;
+        }
+
+        if (auto result = ce->modifiedInPlace()) {
+            return false;
+        }
+
+        if (child->getType() == Type::Concatenation && child->isInPlace()) {
+            return false;
+        }
+    }
+    return true;
+}
+
 static inline void change_edge_ptr(const EdgePtr& edge, ov::SoPtr<ov::ITensor>& tensor) {
     auto mem = edge->getMemoryPtr();
     OPENVINO_ASSERT(mem != nullptr, "Edge with name '", edge->name(), "' doesn't have allocated memory object.");
@@ -195,44 +260,34 @@ void SyncInferRequest::change_default_ptr() {
         NodePtr inputNodePtr = input->second;
         if (inputNodePtr->getDstDataAtPort(0) == static_cast<void*>(it.second->data()))
             continue;
-        auto& childEdges = inputNodePtr->getChildEdges();
         // Perform checks that the user's memory will not be modified
-        bool canBeInPlace = true;
-        for (auto& childEdge : childEdges) {
-            auto ce = childEdge.lock();
-            if (!ce)
-                OPENVINO_THROW("Node ", inputNodePtr->getName(), " contains empty child edge");
-
-            auto& child = ce->getChild();
-
-            if (child->isConstant()) {
-                canBeInPlace = false;
-                break;
-            }
-
-            // the input memory should be referenced by the children, otherwise it should be written to a
-            // specific location
-            if (ce->inPlace(Edge::LOOK_DOWN)) {
-                canBeInPlace = false;
-                break;
-            }
-
-            if (auto result = ce->modifiedInPlace()) {
-                canBeInPlace = false;
-                break;
-            }
-
-            if (child->getType() == Type::Concatenation && child->isInPlace()) {
-                canBeInPlace = false;
-                break;
+        if (input_memory_can_be_shared(inputNodePtr)) {
+            for (auto& edge : inputNodePtr->getChildEdges()) {
+                auto e = edge.lock();
+                if (!e)
+                    OPENVINO_THROW("Node ", inputNodePtr->getName(), " contains empty child edge");
+                changeInpPtr(e, it.second);
             }
         }
-        if (canBeInPlace) {
-            for (auto& edge : childEdges) {
+    }
+
+    // the staged buffers are owned by the request, so they can be referenced by the graph the same way as the user's
+    // memory, otherwise they are copied as is in push_input_data()
+    for (auto& it : m_staged_inputs) {
+        if (!it.second.active)
+            continue;
+        auto input = inputNodesMap.find(it.first);
+        OPENVINO_ASSERT(inputNodesMap.end() != input, "Cannot find input tensor with index: ", it.first);
+        NodePtr inputNodePtr = input->second;
+        if (inputNodePtr->getDstDataAtPort(0) == it.second.memory->getData())
+            continue;
+        if (input_memory_can_be_shared(inputNodePtr)) {
+            m_graphs_with_staged_inputs.insert(m_graph);
+            for (auto& edge : inputNodePtr->getChildEdges()) {
                 auto e = edge.lock();
                 if (!e)
                     OPENVINO_THROW("Node ", inputNodePtr->getName(), " contains empty child edge");
-                changeInpPtr(e, it.second);
+                change_edge_ptr(e, it.second.memory);
             }
         }
     }
@@ -582,11 +637,85 @@ void SyncInferRequest::init_tensor(const std::size_t& port_index, const ov::ISyn
 
 void SyncInferRequest::push_input_data() {
     for (auto& input : m_input_ports_map) {
+        auto staged = m_staged_inputs.find(input.first);
+        if (staged != m_staged_inputs.end() && staged->second.active) {
+            m_graph->PushStagedInputData(input.first, staged->second.memory);
+            continue;
+        }
         auto tensor = get_tensor(input.second);
         m_graph->PushInputData(input.first, tensor);
     }
 }
 
+void SyncInferRequest::stage_inputs() {
+    // batched tensors are combined into the input tensors only inside infer(), so they are staged there
+    if (!m_batched_tensors.empty())
+        return;
+
+    // the staging stage runs on its own executor, concurrently with the inferences of the other requests, which may
+    // share the graph with this one
+    CompiledModel::GraphGuard::Lock lock(*static_cast<CompiledModel::GraphGuard*>(m_graph));
+    update_staged_inputs();
+    m_inputs_staged = true;
+}
+
+void SyncInferRequest::update_staged_inputs() {
+    OV_ITT_SCOPED_TASK(itt::domains::intel_cpu, "update_staged_inputs");
+    // the staged buffers are never released before the request, as they may be referenced by the graph input edges
+    auto deactivate = [this](std::size_t index) {
+        auto staged = m_staged_inputs.find(index);
+        if (staged != m_staged_inputs.end())
+            staged->second.active = false;
+    };
+
+    m_staged_graph = m_graph;
+    for (const auto& input : m_input_ports_map) {
+        const auto inputNode = m_graph->getInputNodeByIndex(input.first);
+        // the memory of the dynamic inputs is redefined on each inference, so the staging buffer can't be prepared
+        if (inputNode->isDynamicNode()) {
+            deactivate(input.first);
+            continue;
+        }
+
+        auto tensor = get_tensor(input.second);
+        if (tensor->get_element_type() == element::string) {
+            continue;
+        }
+
+        auto ext_tensor_desc = MemoryDescUtils::generateCpuBlockedMemoryDesc(tensor);
+        const auto actualDesc = inputNode->getChildEdgeAt(0)->getMemory().getDescPtr();
+        if (actualDesc->isCompatible(*ext_tensor_desc)) {
+            // the user's memory is either referenced by the graph or copied as is
+            deactivate(input.first);
+            continue;
+        }
+
+        auto& staged = m_staged_inputs[input.first];
+        if (!staged.memory) {
+            staged.memory = std::make_shared<Memory>(m_graph->getEngine(), actualDesc);
+        }
+        Memory ext_mem(m_graph->getEngine(), ext_tensor_desc, tensor->data(), false);
+        staged.memory->load(ext_mem, false);
+        staged.active = true;
+    }
+}
+
+void SyncInferRequest::release_staged_inputs() {
+    // the graphs outlive the request, so their input edges must not reference the staged buffers after it's destroyed
+    for (auto graph : m_graphs_with_staged_inputs) {
+        CompiledModel::GraphGuard::Lock lock(*static_cast<CompiledModel::GraphGuard*>(graph));
+        for (const auto& staged : m_staged_inputs) {
+            const auto inputNode = graph->getInputNodeByIndex(staged.first);
+            if (inputNode->getDstDataAtPort(0) != staged.second.memory->getData())
+                continue;
+            for (auto& edge : inputNode->getChildEdges()) {
+                if (auto e = edge.lock())
+                    reset_edge_ptr(e);
+            }
+        }
+    }
+}
+
 SyncInferRequest::OutputControlBlock::OutputControlBlock(const ov::element::Type& precision, const Shape& shape) {
     dnnl::engine eng(dnnl::engine::kind::cpu, 0);
     m_buffers[m_buffIndx] = std::make_shared<MemoryMngrWithReuse>();
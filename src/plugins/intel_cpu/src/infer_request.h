@@ -47,6 +47,13 @@ public:
 
     void throw_if_canceled() const;
 
+    /**
+     * @brief Converts the input tensors, which layout or precision doesn't match the corresponding graph input memory,
+     * into the request owned staging buffers. The staged buffers are consumed by the next infer() call.
+     * @note Only used when ov::intel_cpu::async_input_staging is enabled
+     */
+    void stage_inputs();
+
 private:
     class OutputControlBlock {
     public:
@@ -97,6 +104,8 @@ private:
     void init_tensor(const std::size_t& port_index, const ov::ISyncInferRequest::FoundPort::Type& type);
 
     void push_input_data();
+    void update_staged_inputs();
+    void release_staged_inputs();
     void redefine_memory_for_input_nodes();
     void assign_states();
     void commit_states();
@@ -111,6 +120,16 @@ private:
     Graph* m_graph = nullptr;
     std::unordered_map<std::size_t, ov::SoPtr<ov::ITensor>> m_input_external_ptr;
     std::unordered_map<std::size_t, ov::SoPtr<ov::ITensor>> m_output_external_ptr;
+    struct StagedInput {
+        MemoryPtr memory;
+        // the user's tensor is used as is if false, but the buffer is kept as the graph edges may still reference it
+        bool active = false;
+    };
+    std::unordered_map<std::size_t, StagedInput> m_staged_inputs;
+    // the graph the inputs were staged for and the graphs which input edges may reference the staged buffers
+    Graph* m_staged_graph = nullptr;
+    std::unordered_set<Graph*> m_graphs_with_staged_inputs;
+    bool m_inputs_staged = false;
 
     std::shared_ptr<const CompiledModel> m_compiled_model;
     openvino::itt::handle_t m_profiling_task;
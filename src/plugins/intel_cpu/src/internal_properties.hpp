@@ -21,6 +21,63 @@ static constexpr Property<int32_t, PropertyMutability::RW> cpu_runtime_cache_cap
  */
 static constexpr Property<bool, PropertyMutability::RW> lp_transforms_mode{"LP_TRANSFORMS_MODE"};
 
+/**
+ * @brief Adds an input staging stage to the asynchronous inference pipeline. The stage runs on a separate helper
+ * thread and converts the input tensors, which layout or precision doesn't match the graph inputs, into request owned
+ * buffers while the previously submitted request is still being inferred.
+ */
+static constexpr Property<bool, PropertyMutability::RW> async_input_staging{"ASYNC_INPUT_STAGING"};
+
+/**
+ * @brief Defines how many node execution events are kept per stream by the execution tracer. Zero (default) disables
+ * the tracing.
+ */
+static constexpr Property<int32_t, PropertyMutability::RW> execution_trace_capacity{"EXECUTION_TRACE_CAPACITY"};
+
+/**
+ * @brief Read-only property of the compiled model to get the recorded node execution events of all the streams as a
+ * Chrome trace JSON document, which can be opened in chrome://tracing or Perfetto UI.
+ */
+static constexpr Property<std::string, PropertyMutability::RO> execution_trace{"EXECUTION_TRACE"};
+
+/**
+ * @brief Read-only property of the compiled model to get the profile of the transformation passes run by
+ * compile_model as a JSON document: the wall time, the number of the visited nodes, the matcher invocations and the
+ * applied rewrites per pass.
+ * The profile is collected only if ov::enable_profiling is set, otherwise the value is empty.
+ */
+static constexpr Property<std::string, PropertyMutability::RO> compile_profile{"COMPILE_PROFILE"};
+
+/**
+ * @brief Collects the hardware performance counters (cycles, instructions, LLC misses and the estimated memory
+ * bandwidth) per node, see hw_perf_counters_report. Linux only, requires access to perf_event_open.
+ */
+static constexpr Property<bool, PropertyMutability::RW> hw_perf_counters{"HW_PERF_COUNTERS"};
+
+/**
+ * @brief Read-only property of the compiled model to get the hardware performance counters collected with
+ * hw_perf_counters, averaged per execution over all the streams: node name -> counter name -> value.
+ * A node fused into another one reports the counters of the node executing it, so such values must not be summed up.
+ * Empty if the counters are not collected.
+ */
+static constexpr Property<std::map<std::string, std::map<std::string, uint64_t>>, PropertyMutability::RO>
+    hw_perf_counters_report{"HW_PERF_COUNTERS_REPORT"};
+
+/**
+ * @brief Stores the oneDNN descriptors and implementations selected for the compiled graph nodes into the exported
+ * model, so the graph created from the imported model doesn't enumerate and compare all the available primitive
+ * descriptors again.
+ */
+static constexpr Property<bool, PropertyMutability::RW> cache_graph_descriptors{"CACHE_GRAPH_DESCRIPTORS"};
+
+/**
+ * @brief Directory to store the machine code of the position independent JIT kernels in and to load it from when the
+ * same kernel is compiled again, by this or another process. Empty (default) disables the cache.
+ * The loaded code is executed without any authentication, so the directory must be writable by trusted users only.
+ * It is independent of ov::cache_dir and is used by the compiled model it is passed to only.
+ */
+static constexpr Property<std::string, PropertyMutability::RW> jit_kernel_cache_dir{"JIT_KERNEL_CACHE_DIR"};
+
 /**
  * @brief Enum to define possible snippets mode hints.
  */
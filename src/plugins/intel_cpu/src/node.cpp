@@ -12,6 +12,7 @@
 #include <vector>
 #include <string>
 #include <cstdint>
+#include <sstream>
 #include <unordered_map>
 
 #include "nodes/conv.h"
@@ -114,6 +115,18 @@ Node::Node(const std::shared_ptr<ov::Node>& op,
         parallelDomain = getRTInfoValue(rtInfo, "parallelDomain");
     }
 
+    // "<descriptor index>:<implementation type>" restored from the model cache
+    if (rtInfo.count("cpuDescriptorHint")) {
+        std::istringstream stream(getRTInfoValue(rtInfo, "cpuDescriptorHint"));
+        int64_t implType = 0;
+        char delimiter = 0;
+        if (stream >> descriptorHintIndex >> delimiter >> implType && delimiter == ':') {
+            descriptorHintImplType = static_cast<impl_desc_type>(implType);
+        } else {
+            descriptorHintIndex = -1;
+        }
+    }
+
     if (originalLayers.empty()) {
         addOriginalLayer(name);
     }
@@ -629,7 +642,7 @@ void Node::initSupportedPrimitiveDescriptors() {
     if (!supportedPrimitiveDescriptors.empty())
         return;
 
-    auto addSupportedPrimitiveDescriptor = [&](const dnnl::primitive_desc& prim_desc) {
+    auto addSupportedPrimitiveDescriptor = [&](const dnnl::primitive_desc& prim_desc, size_t descIdx) {
         std::vector<PortConfig> inConfs, outConfs;
         const int inPlaceOutPort = canBeInPlace() ? 0 : -1;
 
@@ -649,8 +662,12 @@ void Node::initSupportedPrimitiveDescriptors() {
         const impl_desc_type impl_type = parse_impl_name(prim_desc.impl_info_str());
 
         supportedPrimitiveDescriptors.emplace_back(config, impl_type);
+        supportedPrimitiveDescriptors.back().setDescriptorIndex(static_cast<int>(descIdx));
     };
 
+    if (addHintedPrimitiveDescriptor(addSupportedPrimitiveDescriptor))
+        return;
+
     /* When custom implementation priorities are NOT defined it is enough to
     * just use the first implementation from the priority list.
     * When custom implementation priorities are defined, all the implementations should be considered,
@@ -658,7 +675,8 @@ void Node::initSupportedPrimitiveDescriptors() {
     * To achive the fallback, it is necessary to create a supported primitive descriptor for each implementation
     * since oneDNN primitive is mutating while iterating */
 
-    for (auto& desc : descs) {
+    for (size_t descIdx = 0; descIdx < descs.size(); descIdx++) {
+        auto& desc = descs[descIdx];
         auto first_desc = dnnl::primitive_desc(DnnlExtensionUtils::clone_primitive_desc(desc.get()));
         const bool first_match = customImplPriorities.empty();
         DnnlExtensionUtils::for_each_implementation(desc,
@@ -667,16 +685,35 @@ void Node::initSupportedPrimitiveDescriptors() {
                                                         return contains(getImplPriority(), implType);
                                                     },
                                                     [&](dnnl::primitive_desc& desc) {
-                                                        addSupportedPrimitiveDescriptor(desc);
+                                                        addSupportedPrimitiveDescriptor(desc, descIdx);
                                                     });
 
         // fallback. if none of the primitive types is present in the priority list just add first implementation
         // @todo this fallback is not necessary if primitive priority list is filled correctly
         if (supportedPrimitiveDescriptors.empty())
-            addSupportedPrimitiveDescriptor(first_desc);
+            addSupportedPrimitiveDescriptor(first_desc, descIdx);
     }
 }
 
+bool Node::addHintedPrimitiveDescriptor(const std::function<void(dnnl::primitive_desc&, size_t)>& add) {
+    if (descriptorHintIndex < 0 || static_cast<size_t>(descriptorHintIndex) >= descs.size())
+        return false;
+
+    const size_t descIdx = descriptorHintIndex;
+    const size_t numDescriptors = supportedPrimitiveDescriptors.size();
+    // iterate over a copy, so the regular enumeration starts from the first implementation in case of the fallback
+    auto desc = dnnl::primitive_desc(DnnlExtensionUtils::clone_primitive_desc(descs[descIdx].get()));
+    DnnlExtensionUtils::for_each_implementation(desc,
+                                                true,
+                                                [&](impl_desc_type implType) {
+                                                    return implType == descriptorHintImplType;
+                                                },
+                                                [&](dnnl::primitive_desc& desc) {
+                                                    add(desc, descIdx);
+                                                });
+    return supportedPrimitiveDescriptors.size() > numDescriptors;
+}
+
 void Node::filterSupportedPrimitiveDescriptors() {
     if (inputMemoryFormatsFilter.empty() && outputMemoryFormatsFilter.empty())
         return;
@@ -23,6 +23,7 @@
 #include "nodes/node_config.h"
 #include <shape_inference/shape_inference_cpu.hpp>
 #include "perf_count.h"
+#include "hw_perf_counters.h"
 #include "utils/debug_capabilities.h"
 #include "utils/bit_util.hpp"
 #include "utils/debug_capabilities.h"
@@ -112,10 +113,20 @@ public:
         executorFactory = factory;
     }
 
+    // index of the oneDNN descriptor in Node::descs the primitive descriptor was created from, -1 if none
+    int getDescriptorIndex() const {
+        return descriptorIndex;
+    }
+
+    void setDescriptorIndex(int index) {
+        descriptorIndex = index;
+    }
+
 private:
     NodeConfig config;
     impl_desc_type implementationType;
     ExecutorFactoryLegacyPtr executorFactory;
+    int descriptorIndex = -1;
 };
 
 class Node {
@@ -432,6 +443,8 @@ public:
     virtual std::string getPrimitiveDescriptorType() const;
 
     PerfCount &PerfCounter() { return perfCounter; }
+    HwPerfCount &HwPerfCounter() { return hwPerfCounter; }
+    const HwPerfCount &HwPerfCounter() const { return hwPerfCounter; }
 
     virtual void resolveInPlaceEdges(Edge::LOOK look = Edge::LOOK_BOTH);
 
@@ -647,6 +660,13 @@ protected:
 
     virtual AttrPtr initPrimitiveAttr() { return nullptr; }
 
+    /**
+     * @brief Adds the primitive descriptor, which was selected for the node in the compiled graph restored from the
+     * model cache, skipping the enumeration of the other descriptors and implementations.
+     * @return false if the node has no hint or the hinted implementation is not available
+     */
+    bool addHintedPrimitiveDescriptor(const std::function<void(dnnl::primitive_desc&, size_t)>& add);
+
     typedef std::function<DnnlMemoryDescPtr (dnnl::primitive_desc& primitive_desc_it, size_t idx)>
             GetPrimitiveMemoryFormatFunc;
     std::vector<GetPrimitiveMemoryFormatFunc> internalBlobDesc;
@@ -663,6 +683,9 @@ protected:
 
     std::string primitivesPriority;
     std::vector <impl_desc_type> customImplPriorities;
+    // the oneDNN descriptor and implementation selected for the node when the graph was compiled the last time
+    int descriptorHintIndex = -1;
+    impl_desc_type descriptorHintImplType = impl_desc_type::unknown;
     std::vector <dnnl::memory::format_tag> inputMemoryFormatsFilter;
     std::vector <dnnl::memory::format_tag> outputMemoryFormatsFilter;
     bool enforceBF16evenForGraphTail = false;
@@ -819,6 +842,7 @@ private:
     std::string typeToStr(Type type);
 
     PerfCount perfCounter;
+    HwPerfCount hwPerfCounter;
     PerfCounters profiling;
 
     MemoryPtr scratchpadMem;
@@ -803,13 +803,21 @@ void Convolution::initSupportedPrimitiveDescriptors() {
         supportedPrimitiveDescriptors.emplace_back(config, impl_type);
     };
 
+    auto add_indexed_desc = [&](dnnl::primitive_desc& desc, size_t dIdx) {
+        addSupportedPrimitiveDescriptor(desc);
+        supportedPrimitiveDescriptors.back().setDescriptorIndex(static_cast<int>(dIdx));
+        descIdx.push_back(dIdx);
+    };
+
+    if (addHintedPrimitiveDescriptor(add_indexed_desc))
+        return;
+
     for (size_t dIdx = 0; dIdx < descs.size(); dIdx++) {
         auto& desc = descs[dIdx];
         auto first_desc = dnnl::primitive_desc(DnnlExtensionUtils::clone_primitive_desc(desc.get()));
 
         auto add_supported_desc = [&](dnnl::primitive_desc& desc) {
-            addSupportedPrimitiveDescriptor(desc);
-            descIdx.push_back(dIdx);
+            add_indexed_desc(desc, dIdx);
         };
 
         const bool first_match = customImplPriorities.empty();
@@ -2,11 +2,13 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 
+#include <algorithm>
 #include <cmath>
 
 #include "openvino/op/ctc_loss.hpp"
 #include "openvino/core/parallel.hpp"
 #include "ctc_loss.h"
+#include "kernels/ctc/ctc_kernel.hpp"
 
 namespace ov {
 namespace intel_cpu {
@@ -83,7 +85,7 @@ void CTCLoss::execute(dnnl::stream strm) {
 
     std::vector<int> decodedTargetLenB(batchNum, 0);
     std::vector<std::vector<int>> targetDB(batchNum);
-    std::vector<std::vector<std::vector<float>>> logProbabilitiesB(batchNum);
+    std::vector<std::vector<float>> logProbabilitiesB(batchNum);
     std::vector<std::string> errorMsgB(parallel_get_max_threads());
 
     auto threadBody_1 = [&](const int ithr, const int nthr) {
@@ -124,7 +126,7 @@ void CTCLoss::execute(dnnl::stream strm) {
                     targetD[decodedTargetLen++] = target[t];
                 }
                 targetD[decodedTargetLen++] = blankIndex;
-            } else if (preprocessCollapseRepeated) {
+            } else if (preprocessCollapseRepeated && actualTargetLen > 0) {
                 auto prevValue = target[0];
                 targetD[decodedTargetLen++] = blankIndex;
                 targetD[decodedTargetLen++] = target[0];
@@ -145,11 +147,8 @@ void CTCLoss::execute(dnnl::stream strm) {
             }
             decodedTargetLenB[b] = decodedTargetLen;
 
-            auto& logProbabilities = logProbabilitiesB[b];
-            logProbabilities.resize(actualLogitLen);
-            for (size_t ll = 0; ll < actualLogitLen; ll++) {
-                logProbabilities[ll].resize(decodedTargetLen);
-            }
+            // the log probabilities of each time step are followed by two padding values read by the backward step
+            logProbabilitiesB[b].assign(actualLogitLen * (decodedTargetLen + 2), 0.f);
         } // for batch
     }; // threadBody_1
 
@@ -189,19 +188,17 @@ void CTCLoss::execute(dnnl::stream strm) {
         for (size_t b = sB; b < batchNum; b++) {
             const size_t actualLogitLen = logitsLength[b];
             const size_t decodedTargetLen = decodedTargetLenB[b];
+            const size_t stride = decodedTargetLen + 2;
             auto& logProbabilities = logProbabilitiesB[b];
             auto& targetD = targetDB[b];
 
-            double expSum = 0.0;
             size_t btcT = b * TC + sT * classesNum;
             // logProbabilities = logSoftmax = logits[b][t][c] - ln(sum_c(exp(logits[b][t])))
             for (size_t t = sT; t < actualLogitLen; t++) {
-                expSum = 0.0;
-                for (size_t c = 0lu; c < classesNum; c++) {
-                    expSum += std::exp(logits[btcT + c]);
-                }
+                const float logExpSum = ov::Extensions::Cpu::XARCH::ctc_log_sum_exp(&logits[btcT], classesNum);
+                float* logProbs = &logProbabilities[t * stride];
                 for (size_t s = 0lu; s < decodedTargetLen; s++) {
-                    logProbabilities[t][s] = logits[btcT + targetD[s]] - std::log(expSum);
+                    logProbs[s] = logits[btcT + targetD[s]] - logExpSum;
                 }
                 btcT += classesNum;
                 if (++workCounter >= end) {
@@ -237,42 +234,54 @@ void CTCLoss::execute(dnnl::stream strm) {
 
         // As per Connectionist Temporal Classification - Labeling Unsegmented Sequence Data with Recurrent Neural Networks:
         // Graves et al., 2016, paragraph 4.1 (10)
+        // Only the backward variables of two adjacent time steps are kept. The positions of a time step do not depend
+        // on each other, so they are computed by the vector kernel with the transitions turned into additive masks.
+        std::vector<float> stay, skip, logBwd, logBwdNext;
         for (size_t b = start; b < end; b++) {
             auto& targetD = targetDB[b];
             auto& logProbabilities = logProbabilitiesB[b];
             const int actualLogitLen = logitsLength[b];
             const int decodedTargetLen = decodedTargetLenB[b];
-            std::vector<std::vector<float>> logBwd(decodedTargetLen, std::vector<float>(actualLogitLen, -float_inf));
-            for (int s = decodedTargetLen - 2; s < decodedTargetLen; s++)
-                logBwd[s][actualLogitLen - 1] = 0.f;
+            const size_t stride = decodedTargetLen + 2;
+            if (actualLogitLen == 0) {
+                // the empty target is the only alignment of the empty sequence
+                dstData[b] = 0.f;
+                continue;
+            }
 
-            for (int t = actualLogitLen - 2; t >= 0; t--) {
-                const int t_1 = t + 1;
-                for (int s = std::max(0, decodedTargetLen - (2 * (actualLogitLen - t)));
-                     s < std::min(decodedTargetLen, 2 * (t_1)); s++) {
-                    if (ctcMergeRepeated || targetD[s] == blankIndex) {
-                        logBwd[s][t] = sumLogs(logBwd[s][t],
-                                               logBwd[s][t_1] + logProbabilities[t_1][s]);
-                    }
+            stay.resize(decodedTargetLen);
+            skip.resize(decodedTargetLen);
+            for (int s = 0; s < decodedTargetLen; s++) {
+                stay[s] = (ctcMergeRepeated || targetD[s] == blankIndex) ? 0.f : -float_inf;
+                skip[s] = (s + 2 < decodedTargetLen && targetD[s] != blankIndex &&
+                           (!ctcMergeRepeated || targetD[s] != targetD[s + 2])) ? 0.f : -float_inf;
+            }
 
-                    if (s + 1 < decodedTargetLen) {
-                        logBwd[s][t] = sumLogs(logBwd[s][t],
-                                               logBwd[s + 1][t_1] + logProbabilities[t_1][s + 1]);
-                    }
+            // the padding past the targets stays -inf
+            logBwd.assign(stride, -float_inf);
+            logBwdNext.assign(stride, -float_inf);
+            for (int s = std::max(0, decodedTargetLen - 2); s < decodedTargetLen; s++)
+                logBwdNext[s] = 0.f;
 
-                    if (s + 2 < decodedTargetLen) {
-                        if (targetD[s] != blankIndex && (!ctcMergeRepeated || (targetD[s] != targetD[s + 2]))) {
-                            logBwd[s][t] = sumLogs(logBwd[s][t],
-                                                   logBwd[s + 2][t_1] + logProbabilities[t_1][s + 2]);
-                        }
-                    }
-                }
+            for (int t = actualLogitLen - 2; t >= 0; t--) {
+                const int t_1 = t + 1;
+                const int sBegin = std::max(0, decodedTargetLen - (2 * (actualLogitLen - t)));
+                const int sEnd = std::min(decodedTargetLen, 2 * (t_1));
+                std::fill(logBwd.begin(), logBwd.begin() + decodedTargetLen, -float_inf);
+                ov::Extensions::Cpu::XARCH::ctc_backward_step(logBwdNext.data(),
+                                                              &logProbabilities[t_1 * stride],
+                                                              stay.data(),
+                                                              skip.data(),
+                                                              sBegin,
+                                                              sEnd,
+                                                              logBwd.data());
+                std::swap(logBwd, logBwdNext);
             }
 
-            logBwd[0][0] += logProbabilities[0][0];
-            logBwd[1][0] += logProbabilities[0][(decodedTargetLen > 1) ? 1 : 0];
+            const float logBwd0 = logBwdNext[0] + logProbabilities[0];
+            const float logBwd1 = logBwdNext[1] + logProbabilities[(decodedTargetLen > 1) ? 1 : 0];
 
-            dstData[b] = -sumLogs(logBwd[0][0], logBwd[1][0]);
+            dstData[b] = -sumLogs(logBwd0, logBwd1);
         } // for batch
     }; // threadBody_3
 
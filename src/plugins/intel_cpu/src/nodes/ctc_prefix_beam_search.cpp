@@ -0,0 +1,239 @@
+// Copyright (C) 2018-2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "ctc_prefix_beam_search.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "kernels/ctc/ctc_kernel.hpp"
+#include "kernels/sampling/topk_sampling_kernel.hpp"
+#include "openvino/core/parallel.hpp"
+
+namespace ov {
+namespace intel_cpu {
+namespace node {
+
+namespace {
+
+constexpr float neg_inf = -std::numeric_limits<float>::infinity();
+
+// the prefixes are kept as a tree, a prefix is its last class and the index of the prefix without it
+struct Prefix {
+    int32_t parent;
+    int32_t label;
+};
+
+struct Beam {
+    int32_t prefix;
+    float blank;     // log probability of the alignments of the prefix ending in the blank
+    float nonBlank;  // log probability of the alignments of the prefix ending in its last class
+};
+
+inline float log_add(float a, float b) {
+    const float max = std::max(a, b);
+    if (max == neg_inf)
+        return neg_inf;
+    return max + std::log1p(std::exp(std::min(a, b) - max));
+}
+
+inline float beam_score(const Beam& beam) {
+    return log_add(beam.blank, beam.nonBlank);
+}
+
+inline bool ranks_before(const Beam& a, const Beam& b) {
+    const float a_score = beam_score(a);
+    const float b_score = beam_score(b);
+    return a_score > b_score || (a_score == b_score && a.prefix < b.prefix);
+}
+
+}  // namespace
+
+CTCPrefixBeamSearch::CTCPrefixBeamSearch(const std::shared_ptr<ov::Node>& op, const GraphContext::CPtr context)
+    : Node(op, context, NgraphShapeInferFactory(op, EMPTY_PORT_MASK)) {
+    std::string errorMessage;
+    if (!isSupportedOperation(op, errorMessage)) {
+        OPENVINO_THROW_NOT_IMPLEMENTED(errorMessage);
+    }
+
+    m_errorPrefix = "CTCPrefixBeamSearch layer with name '" + op->get_friendly_name() + "' ";
+    const auto node = std::dynamic_pointer_cast<const ov::op::internal::CTCPrefixBeamSearch>(op);
+    m_beamSize = node->get_beam_size();
+    m_lmWeight = node->get_lm_weight();
+}
+
+bool CTCPrefixBeamSearch::isSupportedOperation(const std::shared_ptr<const ov::Node>& op,
+                                               std::string& errorMessage) noexcept {
+    try {
+        const auto node = std::dynamic_pointer_cast<const ov::op::internal::CTCPrefixBeamSearch>(op);
+        if (!node) {
+            errorMessage = "Only internal CTCPrefixBeamSearch operation is supported";
+            return false;
+        }
+    } catch (...) {
+        return false;
+    }
+    return true;
+}
+
+void CTCPrefixBeamSearch::initSupportedPrimitiveDescriptors() {
+    if (!supportedPrimitiveDescriptors.empty())
+        return;
+
+    std::vector<PortConfigurator> inDataConf;
+    inDataConf.reserve(inputShapes.size());
+    inDataConf.emplace_back(LayoutType::ncsp, ov::element::f32);
+    inDataConf.emplace_back(LayoutType::ncsp, ov::element::i32);
+    if (inputShapes.size() > BLANK_INDEX_PORT)
+        inDataConf.emplace_back(LayoutType::ncsp, ov::element::i32);
+    if (inputShapes.size() > TOKEN_SCORES_PORT)
+        inDataConf.emplace_back(LayoutType::ncsp, ov::element::f32);
+
+    addSupportedPrimDesc(inDataConf,
+                         {{LayoutType::ncsp, ov::element::i32},
+                          {LayoutType::ncsp, ov::element::i32},
+                          {LayoutType::ncsp, ov::element::f32}},
+                         impl_desc_type::ref_any);
+}
+
+void CTCPrefixBeamSearch::execute(dnnl::stream strm) {
+    const auto& logitsDims = getParentEdgeAt(LOGITS_PORT)->getMemory().getStaticDims();
+    const size_t B = logitsDims[0];
+    const size_t T = logitsDims[1];
+    const size_t C = logitsDims[2];
+
+    const auto* logits = getSrcDataAtPortAs<const float>(LOGITS_PORT);
+    const auto* sequenceLengths = getSrcDataAtPortAs<const int32_t>(SEQUENCE_LENGTH_PORT);
+    auto* decodedClasses = getDstDataAtPortAs<int32_t>(DECODED_CLASSES_PORT);
+    auto* decodedLengths = getDstDataAtPortAs<int32_t>(DECODED_LENGTH_PORT);
+    auto* scores = getDstDataAtPortAs<float>(SCORES_PORT);
+
+    int32_t blankIndex = static_cast<int32_t>(C) - 1;
+    if (inputShapes.size() > BLANK_INDEX_PORT)
+        blankIndex = getSrcDataAtPortAs<const int32_t>(BLANK_INDEX_PORT)[0];
+    if (blankIndex < 0 || blankIndex >= static_cast<int32_t>(C))
+        OPENVINO_THROW(m_errorPrefix, "has blank index ", blankIndex, " out of the classes range [0, ", C, ")");
+
+    const float* tokenScores = nullptr;
+    if (inputShapes.size() > TOKEN_SCORES_PORT && m_lmWeight != 0.f)
+        tokenScores = getSrcDataAtPortAs<const float>(TOKEN_SCORES_PORT);
+
+    for (size_t b = 0; b < B; b++) {
+        if (sequenceLengths[b] < 0 || sequenceLengths[b] > static_cast<int32_t>(T))
+            OPENVINO_THROW(m_errorPrefix, "has sequence length ", sequenceLengths[b], " out of the range [0, ", T, "]");
+    }
+
+    // Only the beam_size most probable classes of a time step extend the prefixes. They are selected along with the
+    // log softmax normalizers for all the time steps in parallel, the search itself is sequential along the time.
+    const size_t K = std::min(m_beamSize, C);
+    m_candidateLogProbs.resize(B * T * K);
+    m_candidateClasses.resize(B * T * K);
+    m_blankLogProbs.resize(B * T);
+    parallel_for2d(B, T, [&](size_t b, size_t t) {
+        if (t >= static_cast<size_t>(sequenceLengths[b]))
+            return;
+        const size_t offset = b * T + t;
+        const float* logitsT = logits + offset * C;
+        const float logExpSum = ov::Extensions::Cpu::XARCH::ctc_log_sum_exp(logitsT, C);
+        float* logProbs = m_candidateLogProbs.data() + offset * K;
+        ov::Extensions::Cpu::XARCH::topk_sampling_candidates(logitsT,
+                                                             C,
+                                                             K,
+                                                             0,
+                                                             logProbs,
+                                                             m_candidateClasses.data() + offset * K);
+        for (size_t k = 0; k < K; k++) {
+            logProbs[k] -= logExpSum;
+        }
+        m_blankLogProbs[offset] = logitsT[blankIndex] - logExpSum;
+    });
+
+    parallel_for(B, [&](size_t b) {
+        std::vector<Prefix> prefixes = {{-1, -1}};
+        std::unordered_map<uint64_t, int32_t> children;
+        auto extend = [&](int32_t prefix, int32_t label) {
+            const uint64_t key = (static_cast<uint64_t>(prefix) << 32) | static_cast<uint32_t>(label);
+            const auto it = children.emplace(key, static_cast<int32_t>(prefixes.size()));
+            if (it.second)
+                prefixes.push_back({prefix, label});
+            return it.first->second;
+        };
+
+        std::vector<Beam> beams = {{0, 0.f, neg_inf}};
+        std::vector<Beam> nextBeams;
+        std::unordered_map<int32_t, size_t> nextBeamsIndices;
+        auto nextBeam = [&](int32_t prefix) {
+            const auto it = nextBeamsIndices.emplace(prefix, nextBeams.size());
+            if (it.second)
+                nextBeams.push_back({prefix, neg_inf, neg_inf});
+            return it.first->second;
+        };
+
+        for (size_t t = 0; t < static_cast<size_t>(sequenceLengths[b]); t++) {
+            const size_t offset = b * T + t;
+            const float* logProbs = m_candidateLogProbs.data() + offset * K;
+            const int32_t* classes = m_candidateClasses.data() + offset * K;
+            const float blankLogProb = m_blankLogProbs[offset];
+
+            nextBeams.clear();
+            nextBeamsIndices.clear();
+            for (const auto& beam : beams) {
+                const float score = beam_score(beam);
+                const int32_t last = prefixes[beam.prefix].label;
+                const size_t same = nextBeam(beam.prefix);
+                nextBeams[same].blank = log_add(nextBeams[same].blank, score + blankLogProb);
+
+                for (size_t k = 0; k < K; k++) {
+                    const int32_t label = classes[k];
+                    if (label == blankIndex)
+                        continue;
+                    const float logProb = logProbs[k];
+                    // the static (unigram) bias of the class, whatever the prefix is
+                    const float lmScore = tokenScores ? m_lmWeight * tokenScores[label] : 0.f;
+                    const size_t extended = nextBeam(extend(beam.prefix, label));
+                    if (label == last) {
+                        // the repeated class is merged unless the blank separates it
+                        nextBeams[same].nonBlank = log_add(nextBeams[same].nonBlank, beam.nonBlank + logProb);
+                        nextBeams[extended].nonBlank =
+                            log_add(nextBeams[extended].nonBlank, beam.blank + logProb + lmScore);
+                    } else {
+                        nextBeams[extended].nonBlank = log_add(nextBeams[extended].nonBlank, score + logProb + lmScore);
+                    }
+                }
+            }
+
+            if (nextBeams.size() > m_beamSize) {
+                std::partial_sort(nextBeams.begin(),
+                                  nextBeams.begin() + m_beamSize,
+                                  nextBeams.end(),
+                                  ranks_before);
+                nextBeams.resize(m_beamSize);
+            }
+            std::swap(beams, nextBeams);
+        }
+
+        const auto& best = *std::min_element(beams.begin(), beams.end(), ranks_before);
+        size_t length = 0;
+        for (int32_t prefix = best.prefix; prefix > 0; prefix = prefixes[prefix].parent) {
+            length++;
+        }
+        int32_t* batchClasses = decodedClasses + b * T;
+        int32_t prefix = best.prefix;
+        for (size_t i = length; i > 0; i--) {
+            batchClasses[i - 1] = prefixes[prefix].label;
+            prefix = prefixes[prefix].parent;
+        }
+        std::fill(batchClasses + length, batchClasses + T, -1);
+        decodedLengths[b] = static_cast<int32_t>(length);
+        scores[b] = beam_score(best);
+    });
+}
+
+}  // namespace node
+}  // namespace intel_cpu
+}  // namespace ov
@@ -0,0 +1,54 @@
+// Copyright (C) 2018-2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include "node.h"
+#include "ov_ops/ctc_prefix_beam_search.hpp"
+
+namespace ov {
+namespace intel_cpu {
+namespace node {
+
+class CTCPrefixBeamSearch : public Node {
+public:
+    CTCPrefixBeamSearch(const std::shared_ptr<ov::Node>& op, const GraphContext::CPtr context);
+
+    void getSupportedDescriptors() override {}
+    bool created() const override {
+        return getType() == Type::CTCPrefixBeamSearch;
+    }
+    bool needPrepareParams() const override {
+        return false;
+    };
+    void executeDynamicImpl(dnnl::stream strm) override {
+        execute(strm);
+    }
+    void initSupportedPrimitiveDescriptors() override;
+    void execute(dnnl::stream strm) override;
+    static bool isSupportedOperation(const std::shared_ptr<const ov::Node>& op, std::string& errorMessage) noexcept;
+
+private:
+    static constexpr size_t LOGITS_PORT = 0lu;
+    static constexpr size_t SEQUENCE_LENGTH_PORT = 1lu;
+    static constexpr size_t BLANK_INDEX_PORT = 2lu;
+    static constexpr size_t TOKEN_SCORES_PORT = 3lu;
+    static constexpr size_t DECODED_CLASSES_PORT = 0lu;
+    static constexpr size_t DECODED_LENGTH_PORT = 1lu;
+    static constexpr size_t SCORES_PORT = 2lu;
+
+    size_t m_beamSize = 0lu;
+    float m_lmWeight = 0.f;
+    std::string m_errorPrefix;
+
+    // the classes which may extend the prefixes at each time step and their log probabilities, the log probabilities
+    // of the blank, all computed for all the time steps in parallel before the sequential search
+    std::vector<float> m_candidateLogProbs;
+    std::vector<int32_t> m_candidateClasses;
+    std::vector<float> m_blankLogProbs;
+};
+
+}  // namespace node
+}  // namespace intel_cpu
+}  // namespace ov
@@ -8,7 +8,9 @@
 #include "openvino/opsets/opset1.hpp"
 #include "openvino/opsets/opset3.hpp"
 #include "utils/bfloat16.hpp"
+#include "utils/general_utils.h"
 
+#include <numeric>
 #include <string>
 #include <vector>
 
@@ -111,119 +113,136 @@ template <typename dataType>
 void CumSum::exec() {
     const auto *input = getSrcDataAtPortAs<const dataType>(CUM_SUM_DATA);
     auto *output = getDstDataAtPortAs<dataType>(0);
-    const VectorDims strides = getParentEdgeAt(CUM_SUM_DATA)->getMemory().getDescWithType<BlockedMemoryDesc>()->getStrides();
 
     if (reverse) {
         if (exclusive) {
-            cumSum<true, true, dataType>(input, output, strides);
+            cumSum<true, true, dataType>(input, output);
         } else {
-            cumSum<true, false, dataType>(input, output, strides);
+            cumSum<true, false, dataType>(input, output);
         }
     } else {
         if (exclusive) {
-            cumSum<false, true, dataType>(input, output, strides);
+            cumSum<false, true, dataType>(input, output);
         } else {
-            cumSum<false, false, dataType>(input, output, strides);
+            cumSum<false, false, dataType>(input, output);
         }
     }
 }
 
+// the width of the inner columns block scanned by a thread
+static constexpr size_t innerBlockSize = 512;
+// the minimal number of elements in a block when the scan axis is split between the threads
+static constexpr size_t minBlockWork = 4096;
+
+// Scans the rows [begin, end) along the axis of the [axisLen, inner] slice, the columns [innerBegin, innerEnd) only.
+// The row is contiguous, so the inner loop is vectorized.
 template <bool reverse, bool exclusive, typename dataType>
-void CumSum::cumSum(const dataType *input, dataType *output, const VectorDims &strides) {
-    VectorDims iterationRange(numOfDims - 1);
-    size_t j = 0;
-    const auto &shape = getParentEdgeAt(CUM_SUM_DATA)->getMemory().getStaticDims();
-    for (size_t i = 0; i < shape.size(); i++) {
-        if (i == axis)
-            continue;
-        iterationRange[j++] = shape[i];
+static void scanBlock(const dataType *input, dataType *output, size_t begin, size_t end,
+                      size_t inner, size_t innerBegin, size_t innerEnd) {
+    const size_t first = reverse ? end - 1 : begin;
+    const dataType *src = input + first * inner;
+    dataType *dst = output + first * inner;
+    for (size_t j = innerBegin; j < innerEnd; j++) {
+        dst[j] = exclusive ? dataType(0) : src[j];
     }
-    size_t work_amount_dst = std::accumulate(iterationRange.begin(), iterationRange.end(), size_t(1), std::multiplies<size_t>());
-    parallel_nt(0, [&](const int ithr, const int nthr) {
-        size_t start = 0, end = 0;
-        VectorDims counters(numOfDims - 1, 0);
-        splitter(work_amount_dst, nthr, ithr, start, end);
-
-        parallelItInit(start, counters, iterationRange);
-
-        for (size_t iwork = start; iwork < end; ++iwork) {
-            std::vector<size_t> forStartOffset(numOfDims);
-            forStartOffset[axis] = 0;
-            for (size_t offsetIdx = 0, countersIdx = 0; offsetIdx < numOfDims; ++offsetIdx) {
-                if (offsetIdx == axis) {
-                    continue;
-                }
-                forStartOffset[offsetIdx] = counters[countersIdx++];
-            }
-
-            size_t startOffset = getStartOffset(forStartOffset, strides);
-
-            const dataType *inputStart = input + startOffset;
-            dataType *outputStart = output + startOffset;
-
-            size_t offset = strides[axis];
-            if (reverse) {
-                if (exclusive) {
-                    outputStart[offset*(shape[axis] - 1)] = 0;
-                    for (int64_t i = shape[axis] - 2; i >= 0; i--) {
-                        outputStart[i*offset] = inputStart[(i+1)*offset] + outputStart[(i+1)*offset];
-                    }
-                } else {
-                    outputStart[offset*(shape[axis] - 1)] = inputStart[offset * (shape[axis] - 1)];
-                    for (int64_t i = shape[axis] - 2; i >= 0; i--) {
-                        outputStart[i*offset] = inputStart[i*offset] + outputStart[(i+1)*offset];
-                    }
-                }
-            } else {
-                if (exclusive) {
-                    outputStart[0] = 0;
-                    for (size_t i = 1; i < shape[axis]; i++) {
-                        outputStart[i*offset] = inputStart[(i-1)*offset] + outputStart[(i-1)*offset];
-                    }
-                } else {
-                    outputStart[0] = inputStart[0];
-                    for (size_t i = 1; i < shape[axis]; i++) {
-                        outputStart[i*offset] = inputStart[i*offset] + outputStart[(i-1)*offset];
-                    }
-                }
-            }
-
-            parallelItStep(counters, iterationRange);
+    for (size_t step = 1; step < end - begin; step++) {
+        const size_t cur = reverse ? end - 1 - step : begin + step;
+        const size_t prev = reverse ? cur + 1 : cur - 1;
+        const dataType *srcRow = input + (exclusive ? prev : cur) * inner;
+        const dataType *prevRow = output + prev * inner;
+        dataType *dstRow = output + cur * inner;
+        for (size_t j = innerBegin; j < innerEnd; j++) {
+            dstRow[j] = srcRow[j] + prevRow[j];
         }
-    });
+    }
 }
 
-void CumSum::parallelItInit(size_t start, std::vector<size_t>& counters, const std::vector<size_t>& iterationRange) {
-    auto itCounter = counters.rbegin();
-    auto itWork = iterationRange.rbegin();
-    while (itCounter != counters.rend() && itWork != iterationRange.rend()) {
-        *itCounter = start % *itWork;
-        start /= *itWork;
-        ++itCounter;
-        ++itWork;
+template <bool reverse, bool exclusive, typename dataType>
+void CumSum::cumSum(const dataType *input, dataType *output) {
+    const auto &shape = getParentEdgeAt(CUM_SUM_DATA)->getMemory().getStaticDims();
+    const size_t outer = std::accumulate(shape.begin(), shape.begin() + axis, size_t(1), std::multiplies<size_t>());
+    const size_t axisLen = shape[axis];
+    const size_t inner = std::accumulate(shape.begin() + axis + 1, shape.end(), size_t(1), std::multiplies<size_t>());
+    if (outer * axisLen * inner == 0)
+        return;
+
+    const size_t innerBlock = std::min(inner, innerBlockSize);
+    const size_t innerBlocks = div_up(inner, innerBlock);
+
+    // The axis is split into blocks only if the other dimensions don't give enough work to the threads. The blocks are
+    // scanned in parallel, then the sums of the preceding blocks are added to each of them (two-pass prefix sum).
+    const size_t nthr = parallel_get_max_threads();
+    size_t axisBlocks = 1;
+    if (outer * innerBlocks < nthr) {
+        axisBlocks = std::min(div_up(nthr, outer * innerBlocks), axisLen * innerBlock / minBlockWork);
+        axisBlocks = std::max(axisBlocks, size_t(1));
+    }
+    const size_t axisBlock = div_up(axisLen, axisBlocks);
+    axisBlocks = div_up(axisLen, axisBlock);
+
+    const size_t sliceSize = axisLen * inner;
+    if (axisBlocks == 1) {
+        parallel_for2d(outer, innerBlocks, [&](size_t o, size_t ib) {
+            const size_t innerBegin = ib * innerBlock;
+            const size_t innerEnd = std::min(innerBegin + innerBlock, inner);
+            scanBlock<reverse, exclusive>(input + o * sliceSize, output + o * sliceSize, 0, axisLen,
+                                          inner, innerBegin, innerEnd);
+        });
+        return;
     }
-}
 
-inline void CumSum::parallelItStep(std::vector<size_t>& counters, const std::vector<size_t>& iterationRange) {
-    auto itCounter = counters.rbegin();
-    auto itWork = iterationRange.rbegin();
+    // the carries of the blocks in the scan order, [outer, axisBlocks, inner]
+    std::vector<dataType> carries(outer * axisBlocks * inner);
+    parallel_for3d(outer, axisBlocks, innerBlocks, [&](size_t o, size_t b, size_t ib) {
+        const size_t begin = b * axisBlock;
+        const size_t end = std::min(begin + axisBlock, axisLen);
+        const size_t innerBegin = ib * innerBlock;
+        const size_t innerEnd = std::min(innerBegin + innerBlock, inner);
+        const dataType *src = input + o * sliceSize;
+        dataType *dst = output + o * sliceSize;
+        scanBlock<reverse, exclusive>(src, dst, begin, end, inner, innerBegin, innerEnd);
+
+        const size_t last = reverse ? begin : end - 1;
+        const size_t order = reverse ? axisBlocks - 1 - b : b;
+        dataType *total = carries.data() + (o * axisBlocks + order) * inner;
+        for (size_t j = innerBegin; j < innerEnd; j++) {
+            total[j] = exclusive ? dataType(dst[last * inner + j] + src[last * inner + j]) : dst[last * inner + j];
+        }
+    });
 
-    while (itCounter != counters.rend() && itWork != iterationRange.rend()) {
-        *itCounter = (*itCounter + 1) % *itWork;
-        if (*itCounter != 0) {
-            break;
+    // the totals of the blocks are turned into the exclusive prefix sums in place
+    parallel_for2d(outer, innerBlocks, [&](size_t o, size_t ib) {
+        const size_t innerBegin = ib * innerBlock;
+        const size_t innerEnd = std::min(innerBegin + innerBlock, inner);
+        dataType *carry = carries.data() + o * axisBlocks * inner;
+        for (size_t j = innerBegin; j < innerEnd; j++) {
+            dataType sum = carry[j];
+            carry[j] = dataType(0);
+            for (size_t order = 1; order < axisBlocks; order++) {
+                const dataType total = carry[order * inner + j];
+                carry[order * inner + j] = sum;
+                sum = sum + total;
+            }
         }
-        ++itCounter;
-        ++itWork;
-    }
-}
+    });
 
-inline size_t CumSum::getStartOffset(const std::vector<size_t> &forStartOffset, const std::vector<size_t>& strides) const {
-    size_t startOffset = 0;
-    for (size_t idx = 0; idx < forStartOffset.size(); ++idx) {
-        startOffset += forStartOffset[idx] * strides[idx];
-    }
-    return startOffset;
+    parallel_for3d(outer, axisBlocks, innerBlocks, [&](size_t o, size_t b, size_t ib) {
+        const size_t order = reverse ? axisBlocks - 1 - b : b;
+        if (order == 0)
+            return;
+        const size_t begin = b * axisBlock;
+        const size_t end = std::min(begin + axisBlock, axisLen);
+        const size_t innerBegin = ib * innerBlock;
+        const size_t innerEnd = std::min(innerBegin + innerBlock, inner);
+        const dataType *carry = carries.data() + (o * axisBlocks + order) * inner;
+        dataType *dst = output + o * sliceSize;
+        for (size_t i = begin; i < end; i++) {
+            dataType *dstRow = dst + i * inner;
+            for (size_t j = innerBegin; j < innerEnd; j++) {
+                dstRow[j] = dstRow[j] + carry[j];
+            }
+        }
+    });
 }
 
 size_t CumSum::getAxis(const IMemory& _axis, const IMemory& _data) const {
@@ -29,13 +29,7 @@ private:
     void exec();
 
     template <bool reverse, bool exclusive, typename dataType>
-    void cumSum(const dataType *input, dataType *output, const std::vector<size_t> &strides);
-
-    void parallelItInit(size_t start, std::vector<size_t>& counters, const std::vector<size_t>& iterationRange);
-
-    inline void parallelItStep(std::vector<size_t>& counters, const std::vector<size_t>& iterationRange);
-
-    inline size_t getStartOffset(const std::vector<size_t> &forStartOffset, const std::vector<size_t>& strides) const;
+    void cumSum(const dataType *input, dataType *output);
 
     size_t getAxis(const IMemory& _axis, const IMemory& _data) const;
 
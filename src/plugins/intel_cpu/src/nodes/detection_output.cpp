@@ -5,6 +5,7 @@
 #include "openvino/op/detection_output.hpp"
 
 #include "detection_output.h"
+#include "kernels/nms/nms_kernel.hpp"
 #include "onednn/dnnl.h"
 #include "openvino/core/parallel.hpp"
 
@@ -21,10 +22,16 @@ bool SortScorePairDescend(const std::pair<float, T>& pair1,
     return (pair1.first > pair2.first) || (pair1.first == pair2.first && pair1.second < pair2.second);
 }
 
+// the pairs are {class, prior}: the ties are ordered by the prior as in the reference, then by the class, so the
+// order is total and std::partial_sort keeps the same detections at the keep_top_k boundary as a full sort does
 template <>
 bool SortScorePairDescend<std::pair<int, int>>(const std::pair<float, std::pair<int, int>>& pair1,
                                                const std::pair<float, std::pair<int, int>>& pair2) {
-    return (pair1.first > pair2.first) || (pair1.first == pair2.first && pair1.second.second < pair2.second.second);
+    if (pair1.first != pair2.first)
+        return pair1.first > pair2.first;
+    if (pair1.second.second != pair2.second.second)
+        return pair1.second.second < pair2.second.second;
+    return pair1.second.first < pair2.second.first;
 }
 
 } // namespace
@@ -260,36 +267,36 @@ void DetectionOutput::execute(dnnl::stream strm) {
         }
     }
 
-    // NMS
-    for (int n = 0; n < imgNum; ++n) {
-        if (!decreaseClassId) {
-            // Caffe style
-            parallel_for(classesNum, [&](int c) {
-                if (c != backgroundClassId) {  // Ignore background class
-                    const int off = n * priorsNum * classesNum + c * priorsNum;
-                    const float *pconfReorder = reorderedConfData + off;
-                    int *pindices = indicesData + off;
-                    int *pbuffer = indicesBufData + off;
-                    int *pdetections = detectionsData + n * classesNum + c;
-
-                    if (!isSparsityWorthwhile)
-                        confFilterCF(pconfReorder, pindices, pbuffer, pdetections, n);
-
-                    const float *pboxes;
-                    const float *psizes;
-                    if (isShareLoc) {
-                        pboxes = decodedBboxesData + n * 4 * priorsNum;
-                        psizes = bboxSizesData + n * priorsNum;
-                    } else {
-                        pboxes = decodedBboxesData + n * 4 * classesNum * priorsNum + c * 4 * priorsNum;
-                        psizes = bboxSizesData + n * classesNum * priorsNum + c * priorsNum;
-                    }
-
-                    NMSCF(pbuffer, *pdetections, pindices, pboxes, psizes);
+    // NMS, the images and the classes are independent
+    if (!decreaseClassId) {
+        // Caffe style
+        parallel_for2d(imgNum, classesNum, [&](int n, int c) {
+            if (c != backgroundClassId) {  // Ignore background class
+                const int off = n * priorsNum * classesNum + c * priorsNum;
+                const float *pconfReorder = reorderedConfData + off;
+                int *pindices = indicesData + off;
+                int *pbuffer = indicesBufData + off;
+                int *pdetections = detectionsData + n * classesNum + c;
+
+                if (!isSparsityWorthwhile)
+                    confFilterCF(pconfReorder, pindices, pbuffer, pdetections, n);
+
+                const float *pboxes;
+                const float *psizes;
+                if (isShareLoc) {
+                    pboxes = decodedBboxesData + n * 4 * priorsNum;
+                    psizes = bboxSizesData + n * priorsNum;
+                } else {
+                    pboxes = decodedBboxesData + n * 4 * classesNum * priorsNum + c * 4 * priorsNum;
+                    psizes = bboxSizesData + n * classesNum * priorsNum + c * priorsNum;
                 }
-            });
-        } else {
-            // MXNet style
+
+                NMSCF(pbuffer, *pdetections, pindices, pboxes, psizes);
+            }
+        });
+    } else {
+        // MXNet style
+        parallel_for(imgNum, [&](int n) {
             const int offImg = n * priorsNum * classesNum;
             const float *pconf = confData + offImg;
             float *pconfReorder = reorderedConfData + offImg;
@@ -304,19 +311,21 @@ void DetectionOutput::execute(dnnl::stream strm) {
             const float *psizes = bboxSizesData + n * locNumForClasses * priorsNum;
 
             NMSMX(pbuffer, pdetections, pindices, pboxes, psizes);
-        }
+        });
+    }
 
+    parallel_for(imgNum, [&](int n) {
         int detectionsTotal = 0;
-        detectionsTotal = parallel_sum(classesNum, detectionsTotal, [&](size_t c)->int {
-            return detectionsData[n * classesNum + c];
-        });
+        for (int c = 0; c < classesNum; ++c) {
+            detectionsTotal += detectionsData[n * classesNum + c];
+        }
 
         // combine detections of all class for this image and filter with global(image) topk(keep_topk)
         if (keepTopK > -1 && detectionsTotal > keepTopK) {
             std::vector<std::pair<float, std::pair<int, int>>> confIndicesClassMap;
+            confIndicesClassMap.reserve(detectionsTotal);
 
-            std::mutex mtx;
-            parallel_for(classesNum, [&](int c) {
+            for (int c = 0; c < classesNum; ++c) {
                 const int detections = detectionsData[n * classesNum + c];
                 int *pindices = indicesData + n * classesNum * priorsNum + c * priorsNum;
 
@@ -324,14 +333,13 @@ void DetectionOutput::execute(dnnl::stream strm) {
 
                 for (int i = 0; i < detections; ++i) {
                     int pr = pindices[i];
-                    mtx.lock();
                     confIndicesClassMap.push_back(std::make_pair(pconf[pr], std::make_pair(c, pr)));
-                    mtx.unlock();
                 }
-            });
+            }
 
-            std::sort(confIndicesClassMap.begin(), confIndicesClassMap.end(),
-                      SortScorePairDescend<std::pair<int, int>>);
+            // only the keep_topk best detections are ordered
+            std::partial_sort(confIndicesClassMap.begin(), confIndicesClassMap.begin() + keepTopK,
+                              confIndicesClassMap.end(), SortScorePairDescend<std::pair<int, int>>);
             confIndicesClassMap.resize(keepTopK);
 
             // Store the new indices. Assign to class back
@@ -345,7 +353,7 @@ void DetectionOutput::execute(dnnl::stream strm) {
                 detectionsData[n * classesNum + cls]++;
             }
         }
-    }
+    });
 
     // get final output
     generateOutput(reorderedConfData, indicesData, detectionsData, decodedBboxesData, dstData);
@@ -722,43 +730,6 @@ inline void DetectionOutput::topk(const int *indicesIn, int *indicesOut, const f
                            ConfidenceComparatorDO(conf));
 }
 
-static inline float JaccardOverlap(const float *decodedBbox,
-                                   const float *bboxSizes,
-                                   const int idx1,
-                                   const int idx2) {
-    const float xmin1 = decodedBbox[idx1 * 4 + 0];
-    const float ymin1 = decodedBbox[idx1 * 4 + 1];
-    const float xmax1 = decodedBbox[idx1 * 4 + 2];
-    const float ymax1 = decodedBbox[idx1 * 4 + 3];
-
-    const float xmin2 = decodedBbox[idx2 * 4 + 0];
-    const float ymin2 = decodedBbox[idx2 * 4 + 1];
-    const float xmax2 = decodedBbox[idx2 * 4 + 2];
-    const float ymax2 = decodedBbox[idx2 * 4 + 3];
-
-    if (xmin2 > xmax1 || xmax2 < xmin1 || ymin2 > ymax1 || ymax2 < ymin1) {
-        return 0.0f;
-    }
-
-    float intersectXMin = (std::max)(xmin1, xmin2);
-    float intersectYMin = (std::max)(ymin1, ymin2);
-    float intersectXMax = (std::min)(xmax1, xmax2);
-    float intersectYMax = (std::min)(ymax1, ymax2);
-
-    float intersectWidth  = intersectXMax - intersectXMin;
-    float intersectHeight = intersectYMax - intersectYMin;
-
-    if (intersectWidth <= 0 || intersectHeight <= 0) {
-        return 0.0f;
-    }
-
-    float intersectSize = intersectWidth * intersectHeight;
-    float bbox1Size = bboxSizes[idx1];
-    float bbox2Size = bboxSizes[idx2];
-
-    return intersectSize / (bbox1Size + bbox2Size - intersectSize);
-}
-
 inline void DetectionOutput::NMSCF(int* indicesIn,
                                         int& detections,
                                         int* indicesOut,
@@ -767,21 +738,18 @@ inline void DetectionOutput::NMSCF(int* indicesIn,
     // nms for this class
     int countIn = detections;
     detections = 0;
+    // the kept boxes are also stored in the SoA layout to compare the candidates with them by the vector IoU
+    IouBoxes keptBoxes;
+    keptBoxes.reserve(countIn);
     for (int i = 0; i < countIn; ++i) {
         const int prior = indicesIn[i];
+        const float* box = bboxes + prior * 4;
 
-        bool keep = true;
-        for (int k = 0; k < detections; ++k) {
-            const int keptPrior = indicesOut[k];
-            float overlap = JaccardOverlap(bboxes, boxSizes, prior, keptPrior);
-            if (overlap > NMSThreshold) {
-                keep = false;
-                break;
-            }
-        }
-        if (keep) {
+        if (!ov::Extensions::Cpu::XARCH::nms_iou_exceeds(box, boxSizes[prior], keptBoxes, IouParams(), NMSThreshold,
+                                                         false)) {
             indicesOut[detections] = prior;
             detections++;
+            keptBoxes.push_back(box, boxSizes[prior]);
         }
     }
 }
@@ -795,6 +763,7 @@ inline void DetectionOutput::NMSMX(int* indicesIn,
     int countIn = detections[0];
     detections[0] = 0;
 
+    std::vector<IouBoxes> keptBoxes(classesNum);
     for (int i = 0; i < countIn; ++i) {
         const int idx = indicesIn[i];
         const int cls = idx / priorsNum;
@@ -804,23 +773,12 @@ inline void DetectionOutput::NMSMX(int* indicesIn,
         int &ndetection = detections[cls];
         int *pindices = indicesOut + cls * priorsNum;
 
-        bool keep = true;
-        for (int k = 0; k < ndetection; ++k) {
-            const int keptPrior = pindices[k];
-            float overlap = 0.0f;
-            if (isShareLoc) {
-                overlap = JaccardOverlap(bboxes, sizes, prior, keptPrior);
-            } else {
-                overlap = JaccardOverlap(bboxes, sizes, cls * priorsNum + prior, cls * priorsNum + keptPrior);
-            }
-            if (overlap > NMSThreshold) {
-                keep = false;
-                break;
-            }
-        }
-
-        if (keep) {
+        const int boxIdx = isShareLoc ? prior : cls * priorsNum + prior;
+        const float* box = bboxes + boxIdx * 4;
+        if (!ov::Extensions::Cpu::XARCH::nms_iou_exceeds(box, sizes[boxIdx], keptBoxes[cls], IouParams(), NMSThreshold,
+                                                         false)) {
             pindices[ndetection++] = prior;
+            keptBoxes[cls].push_back(box, sizes[boxIdx]);
         }
     }
 }
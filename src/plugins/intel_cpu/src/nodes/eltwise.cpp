@@ -6,6 +6,7 @@
 #include "common/cpu_convert.h"
 #include "common/float16.hpp"
 #include "common/primitive_hashing_utils.hpp"
+#include "cache/jit_kernel_disk_cache.h"
 #include "config.h"
 #include "cpu/ref_eltwise.hpp"
 #include "cpu_types.h"
@@ -39,6 +40,7 @@
 #include <map>
 #include <memory>
 #include <set>
+#include <sstream>
 #include <string>
 #include <vector>
 
@@ -297,33 +299,37 @@ struct jit_uni_eltwise_generic : public jit_uni_eltwise_kernel, public jit_gener
     explicit jit_uni_eltwise_generic(const jit_eltwise_params& jep,
                                      const std::vector<EltwiseData>& eltwise_data,
                                      const std::vector<ov::intel_cpu::Type>& ops_list,
-                                     const dnnl::post_ops& post_ops)
-    : jit_uni_eltwise_kernel(jep), jit_generator(jit_name()), eltwise_data_(eltwise_data), ops_list_(ops_list), post_ops_(post_ops) {}
+                                     const dnnl::post_ops& post_ops,
+                                     JitKernelDiskCache::Ptr diskCache = nullptr)
+    : jit_uni_eltwise_kernel(jep), jit_generator(jit_name()), eltwise_data_(eltwise_data), ops_list_(ops_list), post_ops_(post_ops),
+      diskCache(std::move(diskCache)) {}
 
     void create_ker() override {
+        create_emitters();
+
+        const bool cacheable = diskCache && is_position_independent();
+        const auto key = cacheable ? cacheKey() : std::string{};
+        if (cacheable)
+            cachedEntry = diskCache->load(jit_name(), key, static_cast<int>(isa));
+
         jit_generator::create_kernel();
         ker_ = (decltype(ker_))jit_ker();
+
+        if (cacheable && !cachedEntry)
+            diskCache->store(jit_name(), key, static_cast<int>(isa), jit_ker(), getSize());
+        cachedEntry.reset();
     }
 
     void generate() override {
-        auto const exec_prc = eltwise_precision_helper::get_precision(jep_.inputs_number, jep_.src_prc, eltwise_data_);
-
-        eltwise_emitter = create_eltwise_emitter(eltwise_data_.front(), exec_prc);
-        for (size_t i = 1; i < eltwise_data_.size(); ++i) {
-            post_op_emitters.push_back(create_eltwise_emitter(eltwise_data_[i], exec_prc));
-        }
-
-        const auto& p = post_ops_.get();
-        for (int i = 0; i < post_ops_.len(); ++i) {
-            if (!p->entry_[i].is_quantization()) {
-                OPENVINO_THROW("Eltwise jitter error. Unsupported post op detected");
-            }
-            quantization_injectors.push_back(std::make_shared<jit_uni_quantization_injector_f32<isa>>(
-                    this, p->entry_[i], vmm_d_weights, vmm_d_bias, reg_d_weights, reg_d_bias));
+        if (cachedEntry && JitKernelDiskCache::verify(*cachedEntry, static_cast<int>(isa))) {
+            for (const auto byte : cachedEntry->code)
+                db(byte);
+            return;
         }
+        // the entry which doesn't pass the verification is regenerated and overwritten
+        cachedEntry.reset();
 
-        if (mayiuse(avx512_core) || mayiuse(avx2_vnni_2))
-            uni_vcvtneps2bf16.reset(new jit_uni_vcvtneps2bf16(this, isa));
+        auto const exec_prc = eltwise_precision_helper::get_precision(jep_.inputs_number, jep_.src_prc, eltwise_data_);
 
         const auto &jep = jep_;
 
@@ -601,6 +607,71 @@ private:
     const std::vector<ov::intel_cpu::Type>& ops_list_;
     const dnnl::post_ops& post_ops_;
 
+    JitKernelDiskCache::Ptr diskCache;
+    JitKernelDiskCache::EntryPtr cachedEntry;
+
+    void create_emitters() {
+        auto const exec_prc = eltwise_precision_helper::get_precision(jep_.inputs_number, jep_.src_prc, eltwise_data_);
+
+        eltwise_emitter = create_eltwise_emitter(eltwise_data_.front(), exec_prc);
+        for (size_t i = 1; i < eltwise_data_.size(); ++i) {
+            post_op_emitters.push_back(create_eltwise_emitter(eltwise_data_[i], exec_prc));
+        }
+
+        const auto& p = post_ops_.get();
+        for (int i = 0; i < post_ops_.len(); ++i) {
+            if (!p->entry_[i].is_quantization()) {
+                OPENVINO_THROW("Eltwise jitter error. Unsupported post op detected");
+            }
+            quantization_injectors.push_back(std::make_shared<jit_uni_quantization_injector_f32<isa>>(
+                    this, p->entry_[i], vmm_d_weights, vmm_d_bias, reg_d_weights, reg_d_bias));
+        }
+
+        if (mayiuse(avx512_core) || mayiuse(avx2_vnni_2))
+            uni_vcvtneps2bf16.reset(new jit_uni_vcvtneps2bf16(this, isa));
+    }
+
+    // only the position independent code can be reused: the quantization injector and some of the emitters embed
+    // the absolute addresses of their tables and of the functions they call
+    bool is_position_independent() const {
+        if (!quantization_injectors.empty() || !eltwise_emitter->is_position_independent())
+            return false;
+        if (uni_vcvtneps2bf16 && !uni_vcvtneps2bf16->is_position_independent())
+            return false;
+        return std::all_of(post_op_emitters.begin(), post_op_emitters.end(), [](const std::shared_ptr<jit_emitter>& emitter) {
+            return emitter->is_position_independent();
+        });
+    }
+
+    // all the parameters the generated code depends on
+    std::string cacheKey() const {
+        std::ostringstream key;
+        key << static_cast<int>(isa) << ';' << mayiuse(avx512_core) << mayiuse(avx2_vnni_2) << ';' << jep_.inputs_number
+            << ';' << jep_.input_size << ';' << jep_.dst_prc << ';' << jep_.dst_size << ';' << jep_.oc_size << ';'
+            << jep_.work_amount << ';' << jep_.use_runtime_ptrs;
+        auto dumpDims = [&key](const VectorDims& dims) {
+            key << ';';
+            for (const auto dim : dims)
+                key << dim << ',';
+        };
+        dumpDims(jep_.dims);
+        dumpDims(jep_.dst_offsets);
+        dumpDims(jep_.oc_offsets);
+        for (size_t i = 0; i < jep_.inputs_number; i++) {
+            key << ';' << jep_.src_prc[i] << ';' << jep_.src_size[i];
+            dumpDims(jep_.src_offsets[i]);
+        }
+        for (const auto& data : eltwise_data_) {
+            // the floats are dumped bitwise to keep the key exact
+            key << ';' << static_cast<int>(data.algo) << ',' << static_cast<int>(data.onednnAlgorithm) << ','
+                << bit_cast<uint32_t>(data.alpha) << ',' << bit_cast<uint32_t>(data.beta) << ','
+                << bit_cast<uint32_t>(data.gamma);
+        }
+        for (const auto type : ops_list_)
+            key << ';' << static_cast<int>(type);
+        return key.str();
+    }
+
     std::shared_ptr<jit_emitter> create_eltwise_emitter(const EltwiseData& data, ov::element::Type exec_prec) {
         EltwiseEmitterContext ctx = {
             nullptr,
@@ -1391,7 +1462,8 @@ public:
                        const std::vector<ov::element::Type>& inpPrc,
                        const ov::element::Type& outPrc,
                        const dnnl::post_ops& post_ops,
-                       bool useRuntimePtrs) {
+                       bool useRuntimePtrs,
+                       const JitKernelDiskCache::Ptr& diskCache = nullptr) {
         auto collapseLastDims = [](std::vector<size_t>& dims, int dimsToCollapse) {
             for (size_t i = dims.size() - 2; i > dims.size() - dimsToCollapse - 2; i--) {
                 dims[dims.size() - 1] *= dims[i];
@@ -1582,11 +1654,11 @@ public:
 
 #if defined(OPENVINO_ARCH_X86_64)
         if (mayiuse(x64::avx512_core)) {
-            _pKernel.reset(new jit_uni_eltwise_generic<x64::avx512_core>(jep, eltwise_data, ops_list, post_ops));
+            _pKernel.reset(new jit_uni_eltwise_generic<x64::avx512_core>(jep, eltwise_data, ops_list, post_ops, diskCache));
         } else if (mayiuse(x64::avx2)) {
-            _pKernel.reset(new jit_uni_eltwise_generic<x64::avx2>(jep, eltwise_data, ops_list, post_ops));
+            _pKernel.reset(new jit_uni_eltwise_generic<x64::avx2>(jep, eltwise_data, ops_list, post_ops, diskCache));
         } else if (mayiuse(x64::sse41)) {
-            _pKernel.reset(new jit_uni_eltwise_generic<x64::sse41>(jep, eltwise_data, ops_list, post_ops));
+            _pKernel.reset(new jit_uni_eltwise_generic<x64::sse41>(jep, eltwise_data, ops_list, post_ops, diskCache));
         } else {
             OPENVINO_THROW("Can't create jit eltwise kernel");
         }
@@ -2013,7 +2085,7 @@ static Eltwise::executorPtr buildRefExecutor(const EltwiseKey& key) {
     }
 }
 
-static Eltwise::executorPtr buildExecutor(const EltwiseKey& key) {
+static Eltwise::executorPtr buildExecutor(const EltwiseKey& key, const JitKernelDiskCache::Ptr& diskCache) {
     if (key.implType == EltwiseImplType::reference) {
         return buildRefExecutor(key);
     }
@@ -2026,7 +2098,8 @@ static Eltwise::executorPtr buildExecutor(const EltwiseKey& key) {
                                                 key.inpPrc,
                                                 key.outPrc,
                                                 key.postOps,
-                                                key.implType == EltwiseImplType::optimizedShapeAgnostic);
+                                                key.implType == EltwiseImplType::optimizedShapeAgnostic,
+                                                diskCache);
 }
 
 bool Eltwise::isSupportedOperation(const std::shared_ptr<const ov::Node>& op, std::string& errorMessage) noexcept {
@@ -2658,8 +2731,12 @@ void Eltwise::prepareParams() {
             }
         }
 
+        auto builder = [&](const EltwiseKey& eltwiseKey) {
+            return buildExecutor(eltwiseKey, context->getJitKernelCache());
+        };
+
         auto cache = context->getParamsCache();
-        auto result = cache->getOrCreate(key, buildExecutor);
+        auto result = cache->getOrCreate(key, builder);
         execPtr = result.first;
     }
 
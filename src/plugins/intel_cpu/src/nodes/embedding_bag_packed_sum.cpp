@@ -45,9 +45,9 @@ void EmbeddingBagPackedSum::initSupportedPrimitiveDescriptors() {
     static const std::set<ov::element::Type> supportedPrecisions =
             {ov::element::f32, ov::element::i8, ov::element::u8, ov::element::i32};
 
-    auto inDataPrecision = getOriginalInputPrecisionAtPort(EMB_TABLE_IDX);
-    if (one_of(inDataPrecision, ov::element::bf16, ov::element::f16))
-        inDataPrecision = ov::element::f32;
+    const auto tablePrecision = getTablePrecision(getOriginalInputPrecisionAtPort(EMB_TABLE_IDX),
+                                                  getParentEdgeAt(EMB_TABLE_IDX)->getParent()->isConstant());
+    auto inDataPrecision = getDataPrecision(getOriginalInputPrecisionAtPort(EMB_TABLE_IDX));
     if (!supportedPrecisions.empty()) {
         if (supportedPrecisions.find(inDataPrecision) == supportedPrecisions.end())
             OPENVINO_THROW(logPrefix, "has unsupported precision: ", inDataPrecision.get_type_name());
@@ -58,7 +58,7 @@ void EmbeddingBagPackedSum::initSupportedPrimitiveDescriptors() {
             OPENVINO_THROW(logPrefix, "has unsupported precision: ", inDataPrecision.get_type_name());
     }
 
-    std::vector<PortConfigurator> inDataConfigurators({{LayoutType::ncsp, inDataPrecision},
+    std::vector<PortConfigurator> inDataConfigurators({{LayoutType::ncsp, tablePrecision},
                                                        {LayoutType::ncsp, ov::element::i32}});
     if (inputShapes.size() > PER_SAMPLE_WEIGHTS_IDX)
         inDataConfigurators.push_back({LayoutType::ncsp, inDataPrecision});
@@ -2,13 +2,16 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 
+#include <algorithm>
 #include <cmath>
+#include <numeric>
 #include <vector>
 #include <string>
 #include "dnnl_types.h"
 #include "openvino/core/parallel.hpp"
 #include "embedding_bag_sum.h"
 #include "openvino/opsets/opset1.hpp"
+#include "common/cpu_convert.h"
 #include "common/cpu_memcpy.h"
 
 namespace ov {
@@ -44,6 +47,54 @@ void EmbeddingBagSum::prepareParams(const VectorDims& indexStaticShape) {
     }
 }
 
+void EmbeddingBagSum::fuseDecompressionMultiply(const MemoryCPtr& memory) {
+    _decompressionScales.resize(memory->getShape().getElementsCount());
+    cpu_convert(memory->getData(), _decompressionScales.data(), memory->getDesc().getPrecision(),
+                ov::element::f32, _decompressionScales.size());
+}
+
+void EmbeddingBagSum::fuseDecompressionSubtract(const MemoryCPtr& memory) {
+    _decompressionZeroPoints.resize(memory->getShape().getElementsCount());
+    cpu_convert(memory->getData(), _decompressionZeroPoints.data(), memory->getDesc().getPrecision(),
+                ov::element::f32, _decompressionZeroPoints.size());
+}
+
+ov::element::Type EmbeddingBagSum::getDataPrecision(const ov::element::Type& tablePrecision) const {
+    if (withDecompression() || one_of(tablePrecision, ov::element::bf16, ov::element::f16))
+        return ov::element::f32;
+    return tablePrecision;
+}
+
+ov::element::Type EmbeddingBagSum::getTablePrecision(const ov::element::Type& tablePrecision, bool isConstantTable) const {
+    // the constant low precision tables are read as is to reduce the memory traffic
+    if (withDecompression() || (isConstantTable && one_of(tablePrecision, ov::element::bf16, ov::element::f16)))
+        return tablePrecision;
+    return getDataPrecision(tablePrecision);
+}
+
+std::vector<size_t> EmbeddingBagSum::splitBags(size_t bagsNum, size_t threadsNum) {
+    // the bag sizes may be very skewed, so the bags are split by the number of the rows instead of the bags count,
+    // the output row is counted too to not give all the empty bags to a single thread
+    std::vector<size_t> costs(bagsNum + 1lu, 0lu);
+    parallel_for(bagsNum, [&](size_t bag) {
+        const int* indices = nullptr;
+        size_t indicesSize = 0lu;
+        int weightsIdx = 0;
+        bool withWeights = false;
+        getIndices(bag, indices, indicesSize, weightsIdx, withWeights);
+        costs[bag + 1lu] = (indices != nullptr ? indicesSize : 0lu) + 1lu;
+    });
+    std::partial_sum(costs.begin(), costs.end(), costs.begin());
+
+    std::vector<size_t> bounds(threadsNum + 1lu, bagsNum);
+    bounds[0] = 0lu;
+    for (size_t ithr = 1lu; ithr < threadsNum; ithr++) {
+        const size_t cost = costs.back() * ithr / threadsNum;
+        bounds[ithr] = std::lower_bound(costs.begin(), costs.end(), cost) - costs.begin();
+    }
+    return bounds;
+}
+
 template<typename T>
 void EmbeddingBagSum::processData(const T* srcData, const T* weightsData,
                                   const VectorDims& inDataDims, const MemoryPtr& outMemory) {
@@ -54,9 +105,11 @@ void EmbeddingBagSum::processData(const T* srcData, const T* weightsData,
     const size_t outputBagsNum = outMemory->getShape().getStaticDims()[0];
     auto *dstData = outMemory->getDataAs<T>();
 
-    auto threadBody = [&](const int ithr, const int nthr) {
-        size_t start(0lu), end(0lu);
-        splitter(outputBagsNum, nthr, ithr, start, end);
+    const auto bounds = splitBags(outputBagsNum, parallel_get_max_threads());
+
+    auto threadBody = [&](const size_t ithr) {
+        const size_t start = bounds[ithr];
+        const size_t end = bounds[ithr + 1];
         if (start >= end)
             return;
 
@@ -114,16 +167,65 @@ void EmbeddingBagSum::processData(const T* srcData, const T* weightsData,
         }
     };
 
-    parallel_nt(0, threadBody);
+    parallel_for(bounds.size() - 1lu, threadBody);
+}
+
+void EmbeddingBagSum::processFloatData(const uint8_t* srcData, const float* weightsData, const ov::element::Type& srcPrc,
+                                       const VectorDims& inDataDims, const MemoryPtr& outMemory) {
+    std::string msgPrefix = std::string("Node EmbeddingBagSum with name '") + _layerName + "' ";
+
+    initFromInputs();
+
+    const size_t outputBagsNum = outMemory->getShape().getStaticDims()[0];
+    auto *dstData = outMemory->getDataAs<float>();
+
+    EmbeddingTable table;
+    table.data = srcData;
+    table.precision = srcPrc;
+    table.depth = _embDepth;
+    if (!_decompressionScales.empty()) {
+        table.scales = _decompressionScales.data();
+        table.scales_stride = _decompressionScales.size() == 1lu ? 0lu : 1lu;
+    }
+    if (!_decompressionZeroPoints.empty()) {
+        table.zero_points = _decompressionZeroPoints.data();
+        table.zero_points_stride = _decompressionZeroPoints.size() == 1lu ? 0lu : 1lu;
+    }
+
+    const auto bounds = splitBags(outputBagsNum, parallel_get_max_threads());
+
+    auto threadBody = [&](const size_t ithr) {
+        size_t indicesSize = 0lu;
+        const int* indices = nullptr;
+        int weightsIdx = 0;
+        bool withWeights = _withWeights;
+
+        for (size_t obi = bounds[ithr]; obi < bounds[ithr + 1]; obi++) {
+            getIndices(obi, indices, indicesSize, weightsIdx, withWeights);
+            if (indices == nullptr)
+                indicesSize = 0lu;
+            for (size_t inIdx = 0lu; inIdx < indicesSize; inIdx++) {
+                if (static_cast<size_t>(indices[inIdx]) >= inDataDims[0]) {
+                    OPENVINO_THROW(msgPrefix + "' has invalid embedding bag index: " + std::to_string(indices[inIdx]));
+                }
+            }
+
+            const float* weights = withWeights && _withWeights ? weightsData + weightsIdx : nullptr;
+            ov::Extensions::Cpu::XARCH::embedding_bag_accumulate(dstData + obi * _embDepth, table, indices, weights,
+                                                                indicesSize);
+        }
+    };
+
+    parallel_for(bounds.size() - 1lu, threadBody);
 }
 
 void EmbeddingBagSum::execute(const uint8_t* srcData, const uint8_t* weightsData, const ov::element::Type &srcPrc,
                               const VectorDims& inDims, const MemoryPtr& outMemory) {
+    if (withDecompression() || one_of(srcPrc, ov::element::f32, ov::element::f16, ov::element::bf16)) {
+        return processFloatData(srcData, reinterpret_cast<const float*>(weightsData), srcPrc, inDims, outMemory);
+    }
+
     switch (srcPrc) {
-        case ov::element::f32: {
-            return processData<element_type_traits<ov::element::f32>::value_type>(reinterpret_cast<const float*>(srcData),
-                    reinterpret_cast<const float*>(weightsData), inDims, outMemory);
-        }
         case ov::element::i8: {
             return processData<element_type_traits<ov::element::i8>::value_type>(reinterpret_cast<const int8_t*>(srcData),
                     reinterpret_cast<const int8_t*>(weightsData), inDims, outMemory);
@@ -5,6 +5,7 @@
 #pragma once
 
 #include "node.h"
+#include "kernels/embedding_bag/embedding_bag_kernel.hpp"
 
 namespace ov {
 namespace intel_cpu {
@@ -24,6 +25,16 @@ public:
 
     ~EmbeddingBagSum() = default;
 
+    /**
+     * @brief Fuses the dequantization of the int8 embedding table: (table - zero_point) * scale.
+     * The scale and the zero point are either per-tensor or per-row ones.
+     */
+    void fuseDecompressionMultiply(const MemoryCPtr& memory);
+    void fuseDecompressionSubtract(const MemoryCPtr& memory);
+    bool withDecompression() const {
+        return !_decompressionScales.empty();
+    }
+
 protected:
     virtual void initFromInputs() = 0;
     virtual void getIndices(
@@ -35,9 +46,17 @@ protected:
 
     void prepareParams(const VectorDims& indexStaticShape);
 
+    // the precision of the output and the per sample weights, the f16/bf16 and the decompressed tables are summed in f32
+    ov::element::Type getDataPrecision(const ov::element::Type& tablePrecision) const;
+    ov::element::Type getTablePrecision(const ov::element::Type& tablePrecision, bool isConstantTable) const;
+
     template<typename T>
     void processData(const T* srcData, const T* weightsData,
                      const VectorDims& inDataDims, const MemoryPtr& outMemory);
+    void processFloatData(const uint8_t* srcData, const float* weightsData, const ov::element::Type& srcPrc,
+                          const VectorDims& inDataDims, const MemoryPtr& outMemory);
+    // splits the bags between the threads by the number of the rows to accumulate
+    std::vector<size_t> splitBags(size_t bagsNum, size_t threadsNum);
 
     const size_t EMB_TABLE_IDX = 0lu;
     const size_t INDICES_IDX;
@@ -47,6 +66,9 @@ protected:
     bool _withWeights = false;
     size_t _embDepth = 0;
     std::string _layerName;
+
+    std::vector<float> _decompressionScales;
+    std::vector<float> _decompressionZeroPoints;
 };
 
 }   // namespace node
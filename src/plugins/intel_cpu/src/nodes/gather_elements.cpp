@@ -57,16 +57,11 @@ GatherElements::GatherElements(const std::shared_ptr<ov::Node>& op, const GraphC
 void GatherElements::prepareParams() {
     const auto& dataDims = getParentEdgeAt(dataIndex_)->getMemory().getStaticDims();
     const auto& dstDims = getChildEdgeAt(0)->getMemory().getStaticDims();
-    strideAxDst_ = 1;
+    shape_.inner = 1;
     for (size_t i = dstDims.size() - 1; i > axis_; i--)
-        strideAxDst_ *= dstDims[i];
-    dstAxDim_ = dstDims[axis_];
-    if (axis_ > 0) {
-        strideAx1Diff_ = 1;
-        for (size_t i = dataDims.size() - 1; i >= axis_; i--)
-            strideAx1Diff_ *= dataDims[i];
-        strideAx1Diff_ -= strideAxDst_ * dstDims[axis_];
-    }
+        shape_.inner *= dstDims[i];
+    shape_.data_axis_dim = dataDims[axis_];
+    shape_.dst_axis_dim = dstDims[axis_];
 }
 
 void GatherElements::initSupportedPrimitiveDescriptors() {
@@ -87,9 +82,11 @@ void GatherElements::initSupportedPrimitiveDescriptors() {
     }
 
     dataTypeSize_ = inDataPrecision.size();
+    // the kernels read both the i32 and i64 indices, so the latter aren't converted
+    indicesPrecision_ = indicesPrecision;
 
     addSupportedPrimDesc({{LayoutType::ncsp, inDataPrecision},
-                          {LayoutType::ncsp, ov::element::i32}},
+                          {LayoutType::ncsp, indicesPrecision_}},
                          {{LayoutType::ncsp, inDataPrecision}},
                          impl_desc_type::ref_any);
 }
@@ -98,50 +95,21 @@ void GatherElements::executeDynamicImpl(dnnl::stream strm) {
     execute(strm);
 }
 
-template <typename dataType>
-void GatherElements::directExecution() {
-    const auto *srcData = getSrcDataAtPortAs<const dataType>(dataIndex_);
-    const auto *indices = getSrcDataAtPortAs<const int>(indicesIndex_);
-    auto *dstData = getDstDataAtPortAs<dataType>(0);
+void GatherElements::execute(dnnl::stream strm) {
+    const auto* srcData = getSrcDataAtPort(dataIndex_);
+    const auto* indices = getSrcDataAtPort(indicesIndex_);
+    auto* dstData = getDstDataAtPort(0);
 
-    const int outSize = getChildEdgeAt(0)->getMemory().getShape().getElementsCount();
-    auto threadBody = [&](const int ithr, const int nthr) {
-        int start(0lu), end(0lu);
+    const size_t outSize = getChildEdgeAt(0)->getMemory().getShape().getElementsCount();
+    parallel_nt(0, [&](const int ithr, const int nthr) {
+        size_t start = 0lu, end = 0lu;
         splitter(outSize, nthr, ithr, start, end);
         if (start >= end)
             return;
 
-        int axStrideIt = start % strideAxDst_;
-        int dstAxIdx = (start / strideAxDst_) % dstAxDim_;
-        int dstShift0 = (start / strideAxDst_ / dstAxDim_) * strideAx1Diff_;
-
-        for (int o = start; o < end; o++, axStrideIt++) {
-            if (axStrideIt == strideAxDst_) {
-                axStrideIt = 0;
-                dstAxIdx++;
-                if (dstAxIdx == dstAxDim_) {
-                    dstAxIdx = 0;
-                    dstShift0 += strideAx1Diff_;
-                }
-            }
-            dstData[o] = srcData[o + dstShift0 + (indices[o] - dstAxIdx) * strideAxDst_];
-        }
-    };
-
-    parallel_nt(0, threadBody);
-}
-
-void GatherElements::execute(dnnl::stream strm) {
-    switch (dataTypeSize_) {
-        case sizeof(element_type_traits<ov::element::i32>::value_type):
-            return directExecution<element_type_traits<ov::element::i32>::value_type>();
-        case sizeof(element_type_traits<ov::element::i16>::value_type):
-            return directExecution<element_type_traits<ov::element::i16>::value_type>();
-        case sizeof(element_type_traits<ov::element::i8>::value_type):
-            return directExecution<element_type_traits<ov::element::i8>::value_type>();
-        default:
-            OPENVINO_THROW("Unsupported data type size");
-    }
+        ov::Extensions::Cpu::XARCH::gather_elements(dstData, srcData, indices, indicesPrecision_, dataTypeSize_, shape_,
+                                                    start, end);
+    });
 }
 
 bool GatherElements::created() const {
@@ -5,6 +5,7 @@
 #pragma once
 
 #include "node.h"
+#include "kernels/gather/gather_kernel.hpp"
 
 namespace ov {
 namespace intel_cpu {
@@ -31,13 +32,9 @@ private:
 
     size_t axis_;
     size_t dataTypeSize_ = 0;
-    int strideAxDst_ = 0;
-    int dstAxDim_ = 0;
-    int strideAx1Diff_ = 0;
+    ov::element::Type indicesPrecision_ = ov::element::i32;
+    GatherElementsShape shape_;
     std::string errorPrefix_;
-
-    template <typename dataType>
-    void directExecution();
 };
 
 }   // namespace node
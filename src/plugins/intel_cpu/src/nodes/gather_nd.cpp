@@ -11,6 +11,7 @@
 #include <openvino/opsets/opset8.hpp>
 #include "utils/general_utils.h"
 #include "common/cpu_memcpy.h"
+#include "kernels/gather/gather_kernel.hpp"
 
 #define THROW_ERROR(...) OPENVINO_THROW("GatherND layer with name '", getName(), "' ", __VA_ARGS__)
 
@@ -73,9 +74,11 @@ void GatherND::initSupportedPrimitiveDescriptors() {
                 ov::element::i32, ov::element::i64, ov::element::i16, ov::element::u16, ov::element::i8, ov::element::u8)) {
         THROW_ERROR("has unsupported 'indices' input precision: ", indicesPrecision);
     }
+    // the i64 indices are read as is, the narrower ones are converted to i32
+    attrs.indicesPrecision = indicesPrecision == ov::element::i64 ? ov::element::i64 : ov::element::i32;
 
     addSupportedPrimDesc({{LayoutType::ncsp, inDataPrecision},
-                          {LayoutType::ncsp, ov::element::i32}},
+                          {LayoutType::ncsp, attrs.indicesPrecision}},
                          {{LayoutType::ncsp, inDataPrecision}},
                          impl_desc_type::ref_any);
 }
@@ -100,7 +103,8 @@ void GatherND::prepareParams() {
     execPtr = std::make_shared<GatherNDExecutor>(attrs);
 }
 
-GatherND::GatherNDExecutor::GatherNDExecutor(const GatherNDAttributes& attrs) : sliceRank(attrs.sliceRank), dataSize(attrs.dataSize) {
+GatherND::GatherNDExecutor::GatherNDExecutor(const GatherNDAttributes& attrs)
+    : sliceRank(attrs.sliceRank), dataSize(attrs.dataSize), indicesPrecision(attrs.indicesPrecision) {
     batchSize = std::accumulate(attrs.srcDims.begin(), attrs.srcDims.begin() + attrs.batchDims, size_t(1), std::multiplies<size_t>());
     dataLength = std::accumulate(attrs.srcDims.begin() + sliceRank + attrs.batchDims, attrs.srcDims.end(), size_t(1),
                                  std::multiplies<size_t>());
@@ -134,21 +138,19 @@ void GatherND::execute(dnnl::stream strm) {
 }
 
 void GatherND::GatherNDExecutor::exec(const MemoryPtr& srcMemPtr, const MemoryPtr& idxMemPtr, const MemoryPtr& dstMemPtr) {
-    if (dataLength > 1) {
-        gatherBlocks(srcMemPtr, idxMemPtr, dstMemPtr);
-        return;
+    if (dataLength == 1) {
+        gatherElementwise(srcMemPtr, idxMemPtr, dstMemPtr);
+    } else if (indicesPrecision == ov::element::i64) {
+        gatherBlocks<int64_t>(srcMemPtr, idxMemPtr, dstMemPtr);
+    } else {
+        gatherBlocks<int32_t>(srcMemPtr, idxMemPtr, dstMemPtr);
     }
-
-    GatherNDContext ctx { this, srcMemPtr, idxMemPtr, dstMemPtr };
-    OV_SWITCH(intel_cpu, GatherNDEmitter, ctx, dataSize,
-              OV_CASE(sizeof(element_type_traits<ov::element::i32>::value_type), element_type_traits<ov::element::i32>::value_type),
-              OV_CASE(sizeof(element_type_traits<ov::element::i16>::value_type), element_type_traits<ov::element::i16>::value_type),
-              OV_CASE(sizeof(element_type_traits<ov::element::i8>::value_type), element_type_traits<ov::element::i8>::value_type));
 }
 
+template <typename idxType>
 void GatherND::GatherNDExecutor::gatherBlocks(const MemoryPtr& srcMemPtr, const MemoryPtr& idxMemPtr, const MemoryPtr& dstMemPtr) {
     const uint8_t* srcData = srcMemPtr->getDataAs<const uint8_t>();
-    const int32_t* indices = idxMemPtr->getDataAs<const int32_t>();
+    const idxType* indices = idxMemPtr->getDataAs<const idxType>();
     uint8_t* dstData = dstMemPtr->getDataAs<uint8_t>();
 
     parallel_nt(0, [&](const int ithr, const int nthr) {
@@ -161,7 +163,7 @@ void GatherND::GatherNDExecutor::gatherBlocks(const MemoryPtr& srcMemPtr, const
         size_t workCounter = start;
 
         const uint8_t* shiftedSrcData = srcData + bStart * srcBatchStride;
-        const int32_t* shiftedIndices = indices + bStart * idxBatchStride + cStart * sliceRank;
+        const idxType* shiftedIndices = indices + bStart * idxBatchStride + cStart * sliceRank;
         uint8_t* shiftedDstData = dstData + bStart * dstBatchStride + cStart * dataLength;
 
         for (size_t b = bStart; b < batchSize; b++) {
@@ -182,39 +184,30 @@ void GatherND::GatherNDExecutor::gatherBlocks(const MemoryPtr& srcMemPtr, const
     });
 }
 
-template <typename dataType>
 void GatherND::GatherNDExecutor::gatherElementwise(const MemoryPtr& srcMemPtr, const MemoryPtr& idxMemPtr, const MemoryPtr& dstMemPtr) {
-    const dataType* srcData = srcMemPtr->getDataAs<const dataType>();
-    const int32_t* indices = idxMemPtr->getDataAs<const int32_t>();
-    dataType* dstData = dstMemPtr->getDataAs<dataType>();
+    const uint8_t* srcData = srcMemPtr->getDataAs<const uint8_t>();
+    const uint8_t* indices = idxMemPtr->getDataAs<const uint8_t>();
+    uint8_t* dstData = dstMemPtr->getDataAs<uint8_t>();
+    const size_t idxSize = indicesPrecision.size();
 
     parallel_nt(0, [&](const int ithr, const int nthr) {
         size_t start(0lu), end(0lu);
         splitter(workAmount, nthr, ithr, start, end);
-        if (start >= end)
-            return;
-        size_t bStart = start / cycles;
-        size_t cStart = start % cycles;
-        size_t workCounter = start;
-
-        const dataType* shiftedSrcData = srcData + bStart * srcBatchStride;
-        const int32_t* shiftedIndices = indices + bStart * idxBatchStride + cStart * sliceRank;
-        dataType* shiftedDstData = dstData + bStart * dstBatchStride + cStart * dataLength;
-
-        for (size_t b = bStart; b < batchSize; b++) {
-            for (size_t j = cStart; j < cycles; j++) {
-                size_t dataIdx = 0lu;
-                for (size_t i = 0lu; i < sliceRank; i++)
-                    dataIdx += srcShifts[i] * shiftedIndices[i];
-                shiftedDstData[0] = shiftedSrcData[dataIdx];
-                shiftedDstData++;
-                shiftedIndices += sliceRank;
-                if (++workCounter == end) {
-                    return;
-                }
-            }
-            cStart = 0lu;
-            shiftedSrcData += srcBatchStride;
+        // the kernel processes the elements of each batch in a single call
+        while (start < end) {
+            const size_t b = start / cycles;
+            const size_t c = start % cycles;
+            const size_t count = std::min(cycles - c, end - start);
+            ov::Extensions::Cpu::XARCH::gather_nd_elementwise(dstData + (b * dstBatchStride + c) * dataSize,
+                                                              srcData + b * srcBatchStride * dataSize,
+                                                              indices + (b * idxBatchStride + c * sliceRank) * idxSize,
+                                                              indicesPrecision,
+                                                              dataSize,
+                                                              srcShifts.data(),
+                                                              sliceRank,
+                                                              srcBatchStride,
+                                                              count);
+            start += count;
         }
     });
 }
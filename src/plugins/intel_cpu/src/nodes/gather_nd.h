@@ -31,6 +31,7 @@ private:
         size_t dataSize = 1lu;
         size_t dstElementCount = 0lu;
         size_t sliceRank = 0lu;
+        ov::element::Type indicesPrecision = ov::element::i32;
 
         VectorDims srcDims;
         VectorDims srcStrides;
@@ -42,8 +43,8 @@ private:
         void exec(const MemoryPtr& srcMemPtr, const MemoryPtr& idxMemPtr, const MemoryPtr& dstMemPtr);
 
     private:
-        template <typename dataType>
         void gatherElementwise(const MemoryPtr& srcMemPtr, const MemoryPtr& idxMemPtr, const MemoryPtr& dstMemPtr);
+        template <typename idxType>
         void gatherBlocks(const MemoryPtr& srcMemPtr, const MemoryPtr& idxMemPtr, const MemoryPtr& dstMemPtr);
 
         size_t batchSize = 1lu;
@@ -52,25 +53,12 @@ private:
         size_t sliceRank = 0lu;
         size_t workAmount = 0lu;
         size_t dataSize = 1lu;
+        ov::element::Type indicesPrecision;
 
         size_t srcBatchStride = 1lu;
         size_t idxBatchStride = 1lu;
         size_t dstBatchStride = 1lu;
         VectorDims srcShifts;
-
-        struct GatherNDContext {
-            GatherNDExecutor* executor;
-            const MemoryPtr srcMemPtr;
-            const MemoryPtr idxMemPtr;
-            MemoryPtr dstMemPtr;
-        };
-
-        template<typename T>
-        struct GatherNDEmitter {
-            void operator()(GatherNDContext& ctx) {
-                ctx.executor->gatherElementwise<T>(ctx.srcMemPtr, ctx.idxMemPtr, ctx.dstMemPtr);
-            }
-        };
     };
 
     static constexpr size_t GATHERND_DATA = 0lu;
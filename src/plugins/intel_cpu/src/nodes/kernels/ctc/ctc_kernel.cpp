@@ -0,0 +1,258 @@
+// Copyright (C) 2018-2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+#include <float.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <limits>
+
+#if defined(HAVE_AVX2) || defined(HAVE_AVX512F)
+#    include <immintrin.h>
+#endif
+
+#include "ctc_kernel.hpp"
+#include "nodes/kernels/scaled_attn/softmax_kernel.hpp"
+
+namespace ov {
+namespace Extensions {
+namespace Cpu {
+namespace XARCH {
+
+namespace {
+
+constexpr float neg_inf = -std::numeric_limits<float>::infinity();
+
+inline float log_sum_exp3(float a, float b, float c) {
+    const float max = std::max(std::max(a, b), c);
+    if (max == neg_inf)
+        return neg_inf;
+    return max + std::log(std::exp(a - max) + std::exp(b - max) + std::exp(c - max));
+}
+
+// log(x) of the positive normal values, x = m * 2^e with m in [sqrt(0.5), sqrt(2)) and the cephes polynomial for
+// log(m)
+#if defined(HAVE_AVX512F)
+inline void log_ps_avx512(__m512& src) {
+    static __m512 one = _mm512_set1_ps(1.f);
+    static __m512 sqrt_half = _mm512_set1_ps(0.707106781186547524f);
+    static __m512 ln2_hi = _mm512_set1_ps(0.693359375f);
+    static __m512 ln2_lo = _mm512_set1_ps(-2.12194440e-4f);
+    static __m512 half = _mm512_set1_ps(0.5f);
+    static __m512i mantissa_mask = _mm512_set1_epi32(0x007fffff);
+    static __m512i half_bits = _mm512_set1_epi32(0x3f000000);
+    static __m512i exponent_bias = _mm512_set1_epi32(126);
+    static __m512 log_pol0 = _mm512_set1_ps(7.0376836292e-2f);
+    static __m512 log_pol1 = _mm512_set1_ps(-1.1514610310e-1f);
+    static __m512 log_pol2 = _mm512_set1_ps(1.1676998740e-1f);
+    static __m512 log_pol3 = _mm512_set1_ps(-1.2420140846e-1f);
+    static __m512 log_pol4 = _mm512_set1_ps(1.4249322787e-1f);
+    static __m512 log_pol5 = _mm512_set1_ps(-1.6668057665e-1f);
+    static __m512 log_pol6 = _mm512_set1_ps(2.0000714765e-1f);
+    static __m512 log_pol7 = _mm512_set1_ps(-2.4999993993e-1f);
+    static __m512 log_pol8 = _mm512_set1_ps(3.3333331174e-1f);
+
+    // m in [0.5, 1), e is the exponent of it
+    const auto bits = _mm512_castps_si512(src);
+    auto e = _mm512_cvtepi32_ps(_mm512_sub_epi32(_mm512_srli_epi32(bits, 23), exponent_bias));
+    const auto m = _mm512_castsi512_ps(_mm512_or_si512(_mm512_and_si512(bits, mantissa_mask), half_bits));
+
+    // m < sqrt(0.5) is doubled: x = m - 1 or 2 * m - 1
+    const auto small_mask = _mm512_cmp_ps_mask(m, sqrt_half, _CMP_LT_OS);
+    e = _mm512_mask_sub_ps(e, small_mask, e, one);
+    auto x = _mm512_sub_ps(m, one);
+    x = _mm512_mask_add_ps(x, small_mask, x, m);
+
+    const auto z = _mm512_mul_ps(x, x);
+    auto y = log_pol0;
+    y = _mm512_fmadd_ps(y, x, log_pol1);
+    y = _mm512_fmadd_ps(y, x, log_pol2);
+    y = _mm512_fmadd_ps(y, x, log_pol3);
+    y = _mm512_fmadd_ps(y, x, log_pol4);
+    y = _mm512_fmadd_ps(y, x, log_pol5);
+    y = _mm512_fmadd_ps(y, x, log_pol6);
+    y = _mm512_fmadd_ps(y, x, log_pol7);
+    y = _mm512_fmadd_ps(y, x, log_pol8);
+    y = _mm512_mul_ps(_mm512_mul_ps(y, x), z);
+
+    // log(x) = x - z / 2 + y + e * ln(2), ln(2) is split to keep the precision
+    y = _mm512_fmadd_ps(e, ln2_lo, y);
+    y = _mm512_fnmadd_ps(z, half, y);
+    x = _mm512_add_ps(x, y);
+    src = _mm512_fmadd_ps(e, ln2_hi, x);
+}
+
+// log(exp(a) + exp(b) + exp(c)), -inf where all three are -inf
+inline __m512 log_sum_exp3_avx512(__m512 a, __m512 b, __m512 c) {
+    static __m512 v_neg_inf = _mm512_set1_ps(neg_inf);
+    auto max = _mm512_max_ps(_mm512_max_ps(a, b), c);
+    const auto finite_mask = _mm512_cmp_ps_mask(max, v_neg_inf, _CMP_NEQ_OQ);
+    max = _mm512_maskz_mov_ps(finite_mask, max);
+    a = _mm512_sub_ps(a, max);
+    b = _mm512_sub_ps(b, max);
+    c = _mm512_sub_ps(c, max);
+    exp_ps_avx512(a);
+    exp_ps_avx512(b);
+    exp_ps_avx512(c);
+    auto sum = _mm512_add_ps(_mm512_add_ps(a, b), c);
+    log_ps_avx512(sum);
+    return _mm512_mask_add_ps(v_neg_inf, finite_mask, max, sum);
+}
+#elif defined(HAVE_AVX2)
+inline void log_ps_avx2(__m256& src) {
+    static __m256 one = _mm256_set1_ps(1.f);
+    static __m256 sqrt_half = _mm256_set1_ps(0.707106781186547524f);
+    static __m256 ln2_hi = _mm256_set1_ps(0.693359375f);
+    static __m256 ln2_lo = _mm256_set1_ps(-2.12194440e-4f);
+    static __m256 half = _mm256_set1_ps(0.5f);
+    static __m256i mantissa_mask = _mm256_set1_epi32(0x007fffff);
+    static __m256i half_bits = _mm256_set1_epi32(0x3f000000);
+    static __m256i exponent_bias = _mm256_set1_epi32(126);
+    static __m256 log_pol0 = _mm256_set1_ps(7.0376836292e-2f);
+    static __m256 log_pol1 = _mm256_set1_ps(-1.1514610310e-1f);
+    static __m256 log_pol2 = _mm256_set1_ps(1.1676998740e-1f);
+    static __m256 log_pol3 = _mm256_set1_ps(-1.2420140846e-1f);
+    static __m256 log_pol4 = _mm256_set1_ps(1.4249322787e-1f);
+    static __m256 log_pol5 = _mm256_set1_ps(-1.6668057665e-1f);
+    static __m256 log_pol6 = _mm256_set1_ps(2.0000714765e-1f);
+    static __m256 log_pol7 = _mm256_set1_ps(-2.4999993993e-1f);
+    static __m256 log_pol8 = _mm256_set1_ps(3.3333331174e-1f);
+
+    // m in [0.5, 1), e is the exponent of it
+    const auto bits = _mm256_castps_si256(src);
+    auto e = _mm256_cvtepi32_ps(_mm256_sub_epi32(_mm256_srli_epi32(bits, 23), exponent_bias));
+    const auto m = _mm256_castsi256_ps(_mm256_or_si256(_mm256_and_si256(bits, mantissa_mask), half_bits));
+
+    // m < sqrt(0.5) is doubled: x = m - 1 or 2 * m - 1
+    const auto small_mask = _mm256_cmp_ps(m, sqrt_half, _CMP_LT_OS);
+    e = _mm256_sub_ps(e, _mm256_and_ps(small_mask, one));
+    auto x = _mm256_sub_ps(m, one);
+    x = _mm256_add_ps(x, _mm256_and_ps(small_mask, m));
+
+    const auto z = _mm256_mul_ps(x, x);
+    auto y = log_pol0;
+    y = _mm256_fmadd_ps(y, x, log_pol1);
+    y = _mm256_fmadd_ps(y, x, log_pol2);
+    y = _mm256_fmadd_ps(y, x, log_pol3);
+    y = _mm256_fmadd_ps(y, x, log_pol4);
+    y = _mm256_fmadd_ps(y, x, log_pol5);
+    y = _mm256_fmadd_ps(y, x, log_pol6);
+    y = _mm256_fmadd_ps(y, x, log_pol7);
+    y = _mm256_fmadd_ps(y, x, log_pol8);
+    y = _mm256_mul_ps(_mm256_mul_ps(y, x), z);
+
+    // log(x) = x - z / 2 + y + e * ln(2), ln(2) is split to keep the precision
+    y = _mm256_fmadd_ps(e, ln2_lo, y);
+    y = _mm256_fnmadd_ps(z, half, y);
+    x = _mm256_add_ps(x, y);
+    src = _mm256_fmadd_ps(e, ln2_hi, x);
+}
+
+// log(exp(a) + exp(b) + exp(c)), -inf where all three are -inf
+inline __m256 log_sum_exp3_avx2(__m256 a, __m256 b, __m256 c) {
+    static __m256 v_neg_inf = _mm256_set1_ps(neg_inf);
+    auto max = _mm256_max_ps(_mm256_max_ps(a, b), c);
+    const auto finite_mask = _mm256_cmp_ps(max, v_neg_inf, _CMP_NEQ_OQ);
+    max = _mm256_and_ps(finite_mask, max);
+    a = _mm256_sub_ps(a, max);
+    b = _mm256_sub_ps(b, max);
+    c = _mm256_sub_ps(c, max);
+    exp_ps_avx2(a);
+    exp_ps_avx2(b);
+    exp_ps_avx2(c);
+    auto sum = _mm256_add_ps(_mm256_add_ps(a, b), c);
+    log_ps_avx2(sum);
+    return _mm256_blendv_ps(v_neg_inf, _mm256_add_ps(max, sum), finite_mask);
+}
+#endif
+
+}  // namespace
+
+float ctc_log_sum_exp(const float* src, size_t count) {
+    size_t i = 0;
+    float max = std::numeric_limits<float>::lowest();
+#if defined(HAVE_AVX512F)
+    auto v_max = _mm512_set1_ps(max);
+    for (; i + vec_len_f32_avx512 <= count; i += vec_len_f32_avx512) {
+        v_max = _mm512_mask_max_ps(v_max, 0xffff, _mm512_loadu_ps(src + i), v_max);
+    }
+    max = _mm512_reduce_max_ps(v_max);
+#elif defined(HAVE_AVX2)
+    auto v_max = _mm256_set1_ps(max);
+    for (; i + vec_len_f32_avx2 <= count; i += vec_len_f32_avx2) {
+        v_max = _mm256_max_ps(v_max, _mm256_loadu_ps(src + i));
+    }
+    hmax(v_max);
+    max = _mm256_cvtss_f32(v_max);
+#endif
+    for (; i < count; i++) {
+        max = std::max(max, src[i]);
+    }
+
+    i = 0;
+    float sum = 0.f;
+#if defined(HAVE_AVX512F)
+    const auto v_shift = _mm512_set1_ps(max);
+    auto v_sum = _mm512_setzero_ps();
+    for (; i + vec_len_f32_avx512 <= count; i += vec_len_f32_avx512) {
+        auto v_a = _mm512_sub_ps(_mm512_loadu_ps(src + i), v_shift);
+        exp_ps_avx512(v_a);
+        v_sum = _mm512_add_ps(v_sum, v_a);
+    }
+    sum = _mm512_reduce_add_ps(v_sum);
+#elif defined(HAVE_AVX2)
+    const auto v_shift = _mm256_set1_ps(max);
+    auto v_sum = _mm256_setzero_ps();
+    for (; i + vec_len_f32_avx2 <= count; i += vec_len_f32_avx2) {
+        auto v_a = _mm256_sub_ps(_mm256_loadu_ps(src + i), v_shift);
+        exp_ps_avx2(v_a);
+        v_sum = _mm256_add_ps(v_sum, v_a);
+    }
+    hsum(v_sum);
+    sum = _mm256_cvtss_f32(v_sum);
+#endif
+    for (; i < count; i++) {
+        sum += std::exp(src[i] - max);
+    }
+    return max + std::log(sum);
+}
+
+void ctc_backward_step(const float* next,
+                       const float* log_probs,
+                       const float* stay,
+                       const float* skip,
+                       size_t begin,
+                       size_t end,
+                       float* dst) {
+    size_t s = begin;
+#if defined(HAVE_AVX512F)
+    for (; s + vec_len_f32_avx512 <= end; s += vec_len_f32_avx512) {
+        const auto a = _mm512_add_ps(_mm512_add_ps(_mm512_loadu_ps(next + s), _mm512_loadu_ps(log_probs + s)),
+                                     _mm512_loadu_ps(stay + s));
+        const auto b = _mm512_add_ps(_mm512_loadu_ps(next + s + 1), _mm512_loadu_ps(log_probs + s + 1));
+        const auto c = _mm512_add_ps(_mm512_add_ps(_mm512_loadu_ps(next + s + 2), _mm512_loadu_ps(log_probs + s + 2)),
+                                     _mm512_loadu_ps(skip + s));
+        _mm512_storeu_ps(dst + s, log_sum_exp3_avx512(a, b, c));
+    }
+#elif defined(HAVE_AVX2)
+    for (; s + vec_len_f32_avx2 <= end; s += vec_len_f32_avx2) {
+        const auto a = _mm256_add_ps(_mm256_add_ps(_mm256_loadu_ps(next + s), _mm256_loadu_ps(log_probs + s)),
+                                     _mm256_loadu_ps(stay + s));
+        const auto b = _mm256_add_ps(_mm256_loadu_ps(next + s + 1), _mm256_loadu_ps(log_probs + s + 1));
+        const auto c = _mm256_add_ps(_mm256_add_ps(_mm256_loadu_ps(next + s + 2), _mm256_loadu_ps(log_probs + s + 2)),
+                                     _mm256_loadu_ps(skip + s));
+        _mm256_storeu_ps(dst + s, log_sum_exp3_avx2(a, b, c));
+    }
+#endif
+    for (; s < end; s++) {
+        dst[s] = log_sum_exp3(next[s] + log_probs[s] + stay[s],
+                              next[s + 1] + log_probs[s + 1],
+                              next[s + 2] + log_probs[s + 2] + skip[s]);
+    }
+}
+
+}  // namespace XARCH
+}  // namespace Cpu
+}  // namespace Extensions
+}  // namespace ov
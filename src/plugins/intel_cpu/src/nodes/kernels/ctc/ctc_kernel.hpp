@@ -0,0 +1,35 @@
+// Copyright (C) 2018-2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace ov {
+namespace Extensions {
+namespace Cpu {
+namespace XARCH {
+
+// Returns log(sum(exp(src[i]))) of the count values, the maximum is subtracted before the exponent. It is the
+// normalizer of the log softmax over the classes of a time step.
+float ctc_log_sum_exp(const float* src, size_t count);
+
+// One step of the CTC backward recursion (Graves et al., 2006, 4.1 (10)) over the extended target positions
+// [begin, end): dst[s] = log(exp(next[s] + log_probs[s] + stay[s]) + exp(next[s + 1] + log_probs[s + 1]) +
+// exp(next[s + 2] + log_probs[s + 2] + skip[s])), where next is the backward variable of the next time step and
+// log_probs are the log probabilities of the extended targets at the next time step. stay and skip are 0 where the
+// transition is allowed and -inf otherwise. next and log_probs are read up to end + 1, the positions past the
+// targets must hold -inf in next and a finite value in log_probs.
+void ctc_backward_step(const float* next,
+                       const float* log_probs,
+                       const float* stay,
+                       const float* skip,
+                       size_t begin,
+                       size_t end,
+                       float* dst);
+
+}  // namespace XARCH
+}  // namespace Cpu
+}  // namespace Extensions
+}  // namespace ov
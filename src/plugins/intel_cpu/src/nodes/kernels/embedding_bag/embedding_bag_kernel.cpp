@@ -0,0 +1,171 @@
+// Copyright (C) 2018-2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+#include <algorithm>
+#include <cstring>
+
+#if defined(HAVE_AVX2) || defined(HAVE_AVX512F)
+#    include <immintrin.h>
+#endif
+
+#include "openvino/core/except.hpp"
+#include "openvino/core/type/bfloat16.hpp"
+#include "openvino/core/type/float16.hpp"
+#include "embedding_bag_kernel.hpp"
+
+namespace ov {
+namespace Extensions {
+namespace Cpu {
+namespace XARCH {
+
+namespace {
+
+// the rows are fetched this number of the indices ahead, the gathered rows are not in the cache usually
+constexpr size_t prefetch_distance = 8;
+constexpr size_t cache_line_size = 64;
+
+#if defined(HAVE_AVX512F)
+constexpr size_t vec_len = 16;
+
+inline __m512 load_f32(const float* src) {
+    return _mm512_loadu_ps(src);
+}
+inline __m512 load_f32(const ov::float16* src) {
+    return _mm512_cvtph_ps(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(src)));
+}
+inline __m512 load_f32(const ov::bfloat16* src) {
+    auto bf16 = _mm512_cvtepu16_epi32(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(src)));
+    return _mm512_castsi512_ps(_mm512_slli_epi32(bf16, 16));
+}
+inline __m512 load_f32(const int8_t* src) {
+    return _mm512_cvtepi32_ps(_mm512_cvtepi8_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(src))));
+}
+inline __m512 load_f32(const uint8_t* src) {
+    return _mm512_cvtepi32_ps(_mm512_cvtepu8_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(src))));
+}
+#elif defined(HAVE_AVX2)
+constexpr size_t vec_len = 8;
+
+inline __m256 load_f32(const float* src) {
+    return _mm256_loadu_ps(src);
+}
+inline __m256 load_f32(const ov::float16* src) {
+    return _mm256_cvtph_ps(_mm_loadu_si128(reinterpret_cast<const __m128i*>(src)));
+}
+inline __m256 load_f32(const ov::bfloat16* src) {
+    auto bf16 = _mm256_cvtepu16_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(src)));
+    return _mm256_castsi256_ps(_mm256_slli_epi32(bf16, 16));
+}
+inline __m256 load_f32(const int8_t* src) {
+    return _mm256_cvtepi32_ps(_mm256_cvtepi8_epi32(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(src))));
+}
+inline __m256 load_f32(const uint8_t* src) {
+    return _mm256_cvtepi32_ps(_mm256_cvtepu8_epi32(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(src))));
+}
+#endif
+
+template <typename T>
+inline void prefetch_row(const T* row, size_t depth) {
+#if defined(HAVE_AVX2) || defined(HAVE_AVX512F)
+    const auto* ptr = reinterpret_cast<const char*>(row);
+    for (size_t offset = 0; offset < depth * sizeof(T); offset += cache_line_size)
+        _mm_prefetch(ptr + offset, _MM_HINT_T0);
+#endif
+}
+
+// dst += row * scale
+template <typename T>
+inline void accumulate_row(float* dst, const T* row, size_t depth, float scale) {
+    size_t i = 0;
+#if defined(HAVE_AVX512F)
+    auto v_scale = _mm512_set1_ps(scale);
+    for (; i + 2 * vec_len <= depth; i += 2 * vec_len) {
+        auto v0 = _mm512_fmadd_ps(load_f32(row + i), v_scale, _mm512_loadu_ps(dst + i));
+        auto v1 = _mm512_fmadd_ps(load_f32(row + i + vec_len), v_scale, _mm512_loadu_ps(dst + i + vec_len));
+        _mm512_storeu_ps(dst + i, v0);
+        _mm512_storeu_ps(dst + i + vec_len, v1);
+    }
+    for (; i + vec_len <= depth; i += vec_len) {
+        _mm512_storeu_ps(dst + i, _mm512_fmadd_ps(load_f32(row + i), v_scale, _mm512_loadu_ps(dst + i)));
+    }
+#elif defined(HAVE_AVX2)
+    auto v_scale = _mm256_set1_ps(scale);
+    for (; i + 2 * vec_len <= depth; i += 2 * vec_len) {
+        auto v0 = _mm256_fmadd_ps(load_f32(row + i), v_scale, _mm256_loadu_ps(dst + i));
+        auto v1 = _mm256_fmadd_ps(load_f32(row + i + vec_len), v_scale, _mm256_loadu_ps(dst + i + vec_len));
+        _mm256_storeu_ps(dst + i, v0);
+        _mm256_storeu_ps(dst + i + vec_len, v1);
+    }
+    for (; i + vec_len <= depth; i += vec_len) {
+        _mm256_storeu_ps(dst + i, _mm256_fmadd_ps(load_f32(row + i), v_scale, _mm256_loadu_ps(dst + i)));
+    }
+#endif
+    for (; i < depth; i++) {
+        dst[i] += static_cast<float>(row[i]) * scale;
+    }
+}
+
+template <typename T>
+void accumulate(float* dst,
+                const T* data,
+                const ov::intel_cpu::EmbeddingTable& table,
+                const int* indices,
+                const float* weights,
+                size_t count) {
+    const size_t depth = table.depth;
+    std::memset(dst, 0, depth * sizeof(float));
+
+    for (size_t i = 0; i < std::min(count, prefetch_distance); i++) {
+        prefetch_row(data + static_cast<size_t>(indices[i]) * depth, depth);
+    }
+
+    // the zero points don't depend on the column, so (row - zp) * scale is accumulated as row * scale - zp * scale
+    float shift = 0.f;
+    for (size_t i = 0; i < count; i++) {
+        if (i + prefetch_distance < count)
+            prefetch_row(data + static_cast<size_t>(indices[i + prefetch_distance]) * depth, depth);
+
+        const size_t row = static_cast<size_t>(indices[i]);
+        float scale = weights ? weights[i] : 1.f;
+        if (table.scales)
+            scale *= table.scales[row * table.scales_stride];
+        if (table.zero_points)
+            shift -= table.zero_points[row * table.zero_points_stride] * scale;
+
+        accumulate_row(dst, data + row * depth, depth, scale);
+    }
+
+    if (shift != 0.f) {
+        for (size_t i = 0; i < depth; i++) {
+            dst[i] += shift;
+        }
+    }
+}
+
+}  // namespace
+
+void embedding_bag_accumulate(float* dst,
+                              const ov::intel_cpu::EmbeddingTable& table,
+                              const int* indices,
+                              const float* weights,
+                              size_t count) {
+    switch (table.precision) {
+    case ov::element::f32:
+        return accumulate(dst, static_cast<const float*>(table.data), table, indices, weights, count);
+    case ov::element::f16:
+        return accumulate(dst, static_cast<const ov::float16*>(table.data), table, indices, weights, count);
+    case ov::element::bf16:
+        return accumulate(dst, static_cast<const ov::bfloat16*>(table.data), table, indices, weights, count);
+    case ov::element::i8:
+        return accumulate(dst, static_cast<const int8_t*>(table.data), table, indices, weights, count);
+    case ov::element::u8:
+        return accumulate(dst, static_cast<const uint8_t*>(table.data), table, indices, weights, count);
+    default:
+        OPENVINO_THROW("embedding_bag_accumulate doesn't support the table precision ", table.precision);
+    }
+}
+
+}  // namespace XARCH
+}  // namespace Cpu
+}  // namespace Extensions
+}  // namespace ov
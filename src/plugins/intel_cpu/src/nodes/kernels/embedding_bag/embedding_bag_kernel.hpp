@@ -0,0 +1,44 @@
+// Copyright (C) 2018-2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include "openvino/core/type/element_type.hpp"
+
+namespace ov {
+namespace intel_cpu {
+
+/**
+ * @brief Embedding table with [rows, depth] layout. The int8 tables are dequantized with the per-tensor or the
+ * per-row scales and zero points: (value - zero_point) * scale.
+ */
+struct EmbeddingTable {
+    const void* data = nullptr;
+    ov::element::Type precision;
+    size_t depth = 0;
+    const float* scales = nullptr;
+    size_t scales_stride = 0;         // 0 for the per-tensor scale, 1 for the per-row ones
+    const float* zero_points = nullptr;
+    size_t zero_points_stride = 0;
+};
+
+}  // namespace intel_cpu
+
+namespace Extensions {
+namespace Cpu {
+namespace XARCH {
+
+// Writes the weighted sum of the table rows selected by the indices to dst, the sum is accumulated in f32.
+// The indices must be valid, the weights may be nullptr.
+void embedding_bag_accumulate(float* dst,
+                              const ov::intel_cpu::EmbeddingTable& table,
+                              const int* indices,
+                              const float* weights,
+                              size_t count);
+
+}  // namespace XARCH
+}  // namespace Cpu
+}  // namespace Extensions
+}  // namespace ov
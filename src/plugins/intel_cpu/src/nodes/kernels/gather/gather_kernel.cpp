@@ -0,0 +1,368 @@
+// Copyright (C) 2018-2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+#include <algorithm>
+#include <limits>
+
+#if defined(HAVE_AVX2) || defined(HAVE_AVX512F)
+#    include <immintrin.h>
+#endif
+
+#include "openvino/core/except.hpp"
+#include "gather_kernel.hpp"
+
+namespace ov {
+namespace Extensions {
+namespace Cpu {
+namespace XARCH {
+
+namespace {
+
+#if defined(HAVE_AVX512F)
+constexpr size_t vec_len = 16;
+using vec_i32 = __m512i;
+
+inline vec_i32 set1(int32_t value) {
+    return _mm512_set1_epi32(value);
+}
+inline vec_i32 add(vec_i32 a, vec_i32 b) {
+    return _mm512_add_epi32(a, b);
+}
+inline vec_i32 mul(vec_i32 a, vec_i32 b) {
+    return _mm512_mullo_epi32(a, b);
+}
+inline vec_i32 load(const int32_t* src) {
+    return _mm512_loadu_si512(src);
+}
+inline void store(int32_t* dst, vec_i32 value) {
+    _mm512_storeu_si512(dst, value);
+}
+// (a < b) ? a : a - b for a < 2 * b
+inline vec_i32 wrap(vec_i32 a, vec_i32 b) {
+    return _mm512_mask_sub_epi32(a, _mm512_cmpge_epi32_mask(a, b), a, b);
+}
+
+inline vec_i32 load_indices(const int32_t* src) {
+    return _mm512_loadu_si512(src);
+}
+inline vec_i32 load_indices(const int64_t* src) {
+    // takes the low dwords of the i64 values
+    const auto low_dwords = _mm512_setr_epi32(0, 2, 4, 6, 8, 10, 12, 14, 16, 18, 20, 22, 24, 26, 28, 30);
+    return _mm512_permutex2var_epi32(_mm512_loadu_si512(src), low_dwords, _mm512_loadu_si512(src + vec_len / 2));
+}
+// the merging forms are used as the gcc headers leave the destinations of the plain ones uninitialized
+template <int scale>
+inline vec_i32 gather(const void* src, vec_i32 vindex) {
+    return _mm512_mask_i32gather_epi32(_mm512_setzero_si512(), 0xFFFF, vindex, src, scale);
+}
+// the low dwords of the i64 indices are gathered, the valid indices fit them
+inline vec_i32 gather_indices(const int32_t* src, vec_i32 vindex) {
+    return gather<4>(src, vindex);
+}
+inline vec_i32 gather_indices(const int64_t* src, vec_i32 vindex) {
+    return gather<8>(src, vindex);
+}
+
+// Gathers the dwords at the byte offsets not exceeding the limit, returns the mask of the skipped lanes.
+inline uint32_t gather_dwords(vec_i32& dst, const void* src, vec_i32 byte_offsets, int32_t limit) {
+    const __mmask16 in_range = _mm512_cmple_epi32_mask(byte_offsets, set1(limit));
+    dst = _mm512_mask_i32gather_epi32(_mm512_setzero_si512(), in_range, byte_offsets, src, 1);
+    return static_cast<uint16_t>(~in_range);
+}
+
+inline void store_narrow(uint16_t* dst, vec_i32 value) {
+    _mm512_mask_cvtepi32_storeu_epi16(dst, 0xFFFF, value);
+}
+inline void store_narrow(uint8_t* dst, vec_i32 value) {
+    _mm512_mask_cvtepi32_storeu_epi8(dst, 0xFFFF, value);
+}
+
+inline void gather_store(uint32_t* dst, const uint32_t* src, vec_i32 offsets, int32_t) {
+    _mm512_storeu_si512(dst, gather<4>(src, offsets));
+}
+#elif defined(HAVE_AVX2)
+constexpr size_t vec_len = 8;
+using vec_i32 = __m256i;
+
+inline vec_i32 set1(int32_t value) {
+    return _mm256_set1_epi32(value);
+}
+inline vec_i32 add(vec_i32 a, vec_i32 b) {
+    return _mm256_add_epi32(a, b);
+}
+inline vec_i32 mul(vec_i32 a, vec_i32 b) {
+    return _mm256_mullo_epi32(a, b);
+}
+inline vec_i32 load(const int32_t* src) {
+    return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src));
+}
+inline void store(int32_t* dst, vec_i32 value) {
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst), value);
+}
+// (a < b) ? a : a - b for a < 2 * b
+inline vec_i32 wrap(vec_i32 a, vec_i32 b) {
+    auto ge = _mm256_cmpgt_epi32(a, _mm256_sub_epi32(b, set1(1)));
+    return _mm256_sub_epi32(a, _mm256_and_si256(ge, b));
+}
+
+inline vec_i32 load_indices(const int32_t* src) {
+    return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src));
+}
+inline vec_i32 load_indices(const int64_t* src) {
+    // takes the low dwords of the i64 values
+    const auto low_dwords = _mm256_setr_epi32(0, 2, 4, 6, 0, 2, 4, 6);
+    auto lo = _mm256_permutevar8x32_epi32(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(src)), low_dwords);
+    auto hi = _mm256_permutevar8x32_epi32(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + vec_len / 2)),
+                                          low_dwords);
+    return _mm256_inserti128_si256(lo, _mm256_castsi256_si128(hi), 1);
+}
+// the low dwords of the i64 indices are gathered, the valid indices fit them
+inline vec_i32 gather_indices(const int32_t* src, vec_i32 vindex) {
+    return _mm256_i32gather_epi32(src, vindex, 4);
+}
+inline vec_i32 gather_indices(const int64_t* src, vec_i32 vindex) {
+    return _mm256_i32gather_epi32(reinterpret_cast<const int*>(src), vindex, 8);
+}
+
+// Gathers the dwords at the byte offsets not exceeding the limit, returns the mask of the skipped lanes.
+inline uint32_t gather_dwords(vec_i32& dst, const void* src, vec_i32 byte_offsets, int32_t limit) {
+    const auto out_of_range = _mm256_cmpgt_epi32(byte_offsets, set1(limit));
+    const auto in_range = _mm256_andnot_si256(out_of_range, set1(-1));
+    dst = _mm256_mask_i32gather_epi32(_mm256_setzero_si256(),
+                                      static_cast<const int*>(src),
+                                      byte_offsets,
+                                      in_range,
+                                      1);
+    return static_cast<uint32_t>(_mm256_movemask_ps(_mm256_castsi256_ps(out_of_range)));
+}
+
+inline void store_narrow(uint16_t* dst, vec_i32 value) {
+    auto packed = _mm256_packus_epi32(_mm256_and_si256(value, set1(0xFFFF)), value);
+    packed = _mm256_permute4x64_epi64(packed, 0x08);
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(dst), _mm256_castsi256_si128(packed));
+}
+inline void store_narrow(uint8_t* dst, vec_i32 value) {
+    auto packed = _mm256_packus_epi32(_mm256_and_si256(value, set1(0xFF)), value);
+    packed = _mm256_packus_epi16(packed, packed);
+    packed = _mm256_permutevar8x32_epi32(packed, _mm256_setr_epi32(0, 4, 0, 4, 0, 4, 0, 4));
+    _mm_storel_epi64(reinterpret_cast<__m128i*>(dst), _mm256_castsi256_si128(packed));
+}
+
+inline void gather_store(uint32_t* dst, const uint32_t* src, vec_i32 offsets, int32_t) {
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst),
+                        _mm256_i32gather_epi32(reinterpret_cast<const int*>(src), offsets, 4));
+}
+#endif
+
+#if defined(HAVE_AVX2) || defined(HAVE_AVX512F)
+// the vector paths address the data with the int32 byte offsets of the gather instructions
+constexpr size_t max_vector_bytes = static_cast<size_t>(std::numeric_limits<int32_t>::max());
+
+// The elements narrower than a dword are gathered as the dwords starting at them, so the offsets are limited by
+// (size - 4) bytes and the few lanes at the end of the data are copied separately.
+template <typename T>
+inline void gather_store(T* dst, const T* src, vec_i32 offsets, int32_t limit) {
+    const auto byte_offsets = sizeof(T) == 1 ? offsets : add(offsets, offsets);
+    vec_i32 values;
+    auto skipped = gather_dwords(values, src, byte_offsets, limit);
+    store_narrow(dst, values);
+    if (skipped) {
+        alignas(64) int32_t lane_offsets[vec_len];
+        store(lane_offsets, offsets);
+        for (size_t l = 0; l < vec_len; l++) {
+            if (skipped & (1u << l))
+                dst[l] = src[lane_offsets[l]];
+        }
+    }
+}
+
+inline int32_t gather_limit(size_t src_bytes) {
+    return static_cast<int32_t>(src_bytes) - 4;
+}
+#endif
+
+// Processes the elements [k, end) of a single outer block. The element k takes the data element
+// indices[k] * inner + k % inner of the block.
+template <typename T, typename I>
+void gather_elements_block(T* dst, const T* src, const I* indices, size_t src_size, size_t inner, size_t k, size_t end) {
+#if defined(HAVE_AVX2) || defined(HAVE_AVX512F)
+    if (end - k >= vec_len && src_size * sizeof(T) <= max_vector_bytes) {
+        const auto v_inner = set1(static_cast<int32_t>(inner));
+        const auto v_step = set1(static_cast<int32_t>(vec_len % inner));
+        const auto limit = gather_limit(src_size * sizeof(T));
+
+        // the lanes positions inside the innermost dimensions, they are advanced by vec_len every iteration
+        alignas(64) int32_t pos[vec_len];
+        for (size_t l = 0; l < vec_len; l++)
+            pos[l] = static_cast<int32_t>((k + l) % inner);
+        auto v_pos = load(pos);
+
+        for (; k + vec_len <= end; k += vec_len) {
+            auto offsets = add(mul(load_indices(indices + k), v_inner), v_pos);
+            gather_store(dst + k, src, offsets, limit);
+            v_pos = wrap(add(v_pos, v_step), v_inner);
+        }
+    }
+#endif
+    size_t pos = k % inner;
+    for (; k < end; k++) {
+        dst[k] = src[static_cast<size_t>(indices[k]) * inner + pos];
+        if (++pos == inner)
+            pos = 0;
+    }
+}
+
+template <typename T, typename I>
+void gather_elements_typed(T* dst,
+                           const T* src,
+                           const I* indices,
+                           const ov::intel_cpu::GatherElementsShape& shape,
+                           size_t start,
+                           size_t end) {
+    const size_t dst_block = shape.dst_axis_dim * shape.inner;
+    const size_t src_block = shape.data_axis_dim * shape.inner;
+    while (start < end) {
+        const size_t outer = start / dst_block;
+        const size_t block_end = std::min(dst_block, end - outer * dst_block);
+        gather_elements_block(dst + outer * dst_block,
+                              src + outer * src_block,
+                              indices + outer * dst_block,
+                              src_block,
+                              shape.inner,
+                              start - outer * dst_block,
+                              block_end);
+        start = outer * dst_block + block_end;
+    }
+}
+
+template <typename I>
+void gather_elements_impl(void* dst,
+                          const void* src,
+                          const I* indices,
+                          size_t data_size,
+                          const ov::intel_cpu::GatherElementsShape& shape,
+                          size_t start,
+                          size_t end) {
+    switch (data_size) {
+    case sizeof(uint32_t):
+        return gather_elements_typed(static_cast<uint32_t*>(dst),
+                                     static_cast<const uint32_t*>(src), indices, shape, start, end);
+    case sizeof(uint16_t):
+        return gather_elements_typed(static_cast<uint16_t*>(dst),
+                                     static_cast<const uint16_t*>(src), indices, shape, start, end);
+    case sizeof(uint8_t):
+        return gather_elements_typed(static_cast<uint8_t*>(dst),
+                                     static_cast<const uint8_t*>(src), indices, shape, start, end);
+    default:
+        OPENVINO_THROW("gather_elements doesn't support the data element size ", data_size);
+    }
+}
+
+template <typename T, typename I>
+void gather_nd_elementwise_typed(T* dst,
+                                 const T* src,
+                                 const I* indices,
+                                 const size_t* shifts,
+                                 size_t slice_rank,
+                                 size_t src_size,
+                                 size_t count) {
+    size_t j = 0;
+#if defined(HAVE_AVX2) || defined(HAVE_AVX512F)
+    if (src_size * sizeof(T) <= max_vector_bytes && vec_len * slice_rank <= max_vector_bytes) {
+        const auto limit = gather_limit(src_size * sizeof(T));
+
+        // the index tuples of the lanes are slice_rank elements apart
+        alignas(64) int32_t lanes[vec_len];
+        for (size_t l = 0; l < vec_len; l++)
+            lanes[l] = static_cast<int32_t>(l * slice_rank);
+        const auto v_lanes = load(lanes);
+
+        for (; j + vec_len <= count; j += vec_len) {
+            const I* tuples = indices + j * slice_rank;
+            auto offsets = mul(slice_rank == 1 ? load_indices(tuples) : gather_indices(tuples, v_lanes),
+                               set1(static_cast<int32_t>(shifts[0])));
+            for (size_t i = 1; i < slice_rank; i++) {
+                offsets = add(offsets, mul(gather_indices(tuples + i, v_lanes), set1(static_cast<int32_t>(shifts[i]))));
+            }
+            gather_store(dst + j, src, offsets, limit);
+        }
+    }
+#endif
+    for (; j < count; j++) {
+        const I* tuple = indices + j * slice_rank;
+        size_t offset = 0lu;
+        for (size_t i = 0lu; i < slice_rank; i++)
+            offset += shifts[i] * tuple[i];
+        dst[j] = src[offset];
+    }
+}
+
+template <typename I>
+void gather_nd_elementwise_impl(void* dst,
+                                const void* src,
+                                const I* indices,
+                                size_t data_size,
+                                const size_t* shifts,
+                                size_t slice_rank,
+                                size_t src_size,
+                                size_t count) {
+    switch (data_size) {
+    case sizeof(uint32_t):
+        return gather_nd_elementwise_typed(static_cast<uint32_t*>(dst), static_cast<const uint32_t*>(src),
+                                           indices, shifts, slice_rank, src_size, count);
+    case sizeof(uint16_t):
+        return gather_nd_elementwise_typed(static_cast<uint16_t*>(dst), static_cast<const uint16_t*>(src),
+                                           indices, shifts, slice_rank, src_size, count);
+    case sizeof(uint8_t):
+        return gather_nd_elementwise_typed(static_cast<uint8_t*>(dst), static_cast<const uint8_t*>(src),
+                                           indices, shifts, slice_rank, src_size, count);
+    default:
+        OPENVINO_THROW("gather_nd_elementwise doesn't support the data element size ", data_size);
+    }
+}
+
+}  // namespace
+
+void gather_elements(void* dst,
+                     const void* src,
+                     const void* indices,
+                     ov::element::Type indices_precision,
+                     size_t data_size,
+                     const ov::intel_cpu::GatherElementsShape& shape,
+                     size_t start,
+                     size_t end) {
+    switch (indices_precision) {
+    case ov::element::i32:
+        return gather_elements_impl(dst, src, static_cast<const int32_t*>(indices), data_size, shape, start, end);
+    case ov::element::i64:
+        return gather_elements_impl(dst, src, static_cast<const int64_t*>(indices), data_size, shape, start, end);
+    default:
+        OPENVINO_THROW("gather_elements doesn't support the indices precision ", indices_precision);
+    }
+}
+
+void gather_nd_elementwise(void* dst,
+                           const void* src,
+                           const void* indices,
+                           ov::element::Type indices_precision,
+                           size_t data_size,
+                           const size_t* shifts,
+                           size_t slice_rank,
+                           size_t src_size,
+                           size_t count) {
+    switch (indices_precision) {
+    case ov::element::i32:
+        return gather_nd_elementwise_impl(dst, src, static_cast<const int32_t*>(indices), data_size, shifts,
+                                          slice_rank, src_size, count);
+    case ov::element::i64:
+        return gather_nd_elementwise_impl(dst, src, static_cast<const int64_t*>(indices), data_size, shifts,
+                                          slice_rank, src_size, count);
+    default:
+        OPENVINO_THROW("gather_nd_elementwise doesn't support the indices precision ", indices_precision);
+    }
+}
+
+}  // namespace XARCH
+}  // namespace Cpu
+}  // namespace Extensions
+}  // namespace ov
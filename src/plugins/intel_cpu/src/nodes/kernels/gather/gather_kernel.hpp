@@ -0,0 +1,55 @@
+// Copyright (C) 2018-2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include "openvino/core/type/element_type.hpp"
+
+namespace ov {
+namespace intel_cpu {
+
+/**
+ * @brief GatherElements data and output viewed as [outer, axis_dim, inner] tensors, the output has the shape of the
+ * indices and the dimensions other than the axis are equal.
+ */
+struct GatherElementsShape {
+    size_t data_axis_dim = 0;
+    size_t dst_axis_dim = 0;
+    size_t inner = 1;         // product of the dimensions after the axis
+};
+
+}  // namespace intel_cpu
+
+namespace Extensions {
+namespace Cpu {
+namespace XARCH {
+
+// Writes the output elements [start, end) of GatherElements. The data elements have 1, 2 or 4 bytes, the indices are
+// i32 or i64 and must be valid.
+void gather_elements(void* dst,
+                     const void* src,
+                     const void* indices,
+                     ov::element::Type indices_precision,
+                     size_t data_size,
+                     const ov::intel_cpu::GatherElementsShape& shape,
+                     size_t start,
+                     size_t end);
+
+// Writes dst[j] = src[sum(indices[j * slice_rank + i] * shifts[i])] for j in [0, count), the shifts are in elements
+// and src has src_size elements. The data elements have 1, 2 or 4 bytes, the indices are i32 or i64.
+void gather_nd_elementwise(void* dst,
+                           const void* src,
+                           const void* indices,
+                           ov::element::Type indices_precision,
+                           size_t data_size,
+                           const size_t* shifts,
+                           size_t slice_rank,
+                           size_t src_size,
+                           size_t count);
+
+}  // namespace XARCH
+}  // namespace Cpu
+}  // namespace Extensions
+}  // namespace ov
@@ -0,0 +1,205 @@
+// Copyright (C) 2018-2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+#include <algorithm>
+
+#if defined(HAVE_AVX2) || defined(HAVE_AVX512F)
+#    include <immintrin.h>
+#endif
+
+#include "nms_kernel.hpp"
+
+namespace ov {
+namespace Extensions {
+namespace Cpu {
+namespace XARCH {
+
+namespace {
+
+using ov::intel_cpu::IouBoxes;
+using ov::intel_cpu::IouParams;
+
+inline float iou_scalar(const float* box, float area, const IouBoxes& boxes, size_t i, const IouParams& params) {
+    const float w0 = (std::min)(box[2], boxes.max0[i]) - (std::max)(box[0], boxes.min0[i]);
+    const float w1 = (std::min)(box[3], boxes.max1[i]) - (std::max)(box[1], boxes.min1[i]);
+    if (w0 < params.min_extent || w1 < params.min_extent)
+        return 0.f;
+    if (params.check_separation && (boxes.min0[i] > box[2] || boxes.max0[i] < box[0] || boxes.min1[i] > box[3] ||
+                                    boxes.max1[i] < box[1]))
+        return 0.f;
+    const float intersection = (w0 + params.norm) * (w1 + params.norm);
+    return intersection / (area + boxes.areas[i] - intersection);
+}
+
+// The vector IoU performs the same operations in the same order as the scalar one, the tails are processed with the
+// masked loads as the scalar code compiled for the vector ISA may contract the operations into FMA.
+#if defined(HAVE_AVX512F)
+constexpr size_t vec_len = 16;
+
+struct IouVec {
+    __m512 min0, min1, max0, max1, area, norm, min_extent;
+    bool check_separation;
+
+    IouVec(const float* box, float box_area, const IouParams& params)
+        : min0(_mm512_set1_ps(box[0])),
+          min1(_mm512_set1_ps(box[1])),
+          max0(_mm512_set1_ps(box[2])),
+          max1(_mm512_set1_ps(box[3])),
+          area(_mm512_set1_ps(box_area)),
+          norm(_mm512_set1_ps(params.norm)),
+          min_extent(_mm512_set1_ps(params.min_extent)),
+          check_separation(params.check_separation) {}
+
+    __m512 operator()(const IouBoxes& boxes, size_t i, __mmask16 mask) const {
+        // the merging forms are used as the gcc headers leave the destinations of the plain ones uninitialized
+        const auto boxes_min0 = _mm512_maskz_loadu_ps(mask, &boxes.min0[i]);
+        const auto boxes_min1 = _mm512_maskz_loadu_ps(mask, &boxes.min1[i]);
+        const auto boxes_max0 = _mm512_maskz_loadu_ps(mask, &boxes.max0[i]);
+        const auto boxes_max1 = _mm512_maskz_loadu_ps(mask, &boxes.max1[i]);
+        const auto w0 = _mm512_sub_ps(_mm512_mask_min_ps(max0, mask, max0, boxes_max0),
+                                      _mm512_mask_max_ps(min0, mask, min0, boxes_min0));
+        const auto w1 = _mm512_sub_ps(_mm512_mask_min_ps(max1, mask, max1, boxes_max1),
+                                      _mm512_mask_max_ps(min1, mask, min1, boxes_min1));
+        const auto areas = _mm512_maskz_loadu_ps(mask, &boxes.areas[i]);
+        auto valid = _mm512_mask_cmp_ps_mask(mask, w0, min_extent, _CMP_GE_OQ);
+        valid = _mm512_mask_cmp_ps_mask(valid, w1, min_extent, _CMP_GE_OQ);
+        if (check_separation) {
+            valid = _mm512_mask_cmp_ps_mask(valid, boxes_min0, max0, _CMP_LE_OQ);
+            valid = _mm512_mask_cmp_ps_mask(valid, boxes_max0, min0, _CMP_GE_OQ);
+            valid = _mm512_mask_cmp_ps_mask(valid, boxes_min1, max1, _CMP_LE_OQ);
+            valid = _mm512_mask_cmp_ps_mask(valid, boxes_max1, min1, _CMP_GE_OQ);
+        }
+        const auto intersection = _mm512_mul_ps(_mm512_add_ps(w0, norm), _mm512_add_ps(w1, norm));
+        const auto union_area = _mm512_sub_ps(_mm512_add_ps(area, areas), intersection);
+        return _mm512_maskz_div_ps(valid, intersection, union_area);
+    }
+};
+
+inline __mmask16 tail_mask(size_t count) {
+    return static_cast<__mmask16>((1u << count) - 1);
+}
+inline void store(float* dst, __m512 value, __mmask16 mask) {
+    _mm512_mask_storeu_ps(dst, mask, value);
+}
+inline bool any_greater(__m512 value, __m512 threshold, bool inclusive, __mmask16 mask) {
+    return inclusive ? _mm512_mask_cmp_ps_mask(mask, value, threshold, _CMP_GE_OQ) != 0
+                     : _mm512_mask_cmp_ps_mask(mask, value, threshold, _CMP_GT_OQ) != 0;
+}
+inline __m512 set1(float value) {
+    return _mm512_set1_ps(value);
+}
+#elif defined(HAVE_AVX2)
+constexpr size_t vec_len = 8;
+
+struct IouVec {
+    __m256 min0, min1, max0, max1, area, norm, min_extent;
+    bool check_separation;
+
+    IouVec(const float* box, float box_area, const IouParams& params)
+        : min0(_mm256_set1_ps(box[0])),
+          min1(_mm256_set1_ps(box[1])),
+          max0(_mm256_set1_ps(box[2])),
+          max1(_mm256_set1_ps(box[3])),
+          area(_mm256_set1_ps(box_area)),
+          norm(_mm256_set1_ps(params.norm)),
+          min_extent(_mm256_set1_ps(params.min_extent)),
+          check_separation(params.check_separation) {}
+
+    __m256 operator()(const IouBoxes& boxes, size_t i, __m256i mask) const {
+        const auto boxes_min0 = _mm256_maskload_ps(&boxes.min0[i], mask);
+        const auto boxes_min1 = _mm256_maskload_ps(&boxes.min1[i], mask);
+        const auto boxes_max0 = _mm256_maskload_ps(&boxes.max0[i], mask);
+        const auto boxes_max1 = _mm256_maskload_ps(&boxes.max1[i], mask);
+        const auto w0 = _mm256_sub_ps(_mm256_min_ps(max0, boxes_max0), _mm256_max_ps(min0, boxes_min0));
+        const auto w1 = _mm256_sub_ps(_mm256_min_ps(max1, boxes_max1), _mm256_max_ps(min1, boxes_min1));
+        const auto areas = _mm256_maskload_ps(&boxes.areas[i], mask);
+        auto valid = _mm256_and_ps(_mm256_castsi256_ps(mask), _mm256_cmp_ps(w0, min_extent, _CMP_GE_OQ));
+        valid = _mm256_and_ps(valid, _mm256_cmp_ps(w1, min_extent, _CMP_GE_OQ));
+        if (check_separation) {
+            valid = _mm256_and_ps(valid, _mm256_cmp_ps(boxes_min0, max0, _CMP_LE_OQ));
+            valid = _mm256_and_ps(valid, _mm256_cmp_ps(boxes_max0, min0, _CMP_GE_OQ));
+            valid = _mm256_and_ps(valid, _mm256_cmp_ps(boxes_min1, max1, _CMP_LE_OQ));
+            valid = _mm256_and_ps(valid, _mm256_cmp_ps(boxes_max1, min1, _CMP_GE_OQ));
+        }
+        const auto intersection = _mm256_mul_ps(_mm256_add_ps(w0, norm), _mm256_add_ps(w1, norm));
+        const auto union_area = _mm256_sub_ps(_mm256_add_ps(area, areas), intersection);
+        return _mm256_and_ps(valid, _mm256_div_ps(intersection, union_area));
+    }
+};
+
+inline __m256i tail_mask(size_t count) {
+    const auto lanes = _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7);
+    return _mm256_cmpgt_epi32(_mm256_set1_epi32(static_cast<int>(count)), lanes);
+}
+inline void store(float* dst, __m256 value, __m256i mask) {
+    _mm256_maskstore_ps(dst, mask, value);
+}
+inline bool any_greater(__m256 value, __m256 threshold, bool inclusive, __m256i mask) {
+    const auto greater = inclusive ? _mm256_cmp_ps(value, threshold, _CMP_GE_OQ)
+                                   : _mm256_cmp_ps(value, threshold, _CMP_GT_OQ);
+    return _mm256_movemask_ps(_mm256_and_ps(greater, _mm256_castsi256_ps(mask))) != 0;
+}
+inline __m256 set1(float value) {
+    return _mm256_set1_ps(value);
+}
+#endif
+
+}  // namespace
+
+void nms_iou(float* dst,
+             const float* box,
+             float area,
+             const ov::intel_cpu::IouBoxes& boxes,
+             size_t count,
+             const ov::intel_cpu::IouParams& params) {
+    size_t i = 0;
+#if defined(HAVE_AVX512F) || defined(HAVE_AVX2)
+    const IouVec iou(box, area, params);
+    const auto full = tail_mask(vec_len);
+    for (; i + vec_len <= count; i += vec_len) {
+        store(dst + i, iou(boxes, i, full), full);
+    }
+    if (i < count) {
+        const auto mask = tail_mask(count - i);
+        store(dst + i, iou(boxes, i, mask), mask);
+        i = count;
+    }
+#endif
+    for (; i < count; i++) {
+        dst[i] = iou_scalar(box, area, boxes, i, params);
+    }
+}
+
+bool nms_iou_exceeds(const float* box,
+                     float area,
+                     const ov::intel_cpu::IouBoxes& boxes,
+                     const ov::intel_cpu::IouParams& params,
+                     float threshold,
+                     bool inclusive) {
+    const size_t count = boxes.size();
+    size_t i = 0;
+#if defined(HAVE_AVX512F) || defined(HAVE_AVX2)
+    const IouVec iou(box, area, params);
+    const auto vec_threshold = set1(threshold);
+    const auto full = tail_mask(vec_len);
+    for (; i + vec_len <= count; i += vec_len) {
+        if (any_greater(iou(boxes, i, full), vec_threshold, inclusive, full))
+            return true;
+    }
+    if (i < count) {
+        const auto mask = tail_mask(count - i);
+        return any_greater(iou(boxes, i, mask), vec_threshold, inclusive, mask);
+    }
+#endif
+    for (; i < count; i++) {
+        const float value = iou_scalar(box, area, boxes, i, params);
+        if (inclusive ? value >= threshold : value > threshold)
+            return true;
+    }
+    return false;
+}
+
+}  // namespace XARCH
+}  // namespace Cpu
+}  // namespace Extensions
+}  // namespace ov
@@ -0,0 +1,92 @@
+// Copyright (C) 2018-2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+namespace ov {
+namespace intel_cpu {
+
+/**
+ * @brief Boxes in the structure of arrays layout for the vectorized IoU computation. The boxes are the minimums and
+ * the maximums along two axes, the axes order is the node's one and it's the same for all the boxes. The areas are
+ * computed by the nodes as the nodes differ in the handling of the not normalized and the degenerate boxes.
+ */
+struct IouBoxes {
+    std::vector<float> min0;
+    std::vector<float> min1;
+    std::vector<float> max0;
+    std::vector<float> max1;
+    std::vector<float> areas;
+
+    void reserve(size_t capacity) {
+        min0.reserve(capacity);
+        min1.reserve(capacity);
+        max0.reserve(capacity);
+        max1.reserve(capacity);
+        areas.reserve(capacity);
+    }
+    void clear() {
+        min0.clear();
+        min1.clear();
+        max0.clear();
+        max1.clear();
+        areas.clear();
+    }
+    // box is {min0, min1, max0, max1}
+    void push_back(const float* box, float area) {
+        min0.push_back(box[0]);
+        min1.push_back(box[1]);
+        max0.push_back(box[2]);
+        max1.push_back(box[3]);
+        areas.push_back(area);
+    }
+    size_t size() const {
+        return areas.size();
+    }
+};
+
+/**
+ * @brief IoU of two boxes with the areas a and b is
+ *     (w0 + norm) * (w1 + norm) / (a + b - (w0 + norm) * (w1 + norm))
+ * where w0 and w1 are the extents of the boxes intersection: min(max0) - max(min0) and min(max1) - max(min1).
+ * The IoU is 0 if any of the extents is less than min_extent or, with check_separation, if the boxes are separated
+ * along any axis: min0 of a box is greater than max0 of the other or min1 is greater than max1. The two conditions
+ * differ only for the boxes with min greater than max. The nodes which treat the boxes with the not positive areas
+ * as not overlapping any box check the areas themselves.
+ */
+struct IouParams {
+    float norm = 0.f;         // 1 for the not normalized boxes
+    float min_extent = 0.f;
+    bool check_separation = false;
+};
+
+}  // namespace intel_cpu
+
+namespace Extensions {
+namespace Cpu {
+namespace XARCH {
+
+// Writes the IoU of the box {min0, min1, max0, max1} with the area and each of the first count boxes to dst.
+void nms_iou(float* dst,
+             const float* box,
+             float area,
+             const ov::intel_cpu::IouBoxes& boxes,
+             size_t count,
+             const ov::intel_cpu::IouParams& params);
+
+// Checks if the IoU of the box {min0, min1, max0, max1} with the area and any of the boxes is greater than the
+// threshold, or greater or equal to it if inclusive is set.
+bool nms_iou_exceeds(const float* box,
+                     float area,
+                     const ov::intel_cpu::IouBoxes& boxes,
+                     const ov::intel_cpu::IouParams& params,
+                     float threshold,
+                     bool inclusive);
+
+}  // namespace XARCH
+}  // namespace Cpu
+}  // namespace Extensions
+}  // namespace ov
@@ -0,0 +1,117 @@
+// Copyright (C) 2018-2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+#include <algorithm>
+#include <vector>
+
+#if defined(HAVE_AVX2) || defined(HAVE_AVX512F)
+#    include <immintrin.h>
+#endif
+
+#include "topk_sampling_kernel.hpp"
+
+namespace ov {
+namespace Extensions {
+namespace Cpu {
+namespace XARCH {
+
+namespace {
+
+struct Candidate {
+    float value;
+    int32_t index;
+};
+
+// the heap keeps the worst selected candidate at the front
+inline bool ranks_before(const Candidate& a, const Candidate& b) {
+    return a.value > b.value || (a.value == b.value && a.index < b.index);
+}
+
+#if defined(HAVE_AVX512F)
+constexpr size_t vec_len = 16;
+
+inline uint32_t greater_mask(const float* src, float threshold) {
+    return _mm512_cmp_ps_mask(_mm512_loadu_ps(src), _mm512_set1_ps(threshold), _CMP_GT_OQ);
+}
+#elif defined(HAVE_AVX2)
+constexpr size_t vec_len = 8;
+
+inline uint32_t greater_mask(const float* src, float threshold) {
+    return _mm256_movemask_ps(_mm256_cmp_ps(_mm256_loadu_ps(src), _mm256_set1_ps(threshold), _CMP_GT_OQ));
+}
+#endif
+
+class CandidatesHeap {
+public:
+    CandidatesHeap(const float* src, size_t k, int32_t index_offset) : m_index_offset(index_offset) {
+        m_heap.reserve(k);
+        for (size_t i = 0; i < k; i++) {
+            m_heap.push_back({src[i], index_offset + static_cast<int32_t>(i)});
+        }
+        std::make_heap(m_heap.begin(), m_heap.end(), ranks_before);
+    }
+
+    float threshold() const {
+        return m_heap.front().value;
+    }
+
+    // the later values are selected only if they are greater than the worst selected one as their indices are greater
+    void push(float value, size_t i) {
+        if (!(value > m_heap.front().value))
+            return;
+        std::pop_heap(m_heap.begin(), m_heap.end(), ranks_before);
+        m_heap.back() = {value, m_index_offset + static_cast<int32_t>(i)};
+        std::push_heap(m_heap.begin(), m_heap.end(), ranks_before);
+    }
+
+    void store(float* values, int32_t* indices) const {
+        for (size_t i = 0; i < m_heap.size(); i++) {
+            values[i] = m_heap[i].value;
+            indices[i] = m_heap[i].index;
+        }
+    }
+
+private:
+    std::vector<Candidate> m_heap;
+    int32_t m_index_offset;
+};
+
+}  // namespace
+
+size_t topk_sampling_candidates(const float* src,
+                                size_t count,
+                                size_t k,
+                                int32_t index_offset,
+                                float* values,
+                                int32_t* indices) {
+    k = std::min(k, count);
+    if (k == 0)
+        return 0;
+
+    CandidatesHeap heap(src, k, index_offset);
+    size_t i = k;
+#if defined(HAVE_AVX512F) || defined(HAVE_AVX2)
+    // the threshold grows quickly, so most of the vectors have no value greater than it and are skipped
+    float threshold = heap.threshold();
+    for (; i + vec_len <= count; i += vec_len) {
+        const uint32_t mask = greater_mask(src + i, threshold);
+        if (mask == 0)
+            continue;
+        for (size_t lane = 0; lane < vec_len; lane++) {
+            if (mask & (1u << lane))
+                heap.push(src[i + lane], i + lane);
+        }
+        threshold = heap.threshold();
+    }
+#endif
+    for (; i < count; i++) {
+        heap.push(src[i], i);
+    }
+    heap.store(values, indices);
+    return k;
+}
+
+}  // namespace XARCH
+}  // namespace Cpu
+}  // namespace Extensions
+}  // namespace ov
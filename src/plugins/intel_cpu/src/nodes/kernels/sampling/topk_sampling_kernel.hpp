@@ -0,0 +1,27 @@
+// Copyright (C) 2018-2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace ov {
+namespace Extensions {
+namespace Cpu {
+namespace XARCH {
+
+// Selects the k greatest of the count values, the ties are resolved in favour of the lower indices. The selected
+// values and their indices increased by index_offset are written to values and indices in no particular order.
+// Returns the number of the selected values, min(k, count).
+size_t topk_sampling_candidates(const float* src,
+                                size_t count,
+                                size_t k,
+                                int32_t index_offset,
+                                float* values,
+                                int32_t* indices);
+
+}  // namespace XARCH
+}  // namespace Cpu
+}  // namespace Extensions
+}  // namespace ov
@@ -14,6 +14,7 @@
 #include <utility>
 #include <vector>
 
+#include "kernels/nms/nms_kernel.hpp"
 #include "openvino/core/parallel.hpp"
 #include "utils/general_utils.h"
 #include "shape_inference/shape_inference_internal_dyn.hpp"
@@ -579,30 +580,43 @@ void MultiClassNms::nmsWithoutEta(const float* boxes,
 
             int io_selection_size = 0;
             if (sorted_boxes.size() > 0) {
-                parallel_sort(sorted_boxes.begin(), sorted_boxes.end(), [](const std::pair<float, int>& l, const std::pair<float, int>& r) {
-                    return (l.first > r.first || ((l.first == r.first) && (l.second < r.second)));
-                });
-                int offset = batch_idx * m_numClasses * m_nmsRealTopk + class_idx * m_nmsRealTopk;
-                m_filtBoxes[offset + 0] = filteredBoxes(sorted_boxes[0].first, batch_idx, class_idx, sorted_boxes[0].second);
-                io_selection_size++;
+                // only the first nms_top_k boxes are visited, so the rest ones are not ordered
                 int max_out_box =
                     (static_cast<size_t>(m_nmsRealTopk) > sorted_boxes.size()) ? sorted_boxes.size() : m_nmsRealTopk;
-                for (int box_idx = 1; box_idx < max_out_box; box_idx++) {
-                    bool box_is_selected = true;
-                    for (int idx = io_selection_size - 1; idx >= 0; idx--) {
-                        float iou = intersectionOverUnion(&boxesPtr[sorted_boxes[box_idx].second * 4],
-                            &boxesPtr[m_filtBoxes[offset + idx].box_index * 4], m_normalized);
-                        if (iou >= m_iouThreshold) {
-                            box_is_selected = false;
-                            break;
-                        }
-                    }
+                std::partial_sort(sorted_boxes.begin(), sorted_boxes.begin() + max_out_box, sorted_boxes.end(),
+                    [](const std::pair<float, int>& l, const std::pair<float, int>& r) {
+                        return (l.first > r.first || ((l.first == r.first) && (l.second < r.second)));
+                    });
+
+                // the boxes with the not positive areas don't overlap any box, so they are not stored as the
+                // suppressing ones. The IoU of any pair of boxes (even 0 for the degenerate ones) reaches the not
+                // positive threshold, so only the first box is selected in that case.
+                const bool suppressAll = m_iouThreshold <= 0.f;
+                const float norm = static_cast<float>(m_normalized == false);
+                IouParams iouParams;
+                iouParams.norm = norm;
+                iouParams.min_extent = -norm;
+                auto boxArea = [norm](const float* box) {
+                    return (box[2] - box[0] + norm) * (box[3] - box[1] + norm);
+                };
+                IouBoxes selectedBoxes;
+                selectedBoxes.reserve(max_out_box);
 
-                    if (box_is_selected) {
-                        m_filtBoxes[offset + io_selection_size] = filteredBoxes(sorted_boxes[box_idx].first, batch_idx, class_idx,
-                            sorted_boxes[box_idx].second);
-                        io_selection_size++;
-                    }
+                int offset = batch_idx * m_numClasses * m_nmsRealTopk + class_idx * m_nmsRealTopk;
+                for (int box_idx = 0; box_idx < max_out_box; box_idx++) {
+                    const float* box = &boxesPtr[sorted_boxes[box_idx].second * 4];
+                    const float area = boxArea(box);
+                    if (io_selection_size > 0 && suppressAll)
+                        break;
+                    if (area > 0.f && ov::Extensions::Cpu::XARCH::nms_iou_exceeds(box, area, selectedBoxes, iouParams,
+                                                                                  m_iouThreshold, true))
+                        continue;
+
+                    m_filtBoxes[offset + io_selection_size] = filteredBoxes(sorted_boxes[box_idx].first, batch_idx, class_idx,
+                        sorted_boxes[box_idx].second);
+                    io_selection_size++;
+                    if (area > 0.f)
+                        selectedBoxes.push_back(box, area);
                 }
             }
             m_numFiltBox[batch_idx][class_idx] = io_selection_size;
@@ -11,6 +11,7 @@
 #include "dnnl_extension_utils.h"
 #include "memory_desc/dnnl_blocked_memory_desc.h"
 #include "common/primitive_hashing_utils.hpp"
+#include <algorithm>
 #include <memory>
 #include "shape_inference/shape_inference_ngraph.hpp"
 #include "transformations/utils/utils.hpp"
@@ -1157,19 +1158,19 @@ void RNN::prepareParams() {
 
     if (!primArgs.count(DNNL_ARG_WEIGHTS_LAYER) || !prevExecPtr ||
         !execPtr->getWeightDesc()->isCompatible(*(prevExecPtr->getWeightDesc()))) {
-        prepareMemory(execPtr->getWeightDesc(), 0);
+        prepareWeights(execPtr->getWeightDesc(), 0);
         primArgs[DNNL_ARG_WEIGHTS_LAYER] = internalBlobMemory[0]->getPrimitive();
     }
 
     if (!primArgs.count(DNNL_ARG_WEIGHTS_ITER) || !prevExecPtr ||
         !execPtr->getWeightIterDesc()->isCompatible(*(prevExecPtr->getWeightIterDesc()))) {
-        prepareMemory(execPtr->getWeightIterDesc(), 1);
+        prepareWeights(execPtr->getWeightIterDesc(), 1);
         primArgs[DNNL_ARG_WEIGHTS_ITER] = internalBlobMemory[1]->getPrimitive();
     }
 
     if (!primArgs.count(DNNL_ARG_BIAS) || !prevExecPtr ||
         !execPtr->getBiasDesc()->isCompatible(*(prevExecPtr->getBiasDesc()))) {
-        prepareMemory(execPtr->getBiasDesc(), 2);
+        prepareWeights(execPtr->getBiasDesc(), 2);
         primArgs[DNNL_ARG_BIAS] = internalBlobMemory[2]->getPrimitive();
     }
 
@@ -1177,6 +1178,44 @@ void RNN::prepareParams() {
     primArgs[DNNL_ARG_SCRATCHPAD] = scratchpadMem->getPrimitive();
 }
 
+void RNN::prepareWeights(const DnnlMemoryDescPtr& desc, size_t idx) {
+    if (preparedWeights.size() <= idx)
+        preparedWeights.resize(idx + 1);
+    auto& prepared = preparedWeights[idx];
+
+    auto it = std::find_if(prepared.begin(), prepared.end(),
+                           [&desc](const std::pair<DnnlMemoryDescPtr, MemoryPtr>& item) {
+                               return item.first->isCompatible(*desc);
+                           });
+    if (it != prepared.end()) {
+        if (internalBlobMemory.size() <= idx)
+            internalBlobMemory.resize(idx + 1);
+        internalBlobMemory[idx] = it->second;
+        // the most recently used layout goes last, so the least recently used one is evicted first
+        std::rotate(it, std::next(it), prepared.end());
+        return;
+    }
+
+    prepareMemory(desc, idx);
+    // the blocked layouts are kept by the weights cache, it is shared by the streams and keyed by the layout, only the
+    // packed ones bypassing it are kept here
+    if (context->getWeightsCache() && desc->getDnnlDesc().get_format_kind() == dnnl::memory::format_kind::blocked)
+        return;
+
+    // the copies of the weights are bounded by the size of the original weights, so a sequence length changing each
+    // time doesn't grow the memory, the current layout is kept anyway as it is used by the primitive
+    const size_t limit = maxPreparedWeightsCopies * internalBlobs[idx]->getSize();
+    size_t size = internalBlobMemory[idx]->getSize();
+    for (const auto& item : prepared)
+        size += item.second->getSize();
+    auto evicted = prepared.begin();
+    for (; evicted != prepared.end() && size > limit; evicted++)
+        size -= evicted->second->getSize();
+    prepared.erase(prepared.begin(), evicted);
+    if (size <= limit)
+        prepared.emplace_back(desc, internalBlobMemory[idx]);
+}
+
 std::shared_ptr<MemoryDesc> RNN::getSrcMemDesc(const dnnl::primitive_desc& prim_desc, size_t idx) const {
     (void) prim_desc;
     return supportedPrimitiveDescriptors[0].getConfig().inConfs[idx].getMemDesc();
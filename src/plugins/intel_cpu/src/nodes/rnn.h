@@ -67,6 +67,7 @@ private:
     void fillBiases(const int* gate_map);
 
     void copyWeightsData();
+    void prepareWeights(const DnnlMemoryDescPtr& desc, size_t idx);
 
     class RnnDnnlExecutor : public DnnlExecutor {
         public:
@@ -88,6 +89,12 @@ private:
     using executorPtr = std::shared_ptr<RnnDnnlExecutor>;
     executorPtr execPtr = nullptr;
 
+    /** The packed weights reordered for the recent primitives, per internal blob, the least recently used first. The
+     *  packed layout depends on the batch and the sequence length, so the chunks of a varying length would repack
+     *  them on each change. The total size is limited by the number of the copies of the original weights. */
+    std::vector<std::vector<std::pair<DnnlMemoryDescPtr, MemoryPtr>>> preparedWeights;
+    static constexpr size_t maxPreparedWeightsCopies = 4lu;
+
     /** Specify mode Cell or Seq. true - Cell, false - Seq */
     bool is_cell = false;
 
@@ -15,6 +15,7 @@
 
 #include <algorithm>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 using namespace dnnl;
@@ -338,6 +339,20 @@ struct TensorIterator {
     const size_t m_squashed_axis;
 };
 
+// The lines along the axis are processed by the threads independently. If there are fewer lines than threads and
+// enough updates, the updates are partitioned between the threads by their destinations instead.
+constexpr size_t min_partitioned_updates_per_thread = 256;
+
+static bool partitionByDestination(size_t lines, size_t updates) {
+    const auto nthr = static_cast<size_t>(parallel_get_max_threads());
+    return nthr > 1 && lines < nthr && updates >= nthr * min_partitioned_updates_per_thread;
+}
+
+template <typename KernelType>
+struct is_mean_reduction : std::false_type {};
+template <>
+struct is_mean_reduction<ReduceMean> : std::true_type {};
+
 struct ScatterElementsUpdateContext {
     ScatterUpdate* node;
     MemoryPtr dstMemPtr;
@@ -412,6 +427,11 @@ void ScatterUpdate::scatterElementsUpdate(const MemoryPtr& mem_data, const Memor
     VectorDims squashed_indices_shape(indices_shape);
     squashed_indices_shape[axis] = 1;
 
+    if (partitionByDestination(shape_size(squashed_indices_shape), shape_size(indices_shape))) {
+        scatterElementsUpdateByDestination<DataType>(mem_data, mem_indices, mem_updates, axis, kernel);
+        return;
+    }
+
     const std::vector<size_t> dataBlockND = getBlockND(data_shape);
     const std::vector<size_t> indicesBlockND = getBlockND(indices_shape);
     const size_t dataBlock_axisplus1 = dataBlockND[axis + 1];
@@ -525,6 +545,11 @@ void ScatterUpdate::scatterElementsUpdate(const MemoryPtr& mem_data, const Memor
     VectorDims squashed_indices_shape(indices_shape);
     squashed_indices_shape[axis] = 1;
 
+    if (partitionByDestination(shape_size(squashed_indices_shape), shape_size(indices_shape))) {
+        scatterElementsUpdateByDestination<DataType>(mem_data, mem_indices, mem_updates, axis, kernel);
+        return;
+    }
+
     const std::vector<size_t> dataBlockND = getBlockND(data_shape);
     const std::vector<size_t> indicesBlockND = getBlockND(indices_shape);
     const size_t dataBlock_axisplus1 = dataBlockND[axis + 1];
@@ -638,6 +663,121 @@ void ScatterUpdate::scatterElementsUpdate(const MemoryPtr& mem_data, const Memor
     });
 }
 
+// The updates are bucketed by the threads owning their destinations with a counting sort. It keeps the order of the
+// updates of every destination, so the results are the same as the ones of the serial processing.
+template <typename DataType, typename KernelType>
+void ScatterUpdate::scatterElementsUpdateByDestination(const MemoryPtr& mem_data, const MemoryPtr& mem_indices,
+                                                       const MemoryPtr& mem_updates, int axis, const KernelType& kernel) {
+    using namespace scatter_elements_update;
+    DataType *dataPtr = mem_data->getDataAs<DataType>();
+    DataType *updatePtr = mem_updates->getDataAs<DataType>();
+    uint8_t *indicesPtr = mem_indices->getDataAs<uint8_t>();
+
+    const auto& data_shape = mem_data->getStaticDims();
+    const auto& indices_shape = mem_indices->getStaticDims();
+    const int64_t data_dim_size = static_cast<int64_t>(data_shape[axis]);
+    const size_t index_dim_size = indices_shape[axis];
+
+    VectorDims squashed_indices_shape(indices_shape);
+    squashed_indices_shape[axis] = 1;
+
+    const std::vector<size_t> dataBlockND = getBlockND(data_shape);
+    const std::vector<size_t> indicesBlockND = getBlockND(indices_shape);
+    const size_t dataBlock_axisplus1 = dataBlockND[axis + 1];
+    const size_t indicesBlock_axisplus1 = indicesBlockND[axis + 1];
+
+    // the dst and indices offsets of the lines along the axis
+    const size_t lines = shape_size(squashed_indices_shape);
+    std::vector<std::array<size_t, 2>> line_offsets(lines);
+    scatter_elements_update::TensorIterator tensorItr(squashed_indices_shape, axis);
+    auto offsets = tensorItr.startover(0, dataBlockND, indicesBlockND);
+    for (size_t line = 0; line < lines; line++) {
+        line_offsets[line] = offsets;
+        tensorItr.increment(offsets, dataBlockND, indicesBlockND);
+    }
+
+    auto dst_offset = [&](size_t line, size_t idx) {
+        int64_t idxValue = getIndicesValue(indicesPtr, line_offsets[line][1] + idx * indicesBlock_axisplus1);
+        if (idxValue < 0) idxValue += data_dim_size;
+        assert(idxValue < data_dim_size && idxValue >= 0);
+        return line_offsets[line][0] + idxValue * dataBlock_axisplus1;
+    };
+
+    // the updates are enumerated line by line and split into the chunks bucketed by the threads, the thread 'owner'
+    // applies the updates of the destinations [owner * owner_block, (owner + 1) * owner_block)
+    const size_t nthr = static_cast<size_t>(parallel_get_max_threads());
+    const size_t updates = lines * index_dim_size;
+    const size_t owner_block = div_up(dataBlockND[0], nthr);
+
+    // the bucket sizes, they are replaced by the bucket offsets in the [owner, chunk] order
+    std::vector<size_t> buckets(nthr * nthr, 0);
+    parallel_for(nthr, [&](size_t chunk) {
+        size_t start = 0, end = 0;
+        splitter(updates, nthr, chunk, start, end);
+        std::vector<size_t> counts(nthr, 0);
+        for (size_t u = start, line = start / index_dim_size, idx = start % index_dim_size; u < end; u++) {
+            counts[dst_offset(line, idx) / owner_block]++;
+            if (++idx == index_dim_size) {
+                idx = 0;
+                line++;
+            }
+        }
+        for (size_t owner = 0; owner < nthr; owner++)
+            buckets[owner * nthr + chunk] = counts[owner];
+    });
+    size_t bucket_offset = 0;
+    for (auto& bucket : buckets) {
+        const auto count = bucket;
+        bucket = bucket_offset;
+        bucket_offset += count;
+    }
+
+    // (dst offset, update offset) pairs
+    std::vector<std::pair<size_t, size_t>> bucketed(updates);
+    parallel_for(nthr, [&](size_t chunk) {
+        size_t start = 0, end = 0;
+        splitter(updates, nthr, chunk, start, end);
+        std::vector<size_t> positions(nthr);
+        for (size_t owner = 0; owner < nthr; owner++)
+            positions[owner] = buckets[owner * nthr + chunk];
+        for (size_t u = start, line = start / index_dim_size, idx = start % index_dim_size; u < end; u++) {
+            const size_t dst = dst_offset(line, idx);
+            bucketed[positions[dst / owner_block]++] = {dst, line_offsets[line][1] + idx * indicesBlock_axisplus1};
+            if (++idx == index_dim_size) {
+                idx = 0;
+                line++;
+            }
+        }
+    });
+
+    parallel_for(nthr, [&](size_t owner) {
+        const size_t begin = buckets[owner * nthr];
+        const size_t end = owner + 1 < nthr ? buckets[(owner + 1) * nthr] : updates;
+
+        // When *use_init_val* attribute is false, we need to substitute the copied values at target locations with values that
+        // will not affect the particular reduction algorithms.
+        if (!use_init_val) {
+            const auto value = reduction_neutral_value<DataType>(reduction_type);
+            for (size_t i = begin; i < end; i++)
+                dataPtr[bucketed[i].first] = value;
+        }
+
+        for (size_t i = begin; i < end; i++)
+            kernel(&dataPtr[bucketed[i].first], &updatePtr[bucketed[i].second]);
+
+        if (is_mean_reduction<KernelType>::value) {
+            std::unordered_map<size_t, int64_t> mean_reduction_counters;  // (dst offset, num_sums) for the owner
+            for (size_t i = begin; i < end; i++)
+                mean_reduction_counters[bucketed[i].first] += 1;
+            for (const auto& counter : mean_reduction_counters) {
+                auto dst = &dataPtr[counter.first];
+                const auto N = counter.second + static_cast<int32_t>(use_init_val);
+                *dst = static_cast<DataType>(static_cast<double>(*dst) / N);
+            }
+        }
+    });
+}
+
 void ScatterUpdate::scatterElementsUpdate(const MemoryPtr& dstMemPtr, const MemoryPtr& indicesMemPtr, const MemoryPtr& updateMemPtr, int axis) {
     using namespace scatter_elements_update;
     ScatterElementsUpdateContext ctx{this, dstMemPtr, indicesMemPtr, updateMemPtr, axis, reduction_type};
@@ -12,6 +12,7 @@
 #include "utils/general_utils.h"
 #include "utils/debug_capabilities.h"
 
+#include <algorithm>
 #include <string>
 #include <vector>
 
@@ -75,6 +76,28 @@ static void nullifyUndefinedDims(VectorDims& dims) {
     });
 }
 
+bool PortMapHelper::uses(const MemoryPtr& from, const MemoryPtr& to) const {
+    return from->getPrimitive() == mem_holder_src && to->getPrimitive() == mem_holder_dst;
+}
+
+void PortMapHelper::prepareTransfer(MultiCachePtr cache) {
+    const auto& src_desc = mem_holder_src.get_desc();
+    const auto& dst_desc = mem_holder_dst.get_desc();
+    if (src_desc == dst_desc && dnnl::impl::memory_desc_wrapper(src_desc.get()).is_dense()) {
+        copy_size = src_desc.get_size();
+    } else {
+        reorder = getReorderPrim(cache, mem_holder_dst.get_engine(), src_desc, dst_desc);
+    }
+}
+
+void PortMapHelper::transfer(dnnl::stream strm) {
+    if (copy_size) {
+        cpu_memcpy(mem_holder_dst.get_data_handle(), mem_holder_src.get_data_handle(), copy_size);
+    } else {
+        reorder.execute(strm, {{DNNL_ARG_FROM, mem_holder_src}, {DNNL_ARG_TO, mem_holder_dst}});
+    }
+}
+
 class PortIteratorHelper : public PortMapHelper {
 public:
     PortIteratorHelper(MultiCachePtr cache, const MemoryPtr &from, const MemoryPtr &to, bool sliced_src,
@@ -119,7 +142,7 @@ public:
             mem_holder_src = from->getPrimitive();
             mem_holder_dst = chunk_mem;
         }
-        reorder = getReorderPrim(cache, mem_holder_dst.get_engine(), mem_holder_src.get_desc(), mem_holder_dst.get_desc());
+        prepareTransfer(cache);
     }
 
     void execute(dnnl::stream strm, int iter) override {
@@ -129,7 +152,7 @@ public:
         chunk_mem.set_data_handle(static_cast<uint8_t *>(full_mem.get_data_handle()) +
                                           chunk_offset_in_byte + chunk_stride_in_byte * iter);
 
-        reorder.execute(strm, {{DNNL_ARG_FROM, mem_holder_src}, {DNNL_ARG_TO, mem_holder_dst}});
+        transfer(strm);
     }
 
 private:
@@ -147,14 +170,80 @@ public:
     BackEdgePortHelper(MultiCachePtr cache, const MemoryPtr &from, const MemoryPtr &to) {
         mem_holder_src = from->getPrimitive();
         mem_holder_dst = to->getPrimitive();
-        reorder = getReorderPrim(cache, mem_holder_dst.get_engine(), mem_holder_src.get_desc(), mem_holder_dst.get_desc());
+        prepareTransfer(cache);
+    }
+
+    void execute(dnnl::stream strm, int iter = -1) override {
+        if (iter != 0) {
+            transfer(strm);
+        }
+    }
+};
+
+/**
+ * Passes the body output to the body input of the next iteration by swapping their buffers instead of the copy. Both
+ * memories are owned by the body graph exclusively and have the same descriptor, so the output of the next iteration
+ * is written to the buffer of the previous input.
+ */
+class BackEdgeSwapHelper : public PortMapHelper {
+public:
+    BackEdgeSwapHelper(const MemoryPtr &from, const MemoryPtr &to)
+        : from_mngr(from->getMemoryMngr()), to_mngr(to->getMemoryMngr()), size(from->getSize()) {
+        mem_holder_src = from->getPrimitive();
+        mem_holder_dst = to->getPrimitive();
     }
 
     void execute(dnnl::stream strm, int iter = -1) override {
         if (iter != 0) {
-            reorder.execute(strm, {{DNNL_ARG_FROM, mem_holder_src}, {DNNL_ARG_TO, mem_holder_dst}});
+            auto from_ptr = from_mngr->getRawPtr();
+            auto to_ptr = to_mngr->getRawPtr();
+            to_mngr->setExtBuff(from_ptr, size);
+            from_mngr->setExtBuff(to_ptr, size);
         }
     }
+
+private:
+    MemoryMngrPtr from_mngr;
+    MemoryMngrPtr to_mngr;
+    size_t size;
+};
+
+/**
+ * Makes the body input reference the slice of the external input instead of the copy. The slices must be contiguous
+ * in the external input and the body must not write to its input.
+ */
+class PortSliceBindHelper : public PortMapHelper {
+public:
+    PortSliceBindHelper(const MemoryPtr &from, const MemoryPtr &to, const PortMap &slice_rule)
+        : to_mngr(to->getMemoryMngr()), size(to->getSize()) {
+        full_mem = from->getPrimitive();
+        mem_holder_dst = to->getPrimitive();
+
+        const auto abs_stride = std::abs(slice_rule.stride);
+        iter_count = static_cast<int>(from->getStaticDims()[slice_rule.axis] / abs_stride);
+
+        chunk_stride_in_byte = static_cast<ptrdiff_t>(size);
+        chunk_offset_in_byte = slice_rule.stride < 0 ? (iter_count - 1) * chunk_stride_in_byte : 0;
+        chunk_stride_in_byte *= slice_rule.stride < 0 ? -1 : 1;
+    }
+
+    void execute(dnnl::stream strm, int iter) override {
+        OPENVINO_ASSERT(iter >= 0 && iter < iter_count);
+
+        to_mngr->setExtBuff(static_cast<uint8_t *>(full_mem.get_data_handle()) +
+                            chunk_offset_in_byte + chunk_stride_in_byte * iter, size);
+    }
+
+private:
+    MemoryMngrPtr to_mngr;
+    size_t size;
+
+    ptrdiff_t chunk_stride_in_byte = 0;
+    ptrdiff_t chunk_offset_in_byte = 0;
+
+    dnnl::memory full_mem;
+
+    int iter_count;
 };
 
 class IterCountPortHelper : public PortMapHelper {
@@ -646,6 +735,8 @@ void TensorIterator::prepareInputPorts() {
         if (map_rule.axis == -1)
             first_mappers.emplace(std::make_pair(map_rule.from, map_rule.to),
                                 std::make_shared<BackEdgePortHelper>(context->getParamsCache(), from_mem, to_mem));
+        else if (canBindSlice(from_mem, map_rule))
+            before_mappers.emplace_back(std::make_shared<PortSliceBindHelper>(from_mem, to_mem, map_rule));
         else
             before_mappers.emplace_back(
                     std::make_shared<PortIteratorHelper>(context->getParamsCache(), from_mem, to_mem, true, map_rule, eng));
@@ -670,20 +761,86 @@ void TensorIterator::prepareBackEdges() {
         auto from_mem = output_mem[map_rule.from];
         auto to_mem = input_mems[map_rule.to].front();
 
-        before_mappers.emplace_back(std::make_shared<BackEdgePortHelper>(context->getParamsCache(), from_mem, to_mem));
+        if (canSwapBackEdge(from_mem, to_mem))
+            before_mappers.emplace_back(std::make_shared<BackEdgeSwapHelper>(from_mem, to_mem));
+        else
+            before_mappers.emplace_back(std::make_shared<BackEdgePortHelper>(context->getParamsCache(), from_mem, to_mem));
+    }
+}
+
+bool TensorIterator::isExclusiveBodyMemory(const MemoryPtr& mem) const {
+    // the buffer can be replaced only when it's owned by the memory, not a partition of another one
+    const auto mngr = mem->getMemoryMngr();
+    if (!std::dynamic_pointer_cast<DnnlMemoryMngr>(mngr))
+        return false;
+
+    size_t uses = 0;
+    for (const auto& mems : input_mems)
+        uses += mems.front()->getMemoryMngr() == mngr;
+    for (const auto& mem_out : output_mem)
+        uses += mem_out->getMemoryMngr() == mngr;
+    return uses == 1;
+}
+
+bool TensorIterator::canSwapBackEdge(const MemoryPtr& from, const MemoryPtr& to) const {
+    // the memories of the dynamic body are redefined between the iterations
+    if (runAsDynamic())
+        return false;
+
+    const auto& src_desc = from->getPrimitive().get_desc();
+    if (src_desc != to->getPrimitive().get_desc() || !dnnl::impl::memory_desc_wrapper(src_desc.get()).is_dense())
+        return false;
+
+    return isExclusiveBodyMemory(from) && isExclusiveBodyMemory(to);
+}
+
+bool TensorIterator::canBindSlice(const MemoryPtr& from, const PortMap& slice_rule) {
+    if (runAsDynamic())
+        return false;
+
+    const auto& to = input_mems[slice_rule.to].front();
+    const auto& to_desc = to->getDesc();
+    if (to_desc.getPrecision() != from->getDesc().getPrecision() || !to_desc.hasLayoutType(LayoutType::ncsp))
+        return false;
+
+    // the slices are contiguous when the dimensions before the axis are 1
+    const auto& dims = from->getStaticDims();
+    if (std::any_of(dims.begin(), dims.begin() + slice_rule.axis, [](size_t dim) { return dim != 1; }))
+        return false;
+
+    if (!isExclusiveBodyMemory(to))
+        return false;
+
+    // the body must not write to the external input, the same check as for the inputs of the infer request
+    const auto& inMap = sub_graph.GetInputNodesMap();
+    const auto input = inMap.find(slice_rule.to);
+    if (input == inMap.end())
+        return false;
+    for (const auto& childEdge : input->second->getChildEdges()) {
+        const auto edge = childEdge.lock();
+        if (!edge || edge->getChild()->isConstant() || edge->inPlace(Edge::LOOK_DOWN) || edge->modifiedInPlace() ||
+            (edge->getChild()->getType() == Type::Concatenation && edge->getChild()->isInPlace()))
+            return false;
     }
+    return true;
 }
 
 void TensorIterator::prepareDynamicBackEdges() {
-    back_mappers.clear();
-    for (auto map_rule : backEdges) {
+    // the mappers of the previous iteration are kept while the body shapes and memories don't change
+    if (back_mappers.size() != backEdges.size()) {
+        back_mappers.clear();
+        back_mappers.resize(backEdges.size());
+    }
+    for (size_t i = 0; i < backEdges.size(); i++) {
+        const auto& map_rule = backEdges[i];
         auto from_mem = output_mem[map_rule.from];
         auto to_mems = input_mems[map_rule.to];
 
         redefineToMemories(to_mems, from_mem->getDescPtr());
 
         // first memory is enough to get common memory ptr
-        back_mappers.emplace_back(std::make_shared<BackEdgePortHelper>(context->getParamsCache(), from_mem, to_mems.front()));
+        if (!back_mappers[i] || !back_mappers[i]->uses(from_mem, to_mems.front()))
+            back_mappers[i] = std::make_shared<BackEdgePortHelper>(context->getParamsCache(), from_mem, to_mems.front());
     }
 }
 
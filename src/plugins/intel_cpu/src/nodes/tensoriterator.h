@@ -37,10 +37,19 @@ class PortMapHelper {
 public:
     virtual ~PortMapHelper() = default;
     virtual void execute(dnnl::stream strm, int n_iter = -1) = 0;
+    bool uses(const MemoryPtr& from, const MemoryPtr& to) const;
 protected:
+    /**
+     * Creates the reorder between the src and dst holders. The equal dense descriptors are just copied, as the reorder
+     * primitive call costs more than the copy of the small tensors passed between the iterations.
+     */
+    void prepareTransfer(MultiCachePtr cache);
+    void transfer(dnnl::stream strm);
+
     dnnl::primitive reorder;
     dnnl::memory mem_holder_src;
     dnnl::memory mem_holder_dst;
+    size_t copy_size = 0;
 };
 
 
@@ -139,6 +148,11 @@ private:
     bool checkForInputAndBodyShapesInequality() const;
     int getNumIteration(const std::vector<PortMap>& inputPortMap, const std::vector<PortMap>& outputPortMap) const;
 
+    /* reference the body memories instead of the copy when the body is static */
+    bool isExclusiveBodyMemory(const MemoryPtr& mem) const;
+    bool canSwapBackEdge(const MemoryPtr& from, const MemoryPtr& to) const;
+    bool canBindSlice(const MemoryPtr& from, const PortMap& slice_rule);
+
     /* run dynamic subgraph inside a static node */
     bool runAsDynamic() const;
     void restoreSubgraphInputByBackEdges();
@@ -0,0 +1,212 @@
+// Copyright (C) 2018-2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "topk_sampling.h"
+
+#include <algorithm>
+#include <cmath>
+#include <ctime>
+#include <limits>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "kernels/sampling/topk_sampling_kernel.hpp"
+#include "openvino/core/parallel.hpp"
+#include "shape_inference/custom/topk_sampling.hpp"
+#include "utils/general_utils.h"
+
+namespace ov {
+namespace intel_cpu {
+namespace node {
+
+namespace {
+
+// the rows shorter than this are not split between the threads
+constexpr size_t min_chunk_size = 16384;
+
+}  // namespace
+
+TopKSampling::TopKSampling(const std::shared_ptr<ov::Node>& op, const GraphContext::CPtr context)
+    : Node(op, context, TopKSamplingShapeInferFactory(op)) {
+    std::string errorMessage;
+    if (!isSupportedOperation(op, errorMessage)) {
+        OPENVINO_THROW("CPU: " + errorMessage);
+    }
+
+    const auto node = std::dynamic_pointer_cast<const TopKSamplingNode>(op);
+    m_config = node->get_config();
+    // the samples are random, so the node must not be constant folded even with the constant logits
+    constant = ConstantType::StrictNoConst;
+}
+
+bool TopKSampling::isSupportedOperation(const std::shared_ptr<const ov::Node>& op, std::string& errorMessage) noexcept {
+    try {
+        const auto node = std::dynamic_pointer_cast<const TopKSamplingNode>(op);
+        if (!node) {
+            errorMessage = "Only TopKSamplingNode operation is supported";
+            return false;
+        }
+    } catch (...) {
+        return false;
+    }
+    return true;
+}
+
+void TopKSampling::initSupportedPrimitiveDescriptors() {
+    if (!supportedPrimitiveDescriptors.empty())
+        return;
+
+    addSupportedPrimDesc({{LayoutType::ncsp, ov::element::f32}, {LayoutType::ncsp, ov::element::i32}},
+                         {{LayoutType::ncsp, ov::element::i32}, {LayoutType::ncsp, ov::element::i32}},
+                         ref_any);
+}
+
+bool TopKSampling::isExecutable() const {
+    return !isInputTensorAtPortEmpty(LOGITS_PORT) && !isOutputTensorAtPortEmpty(SAMPLES_PORT);
+}
+
+bool TopKSampling::needPrepareParams() const {
+    // the number of samples is an input value, so it may change with the same input shapes
+    return true;
+}
+
+void TopKSampling::prepareParams() {
+    const auto& logits_dims = getParentEdgeAt(LOGITS_PORT)->getMemory().getStaticDims();
+    m_batches = logits_dims[0];
+    m_vocab_size = logits_dims[1];
+    m_samples = getDstMemoryAtPort(SAMPLES_PORT)->getStaticDims()[1];
+    m_top_k = std::min(m_config.top_k, m_vocab_size);
+
+    // a few batches of a large vocabulary are split along the vocabulary to keep all the threads busy
+    const size_t nthr = parallel_get_max_threads();
+    m_chunks = 1;
+    if (m_batches < nthr && m_vocab_size > min_chunk_size) {
+        m_chunks = std::min(div_up(m_vocab_size, min_chunk_size), div_up(nthr, m_batches));
+    }
+    m_chunk_size = div_up(m_vocab_size, m_chunks);
+    m_chunks = div_up(m_vocab_size, m_chunk_size);
+
+    m_candidate_values.resize(m_batches * m_chunks * m_top_k);
+    m_candidate_indices.resize(m_batches * m_chunks * m_top_k);
+    m_candidate_counts.resize(m_batches * m_chunks);
+    m_random_samples.resize(m_top_k > 1 ? m_batches * m_samples : 0);
+    m_cdf.resize(m_batches * m_top_k);
+    m_candidates.resize(m_batches * m_chunks * m_top_k);
+}
+
+void TopKSampling::execute(dnnl::stream strm) {
+    const auto* logits = getSrcDataAtPortAs<const float>(LOGITS_PORT);
+    auto* dst_samples = getDstDataAtPortAs<int32_t>(SAMPLES_PORT);
+    auto* dst_indices = getDstDataAtPortAs<int32_t>(INDICES_PORT);
+    const auto top_k = m_top_k;
+    const auto samples = m_samples;
+    const auto chunks = m_chunks;
+
+    parallel_for2d(m_batches, chunks, [&](size_t b, size_t c) {
+        const size_t start = c * m_chunk_size;
+        const size_t count = std::min(m_chunk_size, m_vocab_size - start);
+        const size_t offset = b * chunks + c;
+        m_candidate_counts[offset] =
+            ov::Extensions::Cpu::XARCH::topk_sampling_candidates(logits + b * m_vocab_size + start,
+                                                                 count,
+                                                                 top_k,
+                                                                 static_cast<int32_t>(start),
+                                                                 m_candidate_values.data() + offset * top_k,
+                                                                 m_candidate_indices.data() + offset * top_k);
+    });
+
+    // the random values are drawn the same way as in the Multinomial node, so the fused graph gives the same samples
+    if (top_k > 1) {
+        std::mt19937 gen;
+        if (m_config.global_seed == 0 && m_config.op_seed == 0) {
+            gen.seed(std::time(NULL));
+        } else {
+            std::seed_seq seed{m_config.global_seed, m_config.op_seed};
+            gen.seed(seed);
+        }
+        const auto gen_max = static_cast<float>(gen.max());
+        std::generate(m_random_samples.begin(), m_random_samples.end(), [&]() {
+            return static_cast<float>(gen()) / gen_max;
+        });
+    }
+
+    parallel_for(m_batches, [&](size_t b) {
+        const auto candidates_begin = m_candidates.begin() + b * chunks * top_k;
+        auto candidates_end = candidates_begin;
+        for (size_t c = 0; c < chunks; c++) {
+            const size_t offset = b * chunks + c;
+            for (size_t i = 0; i < m_candidate_counts[offset]; i++) {
+                *candidates_end++ = {m_candidate_values[offset * top_k + i], m_candidate_indices[offset * top_k + i]};
+            }
+        }
+        std::partial_sort(candidates_begin,
+                          candidates_begin + top_k,
+                          candidates_end,
+                          [](const Candidate& lhs, const Candidate& rhs) {
+                              return lhs.value > rhs.value || (lhs.value == rhs.value && lhs.index < rhs.index);
+                          });
+
+        auto* batch_samples = dst_samples + b * samples;
+        auto* batch_indices = dst_indices + b * samples;
+        if (top_k == 1) {
+            std::fill(batch_samples, batch_samples + samples, 0);
+            std::fill(batch_indices, batch_indices + samples, candidates_begin->index);
+            return;
+        }
+
+        // softmax of the scaled logits, the first candidate is the maximum
+        auto* cdf = m_cdf.data() + b * top_k;
+        const float max_logit = candidates_begin->value / m_config.temperature;
+        float sum = 0.f;
+        for (size_t i = 0; i < top_k; i++) {
+            cdf[i] = std::exp(candidates_begin[i].value / m_config.temperature - max_logit);
+            sum += cdf[i];
+        }
+        // the cumulative probabilities, the candidates which preceding probabilities sum to top_p or more are dropped
+        // (the exclusive cumsum is computed as the unfused head does, cumsum minus the probability)
+        size_t probs_count = top_k;
+        float cumsum = 0.f;
+        for (size_t i = 0; i < top_k; i++) {
+            const float probability = cdf[i] / sum;
+            cumsum += probability;
+            cdf[i] = cumsum;
+            if (m_config.top_p < 1.f && probs_count == top_k && cumsum - probability >= m_config.top_p) {
+                probs_count = i;
+            }
+        }
+        const float max_cdf = std::max(cdf[probs_count - 1], std::numeric_limits<float>::min());
+        for (size_t i = 0; i < probs_count; i++) {
+            cdf[i] /= max_cdf;
+        }
+
+        const auto* batch_random = m_random_samples.data() + b * samples;
+        for (size_t s = 0; s < samples; s++) {
+            const float sample_value = batch_random[s];
+            size_t selected = std::lower_bound(cdf, cdf + probs_count, sample_value) - cdf;
+            if (selected == probs_count) {
+                // the rounding errors of the normalized cdf
+                selected = probs_count - 1;
+            }
+            batch_samples[s] = static_cast<int32_t>(selected);
+            batch_indices[s] = candidates_begin[selected].index;
+
+            if (!m_config.with_replacement) {
+                // adjust the cdf after each sample drawn, as the Multinomial node does
+                const float class_probability = selected ? cdf[selected] - cdf[selected - 1] : cdf[0];
+                const float divisor = 1.f - class_probability;
+                for (size_t i = 0; i < probs_count; i++) {
+                    if (i >= selected) {
+                        cdf[i] = cdf[i] - class_probability;
+                    }
+                    cdf[i] = cdf[i] / divisor;
+                }
+            }
+        }
+    });
+}
+
+}  // namespace node
+}  // namespace intel_cpu
+}  // namespace ov
@@ -0,0 +1,68 @@
+// Copyright (C) 2018-2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include "node.h"
+#include "transformations/cpu_opset/common/op/topk_sampling.hpp"
+
+namespace ov {
+namespace intel_cpu {
+namespace node {
+
+class TopKSampling : public Node {
+public:
+    TopKSampling(const std::shared_ptr<ov::Node>& op, const GraphContext::CPtr context);
+
+    void getSupportedDescriptors() override {}
+    bool created() const override {
+        return getType() == Type::TopKSampling;
+    }
+    bool needPrepareParams() const override;
+    void prepareParams() override;
+    bool canBeInPlace() const override {
+        return false;
+    }
+    void executeDynamicImpl(dnnl::stream strm) override {
+        execute(strm);
+    }
+    void initSupportedPrimitiveDescriptors() override;
+    bool isExecutable() const override;
+    void execute(dnnl::stream strm) override;
+    static bool isSupportedOperation(const std::shared_ptr<const ov::Node>& op, std::string& errorMessage) noexcept;
+
+private:
+    static constexpr size_t LOGITS_PORT = 0lu;
+    static constexpr size_t NUM_SAMPLES_PORT = 1lu;
+    static constexpr size_t SAMPLES_PORT = 0lu;
+    static constexpr size_t INDICES_PORT = 1lu;
+
+    struct Candidate {
+        float value;
+        int32_t index;
+    };
+
+    TopKSamplingNode::Config m_config;
+
+    size_t m_batches = 0;
+    size_t m_vocab_size = 0;
+    size_t m_samples = 0;
+    size_t m_top_k = 0;
+    // the rows of a large vocabulary are split to the chunks, which are processed in parallel
+    size_t m_chunks = 1;
+    size_t m_chunk_size = 0;
+
+    // the per chunk candidates of all the batches, the chunks of a row are reduced to the top_k in parallel
+    std::vector<float> m_candidate_values;
+    std::vector<int32_t> m_candidate_indices;
+    std::vector<size_t> m_candidate_counts;
+    // the scratch buffers of the sampling, sized by prepareParams()
+    std::vector<float> m_random_samples;
+    std::vector<float> m_cdf;
+    std::vector<Candidate> m_candidates;
+};
+
+}  // namespace node
+}  // namespace intel_cpu
+}  // namespace ov
@@ -4,6 +4,9 @@
 
 #include "unique.hpp"
 
+#include <algorithm>
+#include <cstring>
+
 #include <openvino/op/unique.hpp>
 #include <openvino/op/constant.hpp>
 
@@ -16,6 +19,116 @@ using namespace ov::intel_cpu::node;
 
 #define THROW_ERROR(...) OPENVINO_THROW(getTypeStr(), " node with name '", getName(), "' ", __VA_ARGS__)
 
+namespace {
+
+// Maps the values to the unsigned keys of the same order.
+inline uint32_t sortKey(float value) {
+    uint32_t bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    return (bits & 0x80000000u) ? ~bits : (bits | 0x80000000u);
+}
+inline uint32_t sortKey(int32_t value) {
+    return static_cast<uint32_t>(value) ^ 0x80000000u;
+}
+inline uint32_t sortKey(int8_t value) {
+    return static_cast<uint8_t>(value) ^ 0x80u;
+}
+inline uint32_t sortKey(uint8_t value) {
+    return value;
+}
+
+// the minimal number of the elements processed by a thread
+constexpr size_t minChunkLen = 16384lu;
+
+size_t getThreadsNum(size_t len) {
+    return std::max<size_t>(1lu, std::min<size_t>(parallel_get_max_threads(), len / minChunkLen));
+}
+
+// Parallel stable LSD radix sort of the element indices by the element values.
+template <typename T>
+void radixSortIndices(const T* data, size_t len, std::vector<int32_t>& order) {
+    constexpr size_t digitBits = 8lu;
+    constexpr size_t digitsNum = 1lu << digitBits;
+    const size_t nthr = getThreadsNum(len);
+
+    std::vector<uint32_t> keys(len), tmpKeys(len);
+    std::vector<int32_t> tmpOrder(len);
+    order.resize(len);
+    ov::parallel_for(len, [&](size_t i) {
+        keys[i] = sortKey(data[i]);
+        order[i] = static_cast<int32_t>(i);
+    });
+
+    // offsets[ithr * digitsNum + digit] is the position of the first element of the thread chunk with the digit
+    std::vector<size_t> offsets(nthr * digitsNum);
+    for (size_t shift = 0lu; shift < sizeof(T) * 8lu; shift += digitBits) {
+        ov::parallel_nt(static_cast<int>(nthr), [&](const int ithr, const int) {
+            size_t start = 0lu, end = 0lu;
+            ov::splitter(len, nthr, static_cast<size_t>(ithr), start, end);
+            auto histogram = &offsets[ithr * digitsNum];
+            std::fill(histogram, histogram + digitsNum, 0lu);
+            for (size_t i = start; i < end; i++) {
+                histogram[(keys[i] >> shift) & (digitsNum - 1lu)]++;
+            }
+        });
+
+        size_t offset = 0lu;
+        bool sameDigit = false;
+        for (size_t digit = 0lu; digit < digitsNum; digit++) {
+            const size_t digitStart = offset;
+            for (size_t ithr = 0lu; ithr < nthr; ithr++) {
+                const auto count = offsets[ithr * digitsNum + digit];
+                offsets[ithr * digitsNum + digit] = offset;
+                offset += count;
+            }
+            // all the threads together have the digit for every element
+            sameDigit = sameDigit || offset - digitStart == len;
+        }
+        // the pass doesn't change the order
+        if (sameDigit)
+            continue;
+
+        ov::parallel_nt(static_cast<int>(nthr), [&](const int ithr, const int) {
+            size_t start = 0lu, end = 0lu;
+            ov::splitter(len, nthr, static_cast<size_t>(ithr), start, end);
+            auto threadOffsets = &offsets[ithr * digitsNum];
+            for (size_t i = start; i < end; i++) {
+                const auto pos = threadOffsets[(keys[i] >> shift) & (digitsNum - 1lu)]++;
+                tmpKeys[pos] = keys[i];
+                tmpOrder[pos] = order[i];
+            }
+        });
+        std::swap(keys, tmpKeys);
+        std::swap(order, tmpOrder);
+    }
+}
+
+// In-place parallel inclusive prefix sum.
+void parallelInclusiveScan(int32_t* data, size_t len) {
+    const size_t nthr = getThreadsNum(len);
+    std::vector<int32_t> chunkSums(nthr + 1lu, 0);
+    ov::parallel_nt(static_cast<int>(nthr), [&](const int ithr, const int) {
+        size_t start = 0lu, end = 0lu;
+        ov::splitter(len, nthr, static_cast<size_t>(ithr), start, end);
+        for (size_t i = start + 1lu; i < end; i++) {
+            data[i] += data[i - 1lu];
+        }
+        chunkSums[ithr + 1] = end > start ? data[end - 1lu] : 0;
+    });
+    for (size_t ithr = 1lu; ithr <= nthr; ithr++) {
+        chunkSums[ithr] += chunkSums[ithr - 1lu];
+    }
+    ov::parallel_nt(static_cast<int>(nthr), [&](const int ithr, const int) {
+        size_t start = 0lu, end = 0lu;
+        ov::splitter(len, nthr, static_cast<size_t>(ithr), start, end);
+        for (size_t i = start; i < end; i++) {
+            data[i] += chunkSums[ithr];
+        }
+    });
+}
+
+}  // namespace
+
 bool Unique::isSupportedOperation(const std::shared_ptr<const ov::Node>& op, std::string& errorMessage) noexcept {
     try {
         if (!ov::is_type<op::v10::Unique>(op)) {
@@ -106,13 +219,11 @@ void Unique::prepareParams() {
         THROW_ERROR(" has unidentified preferable primitive descriptor.");
     }
 
-    size_t srcLen = 1;
+    // the flattened tensor is processed without the temporary buffers
     if (flattened) {
-        srcLen = getSrcMemoryAtPort(IN_DATA)->getSize() / dataTypeSize;
-    } else {
-        auto dstDataShape = getSrcMemoryAtPort(IN_DATA)->getStaticDims();
-        srcLen = dstDataShape[axis];
+        return;
     }
+    const size_t srcLen = getSrcMemoryAtPort(IN_DATA)->getStaticDims()[axis];
     firstUniTmp.resize(srcLen, 0);
     inToOutTmp.resize(srcLen);
     occurTmp.resize(srcLen);
@@ -168,116 +279,74 @@ template <typename T>
 void Unique::flattenTensorExec() {
     const T* srcDataPtr = getSrcDataAtPortAs<const T>(IN_DATA);
     const size_t inputLen = getSrcMemoryAtPort(IN_DATA)->getSize() / sizeof(T);
-    std::vector<T> uniDataTmp(inputLen);
-    auto uniDataTmpPtr = uniDataTmp.data();
-    int *firstTmpPtr = nullptr, *inToOutTmpPtr = nullptr, *occurTmpPtr = nullptr;
-    if (definedOutputs[FIRST_UNIQUE_IDX]) {
-        firstTmpPtr = firstUniTmp.data();
-    }
-    if (definedOutputs[INPUT_TO_UNIQ_IDX]) {
-        inToOutTmpPtr = inToOutTmp.data();
-    }
-    if (definedOutputs[OCCURRENCES_NUM]) {
-        occurTmpPtr = occurTmp.data();
-    }
-    uniqueLen = inputLen;
-
-    if (sorted) {
-        cpu_parallel_memcpy(uniDataTmpPtr, srcDataPtr, inputLen * sizeof(T));
-        std::sort(uniDataTmpPtr, uniDataTmpPtr + inputLen);
-        auto last = std::unique(uniDataTmpPtr, uniDataTmpPtr + inputLen);
-        uniqueLen = last - uniDataTmpPtr;
-
-        if (definedOutputs[FIRST_UNIQUE_IDX]) {
-            T* first = uniDataTmpPtr;
-            for (T* it = first; it < last; it++) {
-                for (size_t i = 0; i < inputLen; i++) {
-                    if (srcDataPtr[i] == *it) {
-                        *firstTmpPtr++ = i;
-                        first++;
-                        break;
-                    }
-                }
-            }
-        }
-        if (definedOutputs[INPUT_TO_UNIQ_IDX]) {
-            for (size_t i = 0; i < inputLen; i++) {
-                if (i > 0 && srcDataPtr[i] == srcDataPtr[i - 1]) {
-                    inToOutTmpPtr[i] = inToOutTmpPtr[i - 1];
-                    continue;
-                }
-                for (size_t j = 0; j < uniqueLen; j++) {
-                    if (srcDataPtr[i] == uniDataTmpPtr[j]) {
-                        inToOutTmpPtr[i] = j;
-                        break;
-                    }
-                }
-            }
-        }
-        if (definedOutputs[OCCURRENCES_NUM]) {
-            std::fill(occurTmpPtr, occurTmpPtr + uniqueLen, 0);
-            for (size_t j = 0; j < uniqueLen; j++) {
-                for (size_t i = 0; i < inputLen; i++) {
-                    if (srcDataPtr[i] == uniDataTmpPtr[j]) {
-                        occurTmpPtr[j]++;
-                    }
-                }
-            }
-        }
-    } else {
-        uniDataTmpPtr[0] = srcDataPtr[0];
-        if (definedOutputs[FIRST_UNIQUE_IDX]) {
-            firstTmpPtr[0] = 0;
-        }
-        if (definedOutputs[INPUT_TO_UNIQ_IDX]) {
-            inToOutTmpPtr[0] = 0;
-        }
-        if (definedOutputs[OCCURRENCES_NUM]) {
-            std::fill(occurTmpPtr, occurTmpPtr + inputLen, 1);
-        }
-        uniqueLen = 1;
-
-        for (size_t i = 1; i < inputLen; i++) {
-            bool found = false;
-            size_t j = 0;
-            for (; j < uniqueLen; j++) {
-                if (uniDataTmpPtr[j] == srcDataPtr[i]) {
-                    found = true;
-                    break;
-                }
-            }
-            if (!found) {
-                uniDataTmpPtr[uniqueLen] = srcDataPtr[i];
-                if (definedOutputs[FIRST_UNIQUE_IDX]) {
-                    firstTmpPtr[uniqueLen] = i;
-                }
-                uniqueLen++;
-            } else {
-                if (definedOutputs[OCCURRENCES_NUM]) {
-                    occurTmpPtr[j]++;
-                }
-            }
-            if (definedOutputs[INPUT_TO_UNIQ_IDX]) {
-                inToOutTmpPtr[i] = j;
-            }
-        }
+    if (inputLen == 0lu) {
+        uniqueLen = 0lu;
+        redefineOutputMemory({ {0lu}, {0lu}, {0lu}, {0lu}});
+        return;
+    }
+
+    // The elements are grouped by the value: the indices are stable sorted by the value, so the group of the equal
+    // elements is the continuous range of the sorted indices.
+    std::vector<int32_t> order;
+    radixSortIndices(srcDataPtr, inputLen, order);
+
+    // groupId[p] is the group of the sorted element p, the groups are numbered in the ascending order of the values.
+    std::vector<int32_t> groupId(inputLen);
+    parallel_for(inputLen, [&](size_t p) {
+        groupId[p] = (p > 0lu && !(srcDataPtr[order[p]] == srcDataPtr[order[p - 1]])) ? 1 : 0;
+    });
+    parallelInclusiveScan(groupId.data(), inputLen);
+    uniqueLen = static_cast<size_t>(groupId[inputLen - 1]) + 1lu;
+
+    std::vector<int32_t> groupStart(uniqueLen + 1lu);
+    groupStart[uniqueLen] = static_cast<int32_t>(inputLen);
+    parallel_for(inputLen, [&](size_t p) {
+        if (p == 0lu || groupId[p] != groupId[p - 1])
+            groupStart[groupId[p]] = static_cast<int32_t>(p);
+    });
+    // the index of the first occurrence, the group isn't sorted by the index only for the equal floating point zeros
+    // of the different signs
+    std::vector<int32_t> groupFirst(uniqueLen);
+    parallel_for(uniqueLen, [&](size_t g) {
+        groupFirst[g] = *std::min_element(order.begin() + groupStart[g], order.begin() + groupStart[g + 1lu]);
+    });
+
+    // groupPos[g] is the position of the group in the output: the ascending order of the values for the sorted mode
+    // and the order of the first occurrence otherwise.
+    std::vector<int32_t> groupPos;
+    if (!sorted) {
+        std::vector<int32_t> isFirst(inputLen, 0);
+        parallel_for(uniqueLen, [&](size_t g) {
+            isFirst[groupFirst[g]] = 1;
+        });
+        parallelInclusiveScan(isFirst.data(), inputLen);
+        groupPos.resize(uniqueLen);
+        parallel_for(uniqueLen, [&](size_t g) {
+            groupPos[g] = isFirst[groupFirst[g]] - 1;
+        });
     }
+    auto outPos = [&](size_t g) {
+        return sorted ? g : static_cast<size_t>(groupPos[g]);
+    };
 
     redefineOutputMemory({ {uniqueLen}, {uniqueLen}, {inputLen}, {uniqueLen}});
 
     T* uniDataPtr = getDstDataAtPortAs<T>(UNIQUE_DATA);
-    cpu_parallel_memcpy(uniDataPtr, uniDataTmpPtr, uniqueLen * sizeof(T));
-    if (definedOutputs[FIRST_UNIQUE_IDX]) {
-        int *firstPtr = getDstDataAtPortAs<int>(FIRST_UNIQUE_IDX);
-        cpu_parallel_memcpy(firstPtr, firstUniTmp.data(), uniqueLen * sizeof(int));
-    }
+    int* firstPtr = definedOutputs[FIRST_UNIQUE_IDX] ? getDstDataAtPortAs<int>(FIRST_UNIQUE_IDX) : nullptr;
+    int* occurPtr = definedOutputs[OCCURRENCES_NUM] ? getDstDataAtPortAs<int>(OCCURRENCES_NUM) : nullptr;
+    parallel_for(uniqueLen, [&](size_t g) {
+        const auto pos = outPos(g);
+        uniDataPtr[pos] = srcDataPtr[groupFirst[g]];
+        if (firstPtr)
+            firstPtr[pos] = groupFirst[g];
+        if (occurPtr)
+            occurPtr[pos] = groupStart[g + 1lu] - groupStart[g];
+    });
     if (definedOutputs[INPUT_TO_UNIQ_IDX]) {
         auto inToOutPtr = getDstDataAtPortAs<int>(INPUT_TO_UNIQ_IDX);
-        cpu_parallel_memcpy(inToOutPtr, inToOutTmp.data(), inputLen * sizeof(int));
-    }
-    if (definedOutputs[OCCURRENCES_NUM]) {
-        auto occurPtr = getDstDataAtPortAs<int>(OCCURRENCES_NUM);
-        cpu_parallel_memcpy(occurPtr, occurTmp.data(), uniqueLen * sizeof(int));
+        parallel_for(inputLen, [&](size_t p) {
+            inToOutPtr[order[p]] = static_cast<int>(outPos(groupId[p]));
+        });
     }
 }
 
@@ -14,6 +14,7 @@
 #include "nodes/ctc_greedy_decoder.h"
 #include "nodes/ctc_greedy_decoder_seq_len.h"
 #include "nodes/ctc_loss.h"
+#include "nodes/ctc_prefix_beam_search.h"
 #include "nodes/cum_sum.h"
 #include "nodes/deconv.h"
 #include "nodes/def_conv.h"
@@ -94,6 +95,7 @@
 #include "nodes/tensoriterator.h"
 #include "nodes/tile.h"
 #include "nodes/topk.h"
+#include "nodes/topk_sampling.h"
 #include "nodes/transpose.h"
 #include "nodes/unique.hpp"
 #include "nodes/causal_mask_preprocess.h"
@@ -150,6 +152,7 @@ Node::NodesFactory::NodesFactory() : Factory("NodesFactory") {
     INTEL_CPU_NODE(DetectionOutput, Type::DetectionOutput);
     INTEL_CPU_NODE(GatherElements, Type::GatherElements);
     INTEL_CPU_NODE(CTCGreedyDecoderSeqLen, Type::CTCGreedyDecoderSeqLen);
+    INTEL_CPU_NODE(CTCPrefixBeamSearch, Type::CTCPrefixBeamSearch);
     INTEL_CPU_NODE(Bucketize, Type::Bucketize);
     INTEL_CPU_NODE(ExperimentalDetectronROIFeatureExtractor, Type::ExperimentalDetectronROIFeatureExtractor);
     INTEL_CPU_NODE(Math, Type::Math);
@@ -163,6 +166,7 @@ Node::NodesFactory::NodesFactory() : Factory("NodesFactory") {
     INTEL_CPU_NODE(MVN, Type::MVN);
     INTEL_CPU_NODE(MatMul, Type::MatMul);
     INTEL_CPU_NODE(Multinomial, Type::Multinomial);
+    INTEL_CPU_NODE(TopKSampling, Type::TopKSampling);
     INTEL_CPU_NODE(ScatterUpdate, Type::ScatterUpdate);
     INTEL_CPU_NODE(ScatterUpdate, Type::ScatterElementsUpdate);
     INTEL_CPU_NODE(ScatterUpdate, Type::ScatterNDUpdate);
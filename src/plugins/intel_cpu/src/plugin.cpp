@@ -4,8 +4,11 @@
 
 #include "plugin.h"
 
+#include <sstream>
+
 #include "internal_properties.hpp"
 #include "itt.h"
+#include "openvino/pass/pass_profile.hpp"
 #include "openvino/runtime/intel_cpu/properties.hpp"
 #include "openvino/runtime/internal_properties.hpp"
 #include "openvino/runtime/properties.hpp"
@@ -200,12 +203,25 @@ static bool shouldEnableLPT(const ov::AnyMap& modelConfig, const Config& engineC
     }
 }
 
-static ov::element::Type getInferencePrecision(const ov::AnyMap& modelConfig,
-                                               const Config& engineConfig,
-                                               Config::ModelType modelType) {
-    Config tempConf = engineConfig;
-    tempConf.readProperties(modelConfig, modelType);
-    return tempConf.inferencePrecision;
+static std::string compileProfileToJson(const std::vector<ov::pass::PassProfile>& profile) {
+    std::stringstream json;
+    json << "{\"passes\":[";
+    for (size_t i = 0; i < profile.size(); i++) {
+        const auto& pass = profile[i];
+        json << (i == 0 ? "" : ",") << "{\"name\":\"";
+        for (const auto c : pass.name) {
+            if (c == '"' || c == '\\')
+                json << '\\';
+            json << c;
+        }
+        json << "\",\"depth\":" << pass.depth
+             << ",\"time_us\":" << std::chrono::duration_cast<std::chrono::microseconds>(pass.time).count()
+             << ",\"visited_nodes\":" << pass.visited_nodes << ",\"matcher_invocations\":" << pass.matcher_invocations
+             << ",\"applied_rewrites\":" << pass.applied_rewrites
+             << ",\"applied\":" << (pass.applied ? "true" : "false") << "}";
+    }
+    json << "]}";
+    return json.str();
 }
 
 static Config::ModelType getModelType(const std::shared_ptr<const Model>& model) {
@@ -265,10 +281,18 @@ std::shared_ptr<ov::ICompiledModel> Plugin::compile_model(const std::shared_ptr<
     const std::shared_ptr<ov::Model> cloned_model = model->clone();
     const bool enableLPT = shouldEnableLPT(config, engConfig);
     Config::ModelType modelType = getModelType(model);
-    ov::element::Type inferencePrecision = getInferencePrecision(config, engConfig, modelType);
+    // the model properties are parsed in advance, as the transformations are run before the final config is built
+    Config parsedConfig = engConfig;
+    parsedConfig.readProperties(config, modelType);
+    const ov::element::Type inferencePrecision = parsedConfig.inferencePrecision;
     const Config::SnippetsMode snippetsMode = getSnippetsMode(config, engConfig);
     DEBUG_LOG(PrintableModel(*cloned_model, "org_"));
 
+    // collects the passes run by all the transformation managers below
+    std::unique_ptr<ov::pass::PassProfileScope> profileScope;
+    if (parsedConfig.collectPerfCounters)
+        profileScope.reset(new ov::pass::PassProfileScope());
+
     // update the props after the perf mode translated to configs
     // TODO: Clarify the behavior of SetConfig method. Skip eng_config or not?
     Config conf = engConfig;
@@ -322,7 +346,10 @@ std::shared_ptr<ov::ICompiledModel> Plugin::compile_model(const std::shared_ptr<
             denormals_as_zero(false);
         }
     }
-    return std::make_shared<CompiledModel>(cloned_model, shared_from_this(), conf, false);
+    auto compiledModel = std::make_shared<CompiledModel>(cloned_model, shared_from_this(), conf, false);
+    if (profileScope)
+        compiledModel->set_compile_profile(compileProfileToJson(profileScope->get_profile()));
+    return compiledModel;
 }
 
 void Plugin::set_property(const ov::AnyMap& config) {
@@ -391,6 +418,8 @@ ov::Any Plugin::get_property(const std::string& name, const ov::AnyMap& options)
             std::move(model_runtime_properties.as<std::string>()));
     } else if (name == ov::log::level) {
         return engConfig.logLevel;
+    } else if (name == ov::internal::caching_with_mmap.name()) {
+        return decltype(ov::internal::caching_with_mmap)::value_type(true);
     } else if (name == ov::internal::compiled_model_runtime_properties_supported.name()) {
         ov::Any res = true;
         auto it = options.find(ov::internal::compiled_model_runtime_properties.name());
@@ -472,7 +501,8 @@ ov::Any Plugin::get_ro_property(const std::string& name, const ov::AnyMap& optio
             ov::PropertyName{ov::internal::exclusive_async_requests.name(), ov::PropertyMutability::RW},
             ov::PropertyName{ov::internal::compiled_model_runtime_properties.name(), ov::PropertyMutability::RO},
             ov::PropertyName{ov::internal::compiled_model_runtime_properties_supported.name(),
-                             ov::PropertyMutability::RO}};
+                             ov::PropertyMutability::RO},
+            ov::PropertyName{ov::internal::caching_with_mmap.name(), ov::PropertyMutability::RO}};
     } else if (name == ov::device::full_name) {
         return decltype(ov::device::full_name)::value_type(deviceFullName);
     } else if (name == ov::available_devices) {
@@ -6,6 +6,8 @@
 #include <pugixml.hpp>
 
 #include "openvino/pass/serialize.hpp"
+#include "openvino/runtime/make_tensor.hpp"
+#include "openvino/runtime/shared_buffer.hpp"
 #include "transformations/utils/utils.hpp"
 
 namespace ov {
@@ -24,7 +26,26 @@ static void setInfo(pugi::xml_node& root, std::shared_ptr<ov::Model>& model) {
     }
 }
 
-ModelSerializer::ModelSerializer(std::ostream& ostream) : _ostream(ostream) {}
+// restores the descriptor hints of the compiled graph nodes, which are created from the model operations
+static void setDescriptorHints(pugi::xml_node& root, std::shared_ptr<ov::Model>& model) {
+    pugi::xml_node graph = root.child("graph");
+    if (graph.empty())
+        return;
+
+    DescriptorHints hints;
+    for (const auto& node : graph.children("node")) {
+        hints[node.attribute("name").value()] = node.attribute("hint").value();
+    }
+    for (const auto& op : model->get_ordered_ops()) {
+        auto it = hints.find(op->get_friendly_name());
+        if (it != hints.end())
+            op->get_rt_info()["cpuDescriptorHint"] = it->second;
+    }
+}
+
+ModelSerializer::ModelSerializer(std::ostream& ostream, DescriptorHints hints)
+    : _ostream(ostream),
+      _hints(std::move(hints)) {}
 
 void ModelSerializer::operator<<(const std::shared_ptr<ov::Model>& model) {
     auto serializeInfo = [&](std::ostream& stream) {
@@ -37,6 +58,14 @@ void ModelSerializer::operator<<(const std::shared_ptr<ov::Model>& model) {
             const std::string name = ov::descriptor::get_ov_tensor_legacy_name(out->input_value(0).get_tensor());
             out_node.append_attribute("name").set_value(name.c_str());
         }
+        if (!_hints.empty()) {
+            pugi::xml_node graph = root.append_child("graph");
+            for (const auto& hint : _hints) {
+                auto node = graph.append_child("node");
+                node.append_attribute("name").set_value(hint.first.c_str());
+                node.append_attribute("hint").set_value(hint.second.c_str());
+            }
+        }
         xml_doc.save(stream);
     };
 
@@ -90,8 +119,18 @@ void ModelDeserializer::operator>>(std::shared_ptr<ov::Model>& model) {
     // read blob content
     _istream.seekg(hdr.consts_offset);
     if (hdr.consts_size) {
-        dataBlob = ov::Tensor(ov::element::u8, ov::Shape({hdr.consts_size}));
-        _istream.read(static_cast<char *>(dataBlob.data(ov::element::u8)), hdr.consts_size);
+        if (auto mapped = dynamic_cast<ov::OwningSharedStreamBuffer*>(_istream.rdbuf())) {
+            // the stream is backed by the memory mapped blob, so the constants reference it directly
+            // and the tensor keeps the mapping alive while the model constants are in use
+            auto buffer = mapped->get_buffer();
+            auto constants = ov::make_tensor(ov::element::u8,
+                                             ov::Shape({hdr.consts_size}),
+                                             buffer->get_ptr<char>() + hdr.consts_offset);
+            dataBlob = ov::make_tensor(ov::SoPtr<ov::ITensor>{constants, buffer});
+        } else {
+            dataBlob = ov::Tensor(ov::element::u8, ov::Shape({hdr.consts_size}));
+            _istream.read(static_cast<char *>(dataBlob.data(ov::element::u8)), hdr.consts_size);
+        }
     }
 
     // read XML content
@@ -104,6 +143,7 @@ void ModelDeserializer::operator>>(std::shared_ptr<ov::Model>& model) {
     // Set Info
     pugi::xml_node root = xmlInOutDoc.child("cnndata");
     setInfo(root, model);
+    setDescriptorHints(root, model);
 }
 
 }   // namespace intel_cpu
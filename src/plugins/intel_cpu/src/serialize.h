@@ -7,6 +7,7 @@
 #include <ostream>
 #include <memory>
 #include <string>
+#include <unordered_map>
 
 #include "openvino/core/model.hpp"
 #include "openvino/runtime/tensor.hpp"
@@ -14,13 +15,17 @@
 namespace ov {
 namespace intel_cpu {
 
+// compiled graph node name -> "<oneDNN descriptor index>:<implementation type>" of the selected primitive descriptor
+using DescriptorHints = std::unordered_map<std::string, std::string>;
+
 class ModelSerializer {
 public:
-    ModelSerializer(std::ostream& ostream);
+    ModelSerializer(std::ostream& ostream, DescriptorHints hints = {});
     void operator<<(const std::shared_ptr<ov::Model>& model);
 
 private:
     std::ostream& _ostream;
+    DescriptorHints _hints;
 };
 
 class ModelDeserializer {
@@ -0,0 +1,38 @@
+// Copyright (C) 2018-2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "topk_sampling.hpp"
+#include "utils.hpp"
+#include "transformations/cpu_opset/common/op/topk_sampling.hpp"
+
+namespace ov {
+namespace intel_cpu {
+namespace node {
+
+Result TopKSamplingShapeInfer::infer(
+        const std::vector<std::reference_wrapper<const VectorDims>>& input_shapes,
+        const std::unordered_map<size_t, MemoryPtr>& data_dependency) {
+    const auto& logits_shape = input_shapes.front().get();
+    if (logits_shape.size() != 2) {
+        OPENVINO_THROW("TopKSampling expects 2D 'logits' input, got: ", PartialShape(logits_shape));
+    }
+    auto num_samples = data_dependency.at(1)->getDataAs<int32_t>()[0];
+    if (num_samples < 0) {
+        OPENVINO_THROW("TopKSampling num_samples value can't be negative.");
+    }
+    VectorDims result = {logits_shape[0], static_cast<size_t>(num_samples)};
+
+    return {{result, result}, ShapeInferStatus::success};
+}
+
+ShapeInferPtr TopKSamplingShapeInferFactory::makeShapeInfer() const {
+    auto sampling = ov::as_type_ptr<const TopKSamplingNode>(m_op);
+    if (!sampling) {
+        OPENVINO_THROW("Unexpected op type in TopKSampling shape inference factory: ", m_op->get_type_name());
+    }
+    return std::make_shared<TopKSamplingShapeInfer>();
+}
+} // namespace node
+} // namespace intel_cpu
+} // namespace ov
@@ -0,0 +1,42 @@
+// Copyright (C) 2018-2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <node.h>
+#include "shape_inference/shape_inference_cpu.hpp"
+
+#pragma once
+namespace ov {
+namespace intel_cpu {
+namespace node {
+using Result = IShapeInfer::Result;
+/**
+ * Implements TopKSampling shape inference algorithm. Both outputs have the shape [N, num_samples], where N is the
+ * `logits` batch size and num_samples is the value of the second input.
+ *
+ */
+class TopKSamplingShapeInfer : public ShapeInferEmptyPads {
+public:
+    TopKSamplingShapeInfer() = default;
+    Result infer(
+        const std::vector<std::reference_wrapper<const VectorDims>>& input_shapes,
+        const std::unordered_map<size_t, MemoryPtr>& data_dependency) override;
+
+    port_mask_t get_port_mask() const override {
+        return PortMask(1);
+    }
+};
+
+class TopKSamplingShapeInferFactory : public ShapeInferFactory {
+public:
+    TopKSamplingShapeInferFactory(std::shared_ptr<ov::Node> op) : m_op(op) {}
+    ShapeInferPtr makeShapeInfer() const override;
+
+private:
+    std::shared_ptr<ov::Node> m_op;
+};
+
+} // namespace node
+} // namespace intel_cpu
+} // namespace ov
+
@@ -0,0 +1,67 @@
+// Copyright (C) 2018-2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "topk_sampling.hpp"
+
+#include "openvino/core/validation_util.hpp"
+#include "transformations/itt.hpp"
+
+ov::intel_cpu::TopKSamplingNode::TopKSamplingNode(const ov::Output<Node>& logits,
+                                                  const ov::Output<Node>& num_samples,
+                                                  const Config& cfg)
+    : Op({logits, num_samples}), m_config(cfg) {
+    validate_and_infer_types();
+}
+
+std::shared_ptr<ov::Node> ov::intel_cpu::TopKSamplingNode::clone_with_new_inputs(const ov::OutputVector& new_args) const {
+    INTERNAL_OP_SCOPE(TopKSamplingNode_clone_with_new_inputs);
+    check_new_args_count(this, new_args);
+    return std::make_shared<ov::intel_cpu::TopKSamplingNode>(new_args.at(0), new_args.at(1), m_config);
+}
+
+bool ov::intel_cpu::TopKSamplingNode::visit_attributes(ov::AttributeVisitor& visitor) {
+    INTERNAL_OP_SCOPE(TopKSamplingNode_visit_attributes);
+    visitor.on_attribute("top_k", m_config.top_k);
+    visitor.on_attribute("temperature", m_config.temperature);
+    visitor.on_attribute("top_p", m_config.top_p);
+    visitor.on_attribute("with_replacement", m_config.with_replacement);
+    visitor.on_attribute("global_seed", m_config.global_seed);
+    visitor.on_attribute("op_seed", m_config.op_seed);
+    visitor.on_attribute("sample_type", m_config.sample_type);
+    visitor.on_attribute("index_type", m_config.index_type);
+    return true;
+}
+
+void ov::intel_cpu::TopKSamplingNode::validate_and_infer_types() {
+    INTERNAL_OP_SCOPE(TopKSamplingNode_validate_and_infer_types);
+    OPENVINO_ASSERT(m_config.top_k > 0, "top_k attribute must be greater than zero");
+    OPENVINO_ASSERT(m_config.temperature > 0.f, "temperature attribute must be positive");
+    OPENVINO_ASSERT(m_config.top_p > 0.f && m_config.top_p <= 1.f, "top_p attribute must be in (0, 1]");
+    OPENVINO_ASSERT(m_config.sample_type.is_integral_number() && m_config.index_type.is_integral_number(),
+                    "sample_type and index_type attributes must be integer");
+
+    const auto& logits_et = get_input_element_type(0);
+    const auto& logits_shape = get_input_partial_shape(0);
+    OPENVINO_ASSERT(logits_et.is_real(), "'logits' input must be real whereas current element type is", logits_et);
+    OPENVINO_ASSERT(logits_shape.rank().compatible(2),
+                    "'logits' input must have 2D shape whereas current shape is",
+                    logits_shape);
+
+    const auto& num_samples_et = get_input_element_type(1);
+    const auto& num_samples_shape = get_input_partial_shape(1);
+    OPENVINO_ASSERT(num_samples_et.is_integral_number(),
+                    "'num_samples' input must be integer whereas current element type is",
+                    num_samples_et);
+    OPENVINO_ASSERT(num_samples_shape.compatible(ov::PartialShape{}) || num_samples_shape.compatible(ov::PartialShape{1}),
+                    "'num_samples' input must be a scalar or 1D tensor with a single element whereas current shape is",
+                    num_samples_shape);
+
+    auto batch = logits_shape.rank().is_static() ? logits_shape[0] : ov::Dimension::dynamic();
+    auto samples = ov::Dimension::dynamic();
+    if (const auto num_samples = ov::util::get_constant_from_source(input_value(1))) {
+        samples = num_samples->cast_vector<int64_t>().at(0);
+    }
+    set_output_type(0, m_config.sample_type, {batch, samples});
+    set_output_type(1, m_config.index_type, {batch, samples});
+}
@@ -0,0 +1,55 @@
+// Copyright (C) 2018-2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include "openvino/op/op.hpp"
+
+namespace ov {
+namespace intel_cpu {
+/**
+ * The operation selects the next tokens from the LLM logits: the top_k greatest logits are divided by the temperature,
+ * turned to the probabilities by softmax, the candidates which preceding probabilities sum to top_p or more are dropped
+ * (nucleus sampling) and the tokens are sampled from the rest as Multinomial does. top_k 1 is the greedy search,
+ * top_p 1 keeps all the top_k candidates.
+ * Inputs:
+ *     1. Logits of type T1 - shape [N, V], where N - batch size, V - vocabulary size. Required
+ *     2. Number of samples of type T2 - scalar or 1D tensor with a single element. Required
+ * Outputs:
+ *     1. Positions of the samples among the top_k logits of type sample_type - shape [N, num_samples]
+ *     2. Token ids (the logits indices) of the samples of type index_type - shape [N, num_samples]
+ * Types:
+ *     T1 - only FP32 is supported
+ *     T2 - I32 and I64 are supported
+ */
+class TopKSamplingNode : public ov::op::Op {
+public:
+    OPENVINO_OP("TopKSampling", "cpu_plugin_opset");
+
+    struct Config {
+        size_t top_k = 1;
+        float temperature = 1.f;
+        float top_p = 1.f;
+        bool with_replacement = false;
+        uint64_t global_seed = 0;
+        uint64_t op_seed = 0;
+        ov::element::Type sample_type = ov::element::i32;
+        ov::element::Type index_type = ov::element::i32;
+    };
+
+    TopKSamplingNode() = default;
+    TopKSamplingNode(const ov::Output<Node>& logits, const ov::Output<Node>& num_samples, const Config& cfg);
+    std::shared_ptr<ov::Node> clone_with_new_inputs(const ov::OutputVector& new_args) const override;
+    bool visit_attributes(ov::AttributeVisitor& visitor) override;
+    void validate_and_infer_types() override;
+
+    const Config& get_config() const {
+        return m_config;
+    }
+
+private:
+    Config m_config;
+};
+}   // namespace intel_cpu
+}   // namespace ov
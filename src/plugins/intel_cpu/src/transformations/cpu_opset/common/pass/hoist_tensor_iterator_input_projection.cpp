@@ -0,0 +1,126 @@
+// Copyright (C) 2018-2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "hoist_tensor_iterator_input_projection.hpp"
+
+#include <algorithm>
+
+#include "openvino/core/rt_info.hpp"
+#include "openvino/op/constant.hpp"
+#include "openvino/op/matmul.hpp"
+#include "openvino/op/parameter.hpp"
+#include "openvino/op/squeeze.hpp"
+#include "openvino/op/tensor_iterator.hpp"
+#include "openvino/pass/pattern/op/wrap_type.hpp"
+
+#include "itt.hpp"
+
+namespace {
+
+using SliceInputDescription = ov::op::util::MultiSubGraphOp::SliceInputDescription;
+
+// returns the MatMul projecting the sliced body parameter by the constant weights and the optional Squeeze between them
+bool get_projection(const std::shared_ptr<ov::op::v0::Parameter>& param,
+                    int64_t axis,
+                    std::shared_ptr<ov::op::v0::MatMul>& matmul,
+                    std::shared_ptr<ov::op::v0::Squeeze>& squeeze) {
+    const auto rank = param->get_output_partial_shape(0).rank();
+    // the sliced axis must not be the reduced one
+    if (rank.is_dynamic() || axis < 0 || axis >= rank.get_length() - 1)
+        return false;
+
+    auto consumers = param->get_output_target_inputs(0);
+    if (consumers.size() != 1)
+        return false;
+    auto consumer = consumers.begin()->get_node()->shared_from_this();
+
+    squeeze = ov::as_type_ptr<ov::op::v0::Squeeze>(consumer);
+    if (squeeze) {
+        // the squeezed axes must not include the reduced one, which size is changed by the projection
+        if (squeeze->get_input_size() != 2)
+            return false;
+        const auto axes = ov::as_type_ptr<ov::op::v0::Constant>(squeeze->get_input_node_shared_ptr(1));
+        if (!axes)
+            return false;
+        auto axes_values = axes->cast_vector<int64_t>();
+        const auto last = rank.get_length() - 1;
+        if (std::any_of(axes_values.begin(), axes_values.end(), [&](int64_t value) {
+                return value == last || value == -1;
+            }))
+            return false;
+        consumers = squeeze->get_output_target_inputs(0);
+        if (consumers.size() != 1)
+            return false;
+        consumer = consumers.begin()->get_node()->shared_from_this();
+    }
+
+    matmul = ov::as_type_ptr<ov::op::v0::MatMul>(consumer);
+    if (!matmul || consumers.begin()->get_index() != 0 || matmul->get_transpose_a())
+        return false;
+    // 2D weights are broadcast over the batch dimensions, so the projection of each slice is the slice of the
+    // projection of the whole input
+    const auto weights = ov::as_type_ptr<ov::op::v0::Constant>(matmul->get_input_node_shared_ptr(1));
+    return weights && weights->get_shape().size() == 2;
+}
+
+}  // namespace
+
+ov::intel_cpu::HoistTensorIteratorInputProjection::HoistTensorIteratorInputProjection() {
+    MATCHER_SCOPE(HoistTensorIteratorInputProjection);
+    auto ti_m = ov::pass::pattern::wrap_type<ov::op::v0::TensorIterator>();
+
+    ov::matcher_pass_callback callback = [=](ov::pass::pattern::Matcher& m) {
+        auto ti = ov::as_type_ptr<ov::op::v0::TensorIterator>(m.get_match_root());
+        if (!ti || transformation_callback(ti))
+            return false;
+
+        auto body = ti->get_body();
+        bool rewritten = false;
+        for (const auto& description : ti->get_input_descriptions()) {
+            const auto slice = ov::as_type_ptr<SliceInputDescription>(description);
+            if (!slice)
+                continue;
+
+            const auto input = ti->input_value(slice->m_input_index);
+            const auto& input_shape = input.get_partial_shape();
+            if (input_shape.rank().is_dynamic())
+                continue;
+            const auto axis = slice->m_axis < 0 ? slice->m_axis + input_shape.rank().get_length() : slice->m_axis;
+            const auto param = body->get_parameters().at(slice->m_body_parameter_index);
+            std::shared_ptr<ov::op::v0::MatMul> matmul;
+            std::shared_ptr<ov::op::v0::Squeeze> squeeze;
+            if (!get_projection(param, axis, matmul, squeeze))
+                continue;
+
+            auto weights = matmul->get_input_node_shared_ptr(1)->clone_with_new_inputs({});
+            auto projection = std::make_shared<ov::op::v0::MatMul>(input, weights, false, matmul->get_transpose_b());
+            projection->set_friendly_name(matmul->get_friendly_name() + "/hoisted");
+            ov::copy_runtime_info(matmul, {projection, weights});
+
+            auto projection_shape = projection->get_output_partial_shape(0);
+            projection_shape[axis] = slice->m_part_size;
+            auto new_param = std::make_shared<ov::op::v0::Parameter>(projection->get_output_element_type(0),
+                                                                     projection_shape);
+            new_param->set_friendly_name(param->get_friendly_name());
+            ov::Output<ov::Node> sliced_projection = new_param;
+            if (squeeze) {
+                sliced_projection = squeeze->clone_with_new_inputs({new_param, squeeze->input_value(1)});
+                ov::copy_runtime_info(squeeze, sliced_projection.get_node_shared_ptr());
+            }
+            sliced_projection.get_node_shared_ptr()->set_friendly_name(matmul->get_friendly_name());
+            matmul->output(0).replace(sliced_projection);
+
+            body->replace_parameter(slice->m_body_parameter_index, new_param);
+            ti->input(slice->m_input_index).replace_source_output(projection);
+            rewritten = true;
+        }
+
+        if (rewritten)
+            ti->validate_and_infer_types();
+        return rewritten;
+    };
+
+    auto m = std::make_shared<ov::pass::pattern::Matcher>(ti_m, matcher_name);
+    this->register_matcher(m, callback);
+}
@@ -0,0 +1,35 @@
+// Copyright (C) 2018-2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include "openvino/pass/graph_rewrite.hpp"
+
+namespace ov {
+namespace intel_cpu {
+
+/**
+ * The TensorIterator body, which is not converted to an RNN sequence, is executed per iteration, so the projection of
+ * the sliced input by the constant weights is computed by a small GEMM per timestep. This transformation moves the
+ * projection out of the body, so it is computed by one GEMM over the whole sequence and the body slices the result.
+ * Example:
+ *                                                                    X[N,T,C]   W[C,G]
+ *   X[N,T,C] --(slice axis 1)--> TensorIterator                          \      /
+ *                                 Parameter[N,1,C]                        MatMul
+ *                                       |                                   |
+ *                                Squeeze(axis 1)(opt)     ====>   [N,T,G] --(slice axis 1)--> TensorIterator
+ *                                       |     W[C,G]                                           Parameter[N,1,G]
+ *                                       |    /                                                        |
+ *                                     MatMul                                                 Squeeze(axis 1)(opt)
+ *                                       |                                                             |
+ * The weights may be transposed (transpose_b), the other inputs of the TensorIterator are not changed.
+ */
+class HoistTensorIteratorInputProjection : public ov::pass::MatcherPass {
+public:
+    OPENVINO_RTTI("HoistTensorIteratorInputProjection", "0");
+    HoistTensorIteratorInputProjection();
+};
+
+}   // namespace intel_cpu
+}   // namespace ov
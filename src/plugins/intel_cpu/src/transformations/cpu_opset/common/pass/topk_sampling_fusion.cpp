@@ -0,0 +1,216 @@
+// Copyright (C) 2018-2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "topk_sampling_fusion.hpp"
+
+#include <algorithm>
+
+#include "openvino/core/rt_info.hpp"
+#include "openvino/op/constant.hpp"
+#include "openvino/op/cum_sum.hpp"
+#include "openvino/op/divide.hpp"
+#include "openvino/op/gather.hpp"
+#include "openvino/op/gather_elements.hpp"
+#include "openvino/op/less.hpp"
+#include "openvino/op/multinomial.hpp"
+#include "openvino/op/multiply.hpp"
+#include "openvino/op/select.hpp"
+#include "openvino/op/softmax.hpp"
+#include "openvino/op/subtract.hpp"
+#include "openvino/op/util/topk_base.hpp"
+#include "openvino/pass/pattern/op/wrap_type.hpp"
+#include "transformations/cpu_opset/common/op/topk_sampling.hpp"
+
+#include "itt.hpp"
+
+namespace {
+
+bool has_single_consumer(const ov::Output<ov::Node>& output) {
+    return output.get_target_inputs().size() == 1;
+}
+
+// positive value of a scalar f32 constant or 0
+float get_positive_scalar(const ov::Output<ov::Node>& output) {
+    const auto constant = ov::as_type_ptr<ov::op::v0::Constant>(output.get_node_shared_ptr());
+    if (!constant || constant->get_element_type() != ov::element::f32 || ov::shape_size(constant->get_shape()) != 1)
+        return 0.f;
+    const auto value = constant->cast_vector<float>()[0];
+    return value > 0.f ? value : 0.f;
+}
+
+// skips the multiplication or the division of the logits by a positive scalar constant, the temperature is divided by
+// the scale, the skipped node is added to the fused ones
+ov::Output<ov::Node> skip_scale(const ov::Output<ov::Node>& output, float& temperature, ov::NodeVector& fused) {
+    const auto node = output.get_node_shared_ptr();
+    if (!has_single_consumer(output))
+        return output;
+    if (ov::is_type<ov::op::v1::Multiply>(node)) {
+        for (size_t i = 0; i < 2; i++) {
+            const auto scale = get_positive_scalar(node->input_value(1 - i));
+            if (scale > 0.f) {
+                temperature /= scale;
+                fused.push_back(node);
+                return node->input_value(i);
+            }
+        }
+    } else if (ov::is_type<ov::op::v1::Divide>(node)) {
+        const auto scale = get_positive_scalar(node->input_value(1));
+        if (scale > 0.f) {
+            temperature *= scale;
+            fused.push_back(node);
+            return node->input_value(0);
+        }
+    }
+    return output;
+}
+
+bool is_last_axis_cumsum(const std::shared_ptr<ov::Node>& node, bool exclusive) {
+    const auto cumsum = ov::as_type_ptr<ov::op::v0::CumSum>(node);
+    if (!cumsum || cumsum->is_reverse() || cumsum->is_exclusive() != exclusive ||
+        !has_single_consumer(cumsum->output(0)))
+        return false;
+    const auto axis = ov::as_type_ptr<ov::op::v0::Constant>(cumsum->get_input_node_shared_ptr(1));
+    if (!axis || ov::shape_size(axis->get_shape()) != 1)
+        return false;
+    const auto value = axis->cast_vector<int64_t>()[0];
+    return value == 1 || value == -1;
+}
+
+// skips the top_p mask of the probabilities: Select(Less(exclusive cumsum of probs, top_p), probs, 0), the mask nodes
+// are added to the fused ones
+ov::Output<ov::Node> skip_top_p_mask(const ov::Output<ov::Node>& output, float& top_p, ov::NodeVector& fused) {
+    const auto select = ov::as_type_ptr<ov::op::v1::Select>(output.get_node_shared_ptr());
+    if (!select || !has_single_consumer(output))
+        return output;
+    const auto zero = ov::as_type_ptr<ov::op::v0::Constant>(select->get_input_node_shared_ptr(2));
+    if (!zero || ov::shape_size(zero->get_shape()) != 1 || zero->cast_vector<float>()[0] != 0.f)
+        return output;
+    const auto probs = select->input_value(1);
+
+    const auto less = ov::as_type_ptr<ov::op::v1::Less>(select->get_input_node_shared_ptr(0));
+    if (!less || !has_single_consumer(less->output(0)))
+        return output;
+    const auto threshold = get_positive_scalar(less->input_value(1));
+    if (!(threshold > 0.f))
+        return output;
+
+    // the exclusive cumsum of the probabilities: CumSum(exclusive) or Subtract(CumSum, probs)
+    ov::NodeVector mask_nodes = {select, less};
+    auto exclusive_sum = less->get_input_node_shared_ptr(0);
+    if (is_last_axis_cumsum(exclusive_sum, true)) {
+        if (exclusive_sum->input_value(0) != probs)
+            return output;
+        mask_nodes.push_back(exclusive_sum);
+    } else {
+        const auto subtract = ov::as_type_ptr<ov::op::v1::Subtract>(exclusive_sum);
+        if (!subtract || !has_single_consumer(subtract->output(0)) || subtract->input_value(1) != probs)
+            return output;
+        const auto cumsum = subtract->get_input_node_shared_ptr(0);
+        if (!is_last_axis_cumsum(cumsum, false) || cumsum->input_value(0) != probs)
+            return output;
+        mask_nodes.push_back(subtract);
+        mask_nodes.push_back(cumsum);
+    }
+
+    // the probabilities are only consumed by the mask
+    const auto mask_consumers = mask_nodes.size() - 1;
+    if (probs.get_target_inputs().size() != mask_consumers)
+        return output;
+    top_p = std::min(threshold, 1.f);
+    fused.insert(fused.end(), mask_nodes.begin(), mask_nodes.end());
+    return probs;
+}
+
+bool is_last_axis_softmax(const std::shared_ptr<ov::Node>& node) {
+    if (const auto softmax = ov::as_type_ptr<ov::op::v1::Softmax>(node))
+        return softmax->get_axis() == 1;
+    if (const auto softmax = ov::as_type_ptr<ov::op::v8::Softmax>(node))
+        return softmax->get_axis() == 1 || softmax->get_axis() == -1;
+    return false;
+}
+
+// gather of the TopK indices by the Multinomial samples: indices[b, samples[b, s]]
+bool is_samples_gather(const std::shared_ptr<ov::Node>& node, const ov::Output<ov::Node>& samples) {
+    if (node->input_value(1) != samples)
+        return false;
+    if (const auto gather = ov::as_type_ptr<ov::op::v8::Gather>(node))
+        return gather->get_batch_dims() == 1 && (gather->get_axis() == 1 || gather->get_axis() == -1);
+    if (const auto gather = ov::as_type_ptr<ov::op::v6::GatherElements>(node))
+        return gather->get_axis() == 1 || gather->get_axis() == -1;
+    return false;
+}
+
+}  // namespace
+
+ov::intel_cpu::TopKSamplingFusion::TopKSamplingFusion() {
+    MATCHER_SCOPE(TopKSamplingFusion);
+    auto multinomial_m = ov::pass::pattern::wrap_type<ov::op::v13::Multinomial>();
+
+    ov::matcher_pass_callback callback = [=](ov::pass::pattern::Matcher& m) {
+        const auto multinomial = ov::as_type_ptr<ov::op::v13::Multinomial>(m.get_match_root());
+        if (!multinomial || transformation_callback(multinomial) || multinomial->get_log_probs())
+            return false;
+
+        ov::NodeVector fused = {multinomial};
+        float temperature = 1.f;
+        float top_p = 1.f;
+
+        // the consumers of the masked probabilities are checked with the mask
+        const auto probs = skip_top_p_mask(multinomial->input_value(0), top_p, fused);
+        const bool masked = probs != multinomial->input_value(0);
+        const auto softmax = probs.get_node_shared_ptr();
+        if (!is_last_axis_softmax(softmax) || (!masked && !has_single_consumer(softmax->output(0))))
+            return false;
+        fused.push_back(softmax);
+
+        const auto topk_values = skip_scale(softmax->input_value(0), temperature, fused);
+        const auto topk = ov::as_type_ptr<ov::op::util::TopKBase>(topk_values.get_node_shared_ptr());
+        if (!topk || topk_values.get_index() != 0 || !has_single_consumer(topk_values))
+            return false;
+        const auto& logits_shape = topk->get_input_partial_shape(0);
+        if (logits_shape.rank() != 2 || topk->get_axis() != 1 ||
+            topk->get_mode() != ov::op::TopKMode::MAX || topk->get_sort_type() != ov::op::TopKSortType::SORT_VALUES ||
+            !ov::is_type<ov::op::v0::Constant>(topk->get_input_node_ptr(1)) || topk->get_k() == 0)
+            return false;
+        fused.push_back(topk);
+
+        const auto logits = skip_scale(topk->input_value(0), temperature, fused);
+        if (logits.get_element_type() != ov::element::f32 || !(temperature > 0.f))
+            return false;
+
+        // the indices are either unused or only gathered by the samples
+        std::shared_ptr<ov::Node> indices_gather;
+        const auto indices_consumers = topk->output(1).get_target_inputs();
+        if (indices_consumers.size() > 1)
+            return false;
+        if (indices_consumers.size() == 1) {
+            indices_gather = indices_consumers.begin()->get_node()->shared_from_this();
+            if (indices_consumers.begin()->get_index() != 0 || !is_samples_gather(indices_gather, multinomial->output(0)))
+                return false;
+        }
+
+        TopKSamplingNode::Config config;
+        config.top_k = topk->get_k();
+        config.temperature = temperature;
+        config.top_p = top_p;
+        config.with_replacement = multinomial->get_with_replacement();
+        config.global_seed = multinomial->get_global_seed();
+        config.op_seed = multinomial->get_op_seed();
+        config.sample_type = multinomial->get_convert_type();
+        config.index_type = topk->get_index_element_type();
+
+        const auto sampling = std::make_shared<TopKSamplingNode>(logits, multinomial->input_value(1), config);
+        sampling->set_friendly_name(multinomial->get_friendly_name());
+        ov::copy_runtime_info(fused, sampling);
+
+        if (indices_gather) {
+            indices_gather->output(0).replace(sampling->output(1));
+        }
+        multinomial->output(0).replace(sampling->output(0));
+        return true;
+    };
+
+    auto m = std::make_shared<ov::pass::pattern::Matcher>(multinomial_m, matcher_name);
+    this->register_matcher(m, callback);
+}
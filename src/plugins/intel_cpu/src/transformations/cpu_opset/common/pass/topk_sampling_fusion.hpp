@@ -0,0 +1,30 @@
+// Copyright (C) 2018-2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <openvino/pass/graph_rewrite.hpp>
+
+namespace ov {
+namespace intel_cpu {
+
+/**
+ * Fuses the LLM sampling head TopK -> Softmax -> Multinomial into the TopKSampling operation. The scalings of the
+ * logits by a positive constant before TopK or Softmax become the temperature. The TopK indices may be unused or
+ * gathered by the Multinomial samples, then the gather is replaced by the second output of TopKSampling.
+ *
+ * The top_p (nucleus) mask of the probabilities before Multinomial is fused too:
+ *
+ *   probs -> CumSum -> Subtract(probs) -> Less(top_p) -> Select(probs, 0) -> Multinomial
+ *
+ * where the exclusive CumSum may replace the subtraction.
+ */
+class TopKSamplingFusion: public ov::pass::MatcherPass {
+public:
+    OPENVINO_RTTI("TopKSamplingFusion", "0");
+    TopKSamplingFusion();
+};
+
+}   // namespace intel_cpu
+}   // namespace ov
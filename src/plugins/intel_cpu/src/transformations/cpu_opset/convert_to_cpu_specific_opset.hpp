@@ -13,6 +13,7 @@
 #include "common/pass/convert_to_power_static.hpp"
 #include "common/pass/convert_to_leaky_relu.hpp"
 #include "common/pass/convert_to_swish_cpu.hpp"
+#include "common/pass/hoist_tensor_iterator_input_projection.hpp"
 #include "common/pass/move_fc_reshape_to_weights.hpp"
 #include "common/pass/split_fc.hpp"
 #include "transformations/convert_precision.hpp"
@@ -31,6 +32,8 @@ inline void ConvertToCPUSpecificOpset(std::shared_ptr<ov::Model> &nGraphFunc, in
 
     ov::pass::Manager manager;
     manager.set_per_pass_validation(false);
+    // before ConvertMatMulToFC, so the hoisted projection is executed as FullyConnected
+    CPU_REGISTER_PASS_COMMON(manager, HoistTensorIteratorInputProjection);
     CPU_REGISTER_PASS_COMMON(manager, ConvertMatMulToFC);
     CPU_REGISTER_PASS_X64(manager, MoveFCReshapeToWeights);
     CPU_REGISTER_PASS_X64(manager, ov::pass::Validate);
@@ -10,6 +10,9 @@ namespace intel_cpu {
 #define CPU_REGISTER_PASS_COMMON(MANAGER, PASS, ...) \
     MANAGER.register_pass<PASS>(__VA_ARGS__);
 
+#define CPU_REGISTER_PARALLEL_PASS_COMMON(MANAGER, PASS, ...) \
+    MANAGER.register_parallel_pass<PASS>(__VA_ARGS__);
+
 #define CPU_DISABLE_PASS_COMMON(MANAGER, PASS) \
     MANAGER.get_pass_config()->disable<PASS>();
 
@@ -123,6 +123,7 @@
 #include "transformations/cpu_opset/common/pass/rope_fusion.hpp"
 #include "transformations/cpu_opset/common/pass/causal_mask_preprocess_fusion.hpp"
 #include "transformations/cpu_opset/common/pass/stateful_sdpa_fusion.hpp"
+#include "transformations/cpu_opset/common/pass/topk_sampling_fusion.hpp"
 
 // Snippets
 #include "snippets/pass/tokenization.hpp"
@@ -148,6 +149,14 @@ namespace intel_cpu {
 
 using const_node_ptr = const std::shared_ptr<const ov::Node>;
 
+// The embedding bag nodes decompress the rows of the compressed embedding table on the fly
+static bool is_embedding_table(const ov::Input<ov::Node>& input) {
+    const auto node = input.get_node();
+    return input.get_index() == 0 && (ov::is_type<ov::opset3::EmbeddingBagOffsetsSum>(node) ||
+                                      ov::is_type<ov::opset3::EmbeddingBagPackedSum>(node) ||
+                                      ov::is_type<ov::opset3::EmbeddingSegmentsSum>(node));
+}
+
 bool Transformations::is_decompression_multiply(const_node_ptr& node) const {
     auto get_single_consumer = [](const_node_ptr& node) -> std::shared_ptr<ov::Node> {
         const auto consumers = node->get_output_target_inputs(0);
@@ -160,6 +169,9 @@ bool Transformations::is_decompression_multiply(const_node_ptr& node) const {
     if (!consumer)
         return false;
 
+    if (is_embedding_table(*node->get_output_target_inputs(0).begin()))
+        return true;
+
     if (ov::is_type<ov::opset1::MatMul>(consumer)) {
         return true;
     } else if (ov::is_type<ov::opset1::Reshape>(consumer)) {
@@ -293,11 +305,22 @@ void Transformations::PreLpt(const std::vector<ov::element::Type>& defaultPrecis
     // We need to fuse Transpose to MatMul to have a simpler callback for the next transformation
     CPU_REGISTER_PASS_X64(decompression_handling_manager, ov::pass::TransposeMatMul);
     ov::element::TypeVector decompression_precisions{ov::element::u8,
+                                                     ov::element::i8,
                                                      ov::element::u4,
                                                      ov::element::i4,
                                                      ov::element::nf4};
     CPU_REGISTER_PASS_X64(decompression_handling_manager, ov::pass::MarkDequantizationSubgraph, decompression_precisions, false);
     CPU_SET_CALLBACK_X64(decompression_handling_manager, [&](const_node_ptr &node) -> bool {
+        // i8 decompression is supported only for the embedding tables
+        auto is_i8_decompression = [](const_node_ptr& multiply) {
+            auto parent = multiply->get_input_node_shared_ptr(0);
+            if (ov::is_type<ov::opset1::Subtract>(parent))
+                parent = parent->get_input_node_shared_ptr(0);
+            return ov::is_type<ov::opset1::Convert>(parent) && parent->get_input_element_type(0) == ov::element::i8;
+        };
+        const auto& consumers = node->get_output_target_inputs(0);
+        if (is_i8_decompression(node))
+            return consumers.size() != 1 || !is_embedding_table(*consumers.begin());
         return !is_decompression_multiply(node);
     }, ov::pass::MarkDequantizationSubgraph);
 
@@ -315,6 +338,8 @@ void Transformations::PreLpt(const std::vector<ov::element::Type>& defaultPrecis
 
     ov::pass::Manager manager;
     manager.set_per_pass_validation(false);
+    // the passes registered by CPU_REGISTER_PARALLEL_PASS_COMMON are applied to the disjoint subgraphs in parallel
+    manager.set_parallel_matcher_passes(true);
     const bool useLpt = !defaultPrecisions.empty();
     if (useLpt)
         CPU_REGISTER_PASS_COMMON(manager, ov::pass::MarkDequantizationSubgraph, defaultPrecisions);
@@ -369,7 +394,8 @@ void Transformations::PreLpt(const std::vector<ov::element::Type>& defaultPrecis
     CPU_SET_CALLBACK_COMMON(manager,
         [](const_node_ptr &node) -> bool {
             const auto outputs = node->get_output_target_inputs(0);
-            return outputs.size() != 1 || !is_type<ov::op::v0::MatMul>(outputs.begin()->get_node());
+            return outputs.size() != 1 ||
+                   !(is_type<ov::op::v0::MatMul>(outputs.begin()->get_node()) || is_embedding_table(*outputs.begin()));
         },
         ov::pass::KeepConstAndDecompression);
 
@@ -381,14 +407,14 @@ void Transformations::PreLpt(const std::vector<ov::element::Type>& defaultPrecis
     CPU_REGISTER_PASS_COMMON(manager, ov::pass::ConvertSequenceToTensorIterator);
     CPU_REGISTER_PASS_COMMON(manager, ov::pass::ConvertOpSet3ToOpSet2);
     CPU_REGISTER_PASS_COMMON(manager, ov::pass::ConvertOpSet2ToOpSet1);
-    CPU_REGISTER_PASS_COMMON(manager, ov::pass::LSTMCellDecomposition);
-    CPU_REGISTER_PASS_COMMON(manager, ov::pass::GRUCellDecomposition);
-    CPU_REGISTER_PASS_COMMON(manager, ov::pass::RNNCellDecomposition);
-    CPU_REGISTER_PASS_COMMON(manager, ov::pass::ConvertNMS1ToNMS9);
-    CPU_REGISTER_PASS_COMMON(manager, ov::pass::ConvertNMS3ToNMS9);
-    CPU_REGISTER_PASS_COMMON(manager, ov::pass::ConvertNMS4ToNMS9);
-    CPU_REGISTER_PASS_COMMON(manager, ov::pass::ConvertNMS5ToNMS9);
-    CPU_REGISTER_PASS_COMMON(manager, ov::pass::ConvertNMS9ToNMSIEInternal);
+    CPU_REGISTER_PARALLEL_PASS_COMMON(manager, ov::pass::LSTMCellDecomposition);
+    CPU_REGISTER_PARALLEL_PASS_COMMON(manager, ov::pass::GRUCellDecomposition);
+    CPU_REGISTER_PARALLEL_PASS_COMMON(manager, ov::pass::RNNCellDecomposition);
+    CPU_REGISTER_PARALLEL_PASS_COMMON(manager, ov::pass::ConvertNMS1ToNMS9);
+    CPU_REGISTER_PARALLEL_PASS_COMMON(manager, ov::pass::ConvertNMS3ToNMS9);
+    CPU_REGISTER_PARALLEL_PASS_COMMON(manager, ov::pass::ConvertNMS4ToNMS9);
+    CPU_REGISTER_PARALLEL_PASS_COMMON(manager, ov::pass::ConvertNMS5ToNMS9);
+    CPU_REGISTER_PARALLEL_PASS_COMMON(manager, ov::pass::ConvertNMS9ToNMSIEInternal);
     CPU_REGISTER_PASS_COMMON(manager, ov::pass::Validate);
     CPU_REGISTER_PASS_COMMON(manager, ov::pass::ConvertMulticlassNmsToMulticlassNmsIE);
     CPU_REGISTER_PASS_COMMON(manager, ov::pass::Validate);
@@ -764,6 +790,7 @@ void Transformations::PostLpt() {
     CPU_REGISTER_PASS_X64(postLPTPassManager, EliminateStridedSlice);
     CPU_REGISTER_PASS_X64(postLPTPassManager, RoPEFusion);
     CPU_REGISTER_PASS_X64(postLPTPassManager, CausalMaskPreprocessFusion);
+    CPU_REGISTER_PASS_COMMON(postLPTPassManager, TopKSamplingFusion);
 
     CPU_REGISTER_PASS_X64(postLPTPassManager, StatefulSDPAFusion);
 
@@ -8,6 +8,8 @@
 #include "common_test_utils/node_builders/eltwise.hpp"
 #include "common_test_utils/node_builders/constant.hpp"
 #include "functional_test_utils/skip_tests_config.hpp"
+#include "internal_properties.hpp"
+#include "openvino/runtime/exec_model_info.hpp"
 
 #include <openvino/opsets/opset9.hpp>
 
@@ -125,4 +127,64 @@ INSTANTIATE_TEST_SUITE_P(smoke_ExportImportTest,
                                                              testing_property_for_enable_hyper_threading,
                                                              testing_property_for_enable_cpu_pinning)));
 
+TEST(ExportImportGraphDescriptors, smoke_ImportedModelMatchesCompiled) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED();
+    auto model = MakeMatMulModel();
+    ov::Core core;
+    auto compiled = core.compile_model(model, "CPU", {ov::intel_cpu::cache_graph_descriptors(true)});
+
+    std::stringstream exported_model;
+    compiled.export_model(exported_model);
+    // the descriptors selected for the compiled graph nodes created from the oneDNN descriptors (Softmax) are stored
+    ASSERT_NE(exported_model.str().find("<graph>"), std::string::npos);
+    auto imported = core.import_model(exported_model, "CPU", {ov::intel_cpu::cache_graph_descriptors(true)});
+
+    // the graph created from the imported model selects the same implementations and layouts
+    auto get_exec_value = [](const std::shared_ptr<ov::Node>& node, const std::string& name) {
+        const auto& rt_info = node->get_rt_info();
+        auto it = rt_info.find(name);
+        OPENVINO_ASSERT(rt_info.end() != it);
+        return it->second.as<std::string>();
+    };
+    std::map<std::string, std::shared_ptr<ov::Node>> compiled_nodes;
+    for (const auto& node : compiled.get_runtime_model()->get_ordered_ops()) {
+        compiled_nodes[node->get_friendly_name()] = node;
+    }
+    size_t softmax_nodes = 0;
+    for (const auto& node : imported.get_runtime_model()->get_ordered_ops()) {
+        auto it = compiled_nodes.find(node->get_friendly_name());
+        ASSERT_NE(it, compiled_nodes.end()) << node->get_friendly_name();
+        for (const auto& name : {ov::exec_model_info::IMPL_TYPE,
+                                 ov::exec_model_info::OUTPUT_LAYOUTS,
+                                 ov::exec_model_info::RUNTIME_PRECISION}) {
+            EXPECT_EQ(get_exec_value(it->second, name), get_exec_value(node, name))
+                << node->get_friendly_name() << " " << name;
+        }
+        if (get_exec_value(node, ov::exec_model_info::LAYER_TYPE) == "Softmax")
+            softmax_nodes++;
+    }
+    ASSERT_EQ(compiled_nodes.size(), imported.get_runtime_model()->get_ordered_ops().size());
+    ASSERT_EQ(softmax_nodes, 1u);
+
+    ov::Tensor input(ov::element::f32, {1, 4096});
+    auto* data = input.data<float>();
+    for (size_t i = 0; i < input.get_size(); i++) {
+        data[i] = static_cast<float>(i % 17) / 17.f;
+    }
+
+    auto compiled_request = compiled.create_infer_request();
+    compiled_request.set_input_tensor(input);
+    compiled_request.infer();
+    auto imported_request = imported.create_infer_request();
+    imported_request.set_input_tensor(input);
+    imported_request.infer();
+
+    const auto expected = compiled_request.get_output_tensor();
+    const auto actual = imported_request.get_output_tensor();
+    ASSERT_EQ(expected.get_shape(), actual.get_shape());
+    for (size_t i = 0; i < expected.get_size(); i++) {
+        EXPECT_NEAR(expected.data<float>()[i], actual.data<float>()[i], 1e-6f) << i;
+    }
+}
+
 }  // namespace
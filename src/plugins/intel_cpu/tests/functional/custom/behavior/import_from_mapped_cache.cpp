@@ -0,0 +1,103 @@
+// Copyright (C) 2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <fstream>
+
+#include "common_test_utils/file_utils.hpp"
+#include "common_test_utils/node_builders/constant.hpp"
+#include "openvino/op/add.hpp"
+#include "openvino/op/matmul.hpp"
+#include "openvino/runtime/core.hpp"
+
+namespace ov {
+namespace test {
+
+class ImportFromMappedCacheTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+#ifndef __linux__
+        GTEST_SKIP() << "The mapped files are looked up in /proc/self/maps";
+#endif
+        m_cache_dir = ov::test::utils::generateTestFilePrefix() + "_mapped_cache";
+    }
+
+    void TearDown() override {
+        ov::test::utils::removeFilesWithExt(m_cache_dir, "blob");
+        ov::test::utils::removeDir(m_cache_dir);
+    }
+
+    static std::shared_ptr<ov::Model> create_test_function() {
+        auto param = std::make_shared<ov::op::v0::Parameter>(element::f32, ov::Shape{1, 256});
+        auto weights = ov::test::utils::make_constant(element::f32, ov::Shape{256, 512});
+        auto matmul = std::make_shared<ov::op::v0::MatMul>(param, weights);
+        auto bias = ov::test::utils::make_constant(element::f32, ov::Shape{1, 512});
+        auto add = std::make_shared<ov::op::v1::Add>(matmul, bias);
+        auto result = std::make_shared<ov::op::v0::Result>(add);
+        return std::make_shared<ov::Model>(ResultVector{result}, ParameterVector{param});
+    }
+
+    std::string blob_file() const {
+        const auto blobs = ov::test::utils::listFilesWithExt(m_cache_dir, "blob");
+        EXPECT_EQ(1u, blobs.size());
+        return blobs.empty() ? std::string{} : blobs.front();
+    }
+
+    // checks whether the file is mapped to the process memory
+    static bool is_mapped(const std::string& file) {
+        const auto name = file.substr(file.find_last_of("/\\") + 1);
+        std::ifstream maps("/proc/self/maps");
+        std::string line;
+        while (std::getline(maps, line)) {
+            if (line.size() > name.size() && line.compare(line.size() - name.size(), name.size(), name) == 0 &&
+                line[line.size() - name.size() - 1] == '/')
+                return true;
+        }
+        return false;
+    }
+
+    std::string m_cache_dir;
+};
+
+TEST_F(ImportFromMappedCacheTest, smoke_ImportedConstantsReferenceMappedBlob) {
+    ov::Core core;
+    core.set_property(ov::cache_dir(m_cache_dir), ov::enable_mmap(true));
+    const auto model = create_test_function();
+
+    {
+        auto compiled_model = core.compile_model(model, "CPU");
+        ASSERT_FALSE(compiled_model.get_property(ov::loaded_from_cache));
+    }
+    const auto blob = blob_file();
+    ASSERT_FALSE(blob.empty());
+    ASSERT_FALSE(is_mapped(blob));
+
+    {
+        auto compiled_model = core.compile_model(model, "CPU");
+        ASSERT_TRUE(compiled_model.get_property(ov::loaded_from_cache));
+        // the constants of the imported model reference the mapped blob, so the mapping outlives the import
+        EXPECT_TRUE(is_mapped(blob));
+        compiled_model.create_infer_request().infer();
+    }
+    // and it's released with the compiled model
+    EXPECT_FALSE(is_mapped(blob));
+}
+
+TEST_F(ImportFromMappedCacheTest, smoke_ImportedConstantsAreCopiedWithoutMmap) {
+    ov::Core core;
+    core.set_property(ov::cache_dir(m_cache_dir), ov::enable_mmap(false));
+    const auto model = create_test_function();
+
+    core.compile_model(model, "CPU");
+    const auto blob = blob_file();
+    ASSERT_FALSE(blob.empty());
+
+    auto compiled_model = core.compile_model(model, "CPU");
+    ASSERT_TRUE(compiled_model.get_property(ov::loaded_from_cache));
+    EXPECT_FALSE(is_mapped(blob));
+}
+
+}  // namespace test
+}  // namespace ov
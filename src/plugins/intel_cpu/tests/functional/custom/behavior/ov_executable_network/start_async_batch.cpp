@@ -0,0 +1,84 @@
+// Copyright (C) 2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <future>
+
+#include "utils/properties_test.hpp"
+#include "openvino/runtime/core.hpp"
+#include "openvino/runtime/compiled_model.hpp"
+#include "openvino/runtime/properties.hpp"
+
+namespace {
+
+TEST_F(OVClassConfigTestCPU, smoke_CpuExecNetworkStartAsyncBatch) {
+    ov::Core ie;
+    auto compiledModel = ie.compile_model(model, deviceName, ov::num_streams(2));
+
+    constexpr size_t num_requests = 16;
+    std::vector<ov::InferRequest> requests;
+    for (size_t i = 0; i < num_requests; i++) {
+        requests.push_back(compiledModel.create_infer_request());
+    }
+
+    for (size_t iter = 0; iter < 2; iter++) {
+        std::promise<std::exception_ptr> done;
+        auto future = done.get_future();
+        ASSERT_NO_THROW(compiledModel.start_async(requests, [&done](std::exception_ptr exception) {
+            done.set_value(exception);
+        }));
+        ASSERT_EQ(future.get(), nullptr);
+        for (auto&& request : requests) {
+            ASSERT_NO_THROW(request.wait());
+        }
+    }
+}
+
+TEST_F(OVClassConfigTestCPU, smoke_CpuExecNetworkStartAsyncBatchRestoresCallbacks) {
+    ov::Core ie;
+    auto compiledModel = ie.compile_model(model, deviceName, ov::num_streams(2));
+
+    constexpr size_t num_requests = 4;
+    std::vector<ov::InferRequest> requests;
+    std::atomic<size_t> user_callbacks{0};
+    for (size_t i = 0; i < num_requests; i++) {
+        requests.push_back(compiledModel.create_infer_request());
+        requests.back().set_callback([&user_callbacks](std::exception_ptr) {
+            user_callbacks++;
+        });
+    }
+
+    std::promise<std::exception_ptr> done;
+    auto future = done.get_future();
+    ASSERT_NO_THROW(compiledModel.start_async(requests, [&done](std::exception_ptr exception) {
+        done.set_value(exception);
+    }));
+    ASSERT_EQ(future.get(), nullptr);
+    for (auto&& request : requests) {
+        ASSERT_NO_THROW(request.wait());
+    }
+    // the batch run doesn't call the callbacks of the requests
+    ASSERT_EQ(user_callbacks, 0);
+
+    // the callbacks of the requests are back, and the batch callback is not called again
+    for (auto&& request : requests) {
+        ASSERT_NO_THROW(request.start_async());
+        ASSERT_NO_THROW(request.wait());
+    }
+    ASSERT_EQ(user_callbacks, num_requests);
+}
+
+TEST_F(OVClassConfigTestCPU, smoke_CpuExecNetworkStartAsyncBatchThrowsOnForeignRequest) {
+    ov::Core ie;
+    auto compiledModel = ie.compile_model(model, deviceName);
+    auto otherCompiledModel = ie.compile_model(model, deviceName);
+
+    std::vector<ov::InferRequest> requests{compiledModel.create_infer_request(),
+                                           otherCompiledModel.create_infer_request()};
+    ASSERT_THROW(compiledModel.start_async(requests, {}), ov::Exception);
+}
+
+}  // namespace
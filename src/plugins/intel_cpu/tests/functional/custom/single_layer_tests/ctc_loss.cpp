@@ -223,6 +223,12 @@ const std::vector<CTCLossShapeParams> shapes = {
      },
      // target
      {{{1, 5, 6}, {10, 10, 12}, {5, 7, 8}}}},
+    {// long sequences, the extended targets are longer than a vector register
+     {
+         {-1, -1, -1},
+     },
+     // target
+     {{{2, 40, 33}, {4, 64, 20}}}},
 };
 
 const std::vector<int> blanks = {0, 2, 5};
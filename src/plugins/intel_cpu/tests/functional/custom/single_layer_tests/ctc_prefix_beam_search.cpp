@@ -0,0 +1,415 @@
+// Copyright (C) 2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <map>
+#include <numeric>
+#include <random>
+#include <sstream>
+
+#include "common_test_utils/ov_plugin_cache.hpp"
+#include "openvino/op/parameter.hpp"
+#include "openvino/op/result.hpp"
+#include "ov_ops/ctc_prefix_beam_search.hpp"
+#include "utils/cpu_test_utils.hpp"
+
+using namespace CPUTestUtils;
+
+namespace ov {
+namespace test {
+namespace {
+
+constexpr float neg_inf = -std::numeric_limits<float>::infinity();
+
+float log_add(float a, float b) {
+    const float max = std::max(a, b);
+    if (max == neg_inf)
+        return neg_inf;
+    return max + std::log1p(std::exp(std::min(a, b) - max));
+}
+
+struct Decoded {
+    std::vector<int32_t> classes;
+    float score;
+};
+
+/*
+ * The prefix beam search over the explicit prefixes: a prefix keeps the log probabilities of its alignments ending
+ * in the blank and in the last class. Like the CPU node, only the beam_size most probable classes of a time step
+ * extend the prefixes, so the search is exact when beam_size is not less than the number of classes.
+ */
+Decoded prefix_beam_search(const float* logits,
+                           size_t seqLen,
+                           size_t C,
+                           size_t beamSize,
+                           int32_t blank,
+                           float lmWeight,
+                           const std::vector<float>& tokenScores) {
+    using Probs = std::pair<float, float>;  // blank, non blank
+    auto score = [](const Probs& probs) {
+        return log_add(probs.first, probs.second);
+    };
+
+    std::map<std::vector<int32_t>, Probs> beams = {{{}, {0.f, neg_inf}}};
+    std::vector<float> logProbs(C);
+    for (size_t t = 0; t < seqLen; t++) {
+        const float* logitsT = logits + t * C;
+        const float maxLogit = *std::max_element(logitsT, logitsT + C);
+        float expSum = 0.f;
+        for (size_t c = 0; c < C; c++) {
+            expSum += std::exp(logitsT[c] - maxLogit);
+        }
+        for (size_t c = 0; c < C; c++) {
+            logProbs[c] = logitsT[c] - maxLogit - std::log(expSum);
+        }
+        std::vector<int32_t> candidates(C);
+        std::iota(candidates.begin(), candidates.end(), 0);
+        std::stable_sort(candidates.begin(), candidates.end(), [&](int32_t a, int32_t b) {
+            return logitsT[a] > logitsT[b];
+        });
+        candidates.resize(std::min(beamSize, C));
+
+        std::map<std::vector<int32_t>, Probs> next;
+        auto nextProbs = [&](const std::vector<int32_t>& prefix) -> Probs& {
+            return next.emplace(prefix, Probs{neg_inf, neg_inf}).first->second;
+        };
+        for (const auto& beam : beams) {
+            const auto& prefix = beam.first;
+            const float beamScore = score(beam.second);
+            auto& same = nextProbs(prefix);
+            same.first = log_add(same.first, beamScore + logProbs[blank]);
+            for (const auto label : candidates) {
+                if (label == blank)
+                    continue;
+                const float lmScore = lmWeight != 0.f ? lmWeight * tokenScores[label] : 0.f;
+                auto extendedPrefix = prefix;
+                extendedPrefix.push_back(label);
+                auto& extended = nextProbs(extendedPrefix);
+                if (!prefix.empty() && prefix.back() == label) {
+                    // the repeated class is merged unless the blank separates it
+                    same.second = log_add(same.second, beam.second.second + logProbs[label]);
+                    extended.second = log_add(extended.second, beam.second.first + logProbs[label] + lmScore);
+                } else {
+                    extended.second = log_add(extended.second, beamScore + logProbs[label] + lmScore);
+                }
+            }
+        }
+
+        std::vector<std::pair<std::vector<int32_t>, Probs>> ranked(next.begin(), next.end());
+        std::stable_sort(ranked.begin(), ranked.end(), [&](const auto& a, const auto& b) {
+            return score(a.second) > score(b.second);
+        });
+        ranked.resize(std::min(ranked.size(), beamSize));
+        beams = std::map<std::vector<int32_t>, Probs>(ranked.begin(), ranked.end());
+    }
+
+    const auto best = std::max_element(beams.begin(), beams.end(), [&](const auto& a, const auto& b) {
+        return score(a.second) < score(b.second);
+    });
+    return {best->first, score(best->second)};
+}
+
+std::string dims(const ov::Shape& shape) {
+    std::ostringstream result;
+    for (const auto dim : shape) {
+        result << "<dim>" << dim << "</dim>";
+    }
+    return result.str();
+}
+
+std::string parameter_layer(size_t id,
+                            const std::string& name,
+                            const std::string& precision,
+                            const ov::Shape& shape) {
+    std::ostringstream result;
+    result << "<layer id=\"" << id << "\" name=\"" << name << "\" type=\"Parameter\" version=\"opset1\">";
+    result << "<data shape=\"";
+    for (size_t i = 0; i < shape.size(); i++) {
+        result << (i ? "," : "") << shape[i];
+    }
+    result << "\" element_type=\"" << (precision == "FP32" ? "f32" : "i32") << "\"/>";
+    result << "<output><port id=\"0\" precision=\"" << precision << "\" names=\"" << name << "\">" << dims(shape)
+           << "</port></output></layer>";
+    return result.str();
+}
+
+std::string result_layer(size_t id, const std::string& precision, const ov::Shape& shape) {
+    std::ostringstream result;
+    result << "<layer id=\"" << id << "\" name=\"result_" << id << "\" type=\"Result\" version=\"opset1\">";
+    result << "<input><port id=\"0\" precision=\"" << precision << "\">" << dims(shape) << "</port></input></layer>";
+    return result.str();
+}
+
+}  // namespace
+
+using CTCPrefixBeamSearchParams = std::tuple<size_t,  // batch
+                                             size_t,  // max sequence length
+                                             size_t,  // classes number
+                                             size_t,  // beam_size
+                                             int,     // blank index, -1 - the default one (C - 1) without the input
+                                             float,   // lm_weight
+                                             bool>;   // peaked logits with the repeated classes
+
+/*
+ * No transformation creates CTCPrefixBeamSearch: the model is built with ov::op::internal::CTCPrefixBeamSearch, or
+ * read from IR (the "ie_internal_opset" layer version), which the Core supports once the CPU plugin library, exporting
+ * the operation as an extension, is loaded. The decoded prefixes are compared with the reference prefix beam search.
+ */
+class CTCPrefixBeamSearchLayerCPUTest : public testing::WithParamInterface<CTCPrefixBeamSearchParams>,
+                                        public ::testing::Test {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<CTCPrefixBeamSearchParams>& obj) {
+        size_t batch, maxSeqLen, classes, beamSize;
+        int blank;
+        float lmWeight;
+        bool peaked;
+        std::tie(batch, maxSeqLen, classes, beamSize, blank, lmWeight, peaked) = obj.param;
+
+        std::ostringstream result;
+        result << "batch=" << batch << "_";
+        result << "T=" << maxSeqLen << "_";
+        result << "C=" << classes << "_";
+        result << "beamSize=" << beamSize << "_";
+        result << "blank=" << (blank < 0 ? std::string("default") : std::to_string(blank)) << "_";
+        result << "lmWeight=" << lmWeight << "_";
+        result << "peaked=" << peaked;
+        return result.str();
+    }
+
+protected:
+    void SetUp() override {
+        std::tie(batch, maxSeqLen, classes, beamSize, blank, lmWeight, peaked) = GetParam();
+    }
+
+    size_t inputsNumber() const {
+        if (lmWeight != 0.f)
+            return 4;
+        return blank < 0 ? 2 : 3;
+    }
+
+    int32_t blankIndex() const {
+        return blank < 0 ? static_cast<int32_t>(classes) - 1 : blank;
+    }
+
+    std::string createIR() const {
+        const size_t decoderId = 4;
+        std::ostringstream layers;
+        std::ostringstream edges;
+        const std::vector<std::pair<std::string, ov::Shape>> inputs = {{"FP32", {batch, maxSeqLen, classes}},
+                                                                       {"I32", {batch}},
+                                                                       {"I32", {}},
+                                                                       {"FP32", {classes}}};
+        const std::vector<std::string> names = {"logits", "sequence_length", "blank_index", "token_scores"};
+        std::ostringstream decoderInputs;
+        for (size_t i = 0; i < inputsNumber(); i++) {
+            layers << parameter_layer(i, names[i], inputs[i].first, inputs[i].second);
+            decoderInputs << "<port id=\"" << i << "\" precision=\"" << inputs[i].first << "\">"
+                          << dims(inputs[i].second) << "</port>";
+            edges << "<edge from-layer=\"" << i << "\" from-port=\"0\" to-layer=\"" << decoderId << "\" to-port=\"" << i
+                  << "\"/>";
+        }
+
+        const std::vector<std::pair<std::string, ov::Shape>> outputs = {{"I32", {batch, maxSeqLen}},
+                                                                        {"I32", {batch}},
+                                                                        {"FP32", {batch}}};
+        const std::vector<std::string> outputNames = {"classes", "lengths", "score"};
+        layers << "<layer id=\"" << decoderId << "\" name=\"decoder\" type=\"CTCPrefixBeamSearch\" "
+               << "version=\"ie_internal_opset\"><data beam_size=\"" << beamSize << "\" lm_weight=\"" << lmWeight
+               << "\"/><input>" << decoderInputs.str() << "</input><output>";
+        for (size_t i = 0; i < outputs.size(); i++) {
+            layers << "<port id=\"" << 4 + i << "\" precision=\"" << outputs[i].first << "\" names=\""
+                   << outputNames[i] << "\">" << dims(outputs[i].second) << "</port>";
+        }
+        layers << "</output></layer>";
+        for (size_t i = 0; i < outputs.size(); i++) {
+            layers << result_layer(decoderId + 1 + i, outputs[i].first, outputs[i].second);
+            edges << "<edge from-layer=\"" << decoderId << "\" from-port=\"" << 4 + i << "\" to-layer=\""
+                  << decoderId + 1 + i << "\" to-port=\"0\"/>";
+        }
+
+        std::ostringstream ir;
+        ir << "<?xml version=\"1.0\"?><net name=\"CTCPrefixBeamSearch\" version=\"11\"><layers>" << layers.str()
+           << "</layers><edges>" << edges.str() << "</edges></net>";
+        return ir.str();
+    }
+
+    // the peaked logits follow the classes "a a blank a b b b blank blank c", so the best prefix repeats a
+    ov::Tensor createLogits() const {
+        ov::Tensor tensor(ov::element::f32, {batch, maxSeqLen, classes});
+        auto* data = tensor.data<float>();
+        std::mt19937 gen(42);
+        std::uniform_real_distribution<float> noise(peaked ? -0.5f : -2.f, peaked ? 0.5f : 2.f);
+        for (size_t i = 0; i < tensor.get_size(); i++) {
+            data[i] = noise(gen);
+        }
+        if (peaked) {
+            const int32_t b = blankIndex();
+            const auto label = [&](int32_t shift) {
+                return (b + shift) % static_cast<int32_t>(classes);
+            };
+            const std::vector<int32_t> pattern = {label(1), label(1), b, label(1), label(2),
+                                                  label(2), label(2), b, b,        label(3)};
+            for (size_t n = 0; n < batch; n++) {
+                for (size_t t = 0; t < maxSeqLen; t++) {
+                    data[(n * maxSeqLen + t) * classes + pattern[t % pattern.size()]] += 6.f;
+                }
+            }
+        }
+        return tensor;
+    }
+
+    // the full and the empty sequences, and the ones in between
+    ov::Tensor createSequenceLengths() const {
+        ov::Tensor tensor(ov::element::i32, {batch});
+        const std::vector<size_t> pattern = {maxSeqLen, 0, (maxSeqLen + 1) / 2, 1};
+        for (size_t n = 0; n < batch; n++) {
+            tensor.data<int32_t>()[n] = static_cast<int32_t>(std::min(pattern[n % pattern.size()], maxSeqLen));
+        }
+        return tensor;
+    }
+
+    std::vector<float> createTokenScores() const {
+        std::vector<float> scores(classes);
+        std::mt19937 gen(7);
+        std::uniform_real_distribution<float> dist(-3.f, 0.f);
+        for (auto& score : scores) {
+            score = dist(gen);
+        }
+        return scores;
+    }
+
+    std::shared_ptr<ov::Model> createModel() const {
+        ov::ParameterVector params{
+            std::make_shared<ov::op::v0::Parameter>(ov::element::f32, ov::Shape{batch, maxSeqLen, classes}),
+            std::make_shared<ov::op::v0::Parameter>(ov::element::i32, ov::Shape{batch})};
+        params[0]->output(0).set_names({"logits"});
+        params[1]->output(0).set_names({"sequence_length"});
+        std::shared_ptr<ov::Node> decoder;
+        if (inputsNumber() == 2) {
+            decoder = std::make_shared<ov::op::internal::CTCPrefixBeamSearch>(params[0], params[1], beamSize);
+        } else {
+            params.push_back(std::make_shared<ov::op::v0::Parameter>(ov::element::i32, ov::Shape{}));
+            params.back()->output(0).set_names({"blank_index"});
+            if (inputsNumber() == 3) {
+                decoder =
+                    std::make_shared<ov::op::internal::CTCPrefixBeamSearch>(params[0], params[1], params[2], beamSize);
+            } else {
+                params.push_back(std::make_shared<ov::op::v0::Parameter>(ov::element::f32, ov::Shape{classes}));
+                params.back()->output(0).set_names({"token_scores"});
+                decoder = std::make_shared<ov::op::internal::CTCPrefixBeamSearch>(params[0],
+                                                                                  params[1],
+                                                                                  params[2],
+                                                                                  params[3],
+                                                                                  beamSize,
+                                                                                  lmWeight);
+            }
+        }
+        const std::vector<std::string> outputNames = {"classes", "lengths", "score"};
+        ov::ResultVector results;
+        for (size_t i = 0; i < outputNames.size(); i++) {
+            decoder->output(i).set_names({outputNames[i]});
+            results.push_back(std::make_shared<ov::op::v0::Result>(decoder->output(i)));
+        }
+        return std::make_shared<ov::Model>(results, params, "CTCPrefixBeamSearch");
+    }
+
+    void compareWithRefs(const std::shared_ptr<ov::Model>& model) const {
+        std::shared_ptr<ov::Core> core = ov::test::utils::PluginCache::get().core();
+        auto compiledModel =
+            core->compile_model(model, ov::test::utils::DEVICE_CPU, ov::hint::inference_precision(ov::element::f32));
+        CheckNumberOfNodesWithType(compiledModel, "CTCPrefixBeamSearch", 1);
+
+        const auto logits = createLogits();
+        const auto sequenceLengths = createSequenceLengths();
+        const auto tokenScores = createTokenScores();
+        auto request = compiledModel.create_infer_request();
+        request.set_tensor("logits", logits);
+        request.set_tensor("sequence_length", sequenceLengths);
+        if (inputsNumber() > 2) {
+            ov::Tensor blankTensor(ov::element::i32, {});
+            blankTensor.data<int32_t>()[0] = blankIndex();
+            request.set_tensor("blank_index", blankTensor);
+        }
+        if (inputsNumber() > 3) {
+            ov::Tensor scoresTensor(ov::element::f32, {classes});
+            std::copy(tokenScores.begin(), tokenScores.end(), scoresTensor.data<float>());
+            request.set_tensor("token_scores", scoresTensor);
+        }
+        request.infer();
+
+        const auto classesTensor = request.get_tensor("classes");
+        const auto lengthsTensor = request.get_tensor("lengths");
+        const auto scoreTensor = request.get_tensor("score");
+        ASSERT_EQ(classesTensor.get_shape(), (ov::Shape{batch, maxSeqLen}));
+        const auto* decodedClasses = classesTensor.data<const int32_t>();
+        const auto* decodedLengths = lengthsTensor.data<const int32_t>();
+        const auto* scores = scoreTensor.data<const float>();
+        for (size_t n = 0; n < batch; n++) {
+            const size_t seqLen = static_cast<size_t>(sequenceLengths.data<const int32_t>()[n]);
+            const auto expected = prefix_beam_search(logits.data<const float>() + n * maxSeqLen * classes,
+                                                     seqLen,
+                                                     classes,
+                                                     beamSize,
+                                                     blankIndex(),
+                                                     lmWeight,
+                                                     tokenScores);
+            ASSERT_EQ(decodedLengths[n], static_cast<int32_t>(expected.classes.size())) << "batch " << n;
+            for (size_t t = 0; t < maxSeqLen; t++) {
+                const int32_t expectedClass = t < expected.classes.size() ? expected.classes[t] : -1;
+                ASSERT_EQ(decodedClasses[n * maxSeqLen + t], expectedClass) << "batch " << n << " step " << t;
+            }
+            ASSERT_NEAR(scores[n], expected.score, 1e-4f * std::max(1.f, std::fabs(expected.score))) << "batch " << n;
+
+            if (seqLen == 0) {
+                ASSERT_EQ(expected.score, 0.f);
+            }
+            // the blank separates the repeated class, so it's decoded twice
+            if (peaked && lmWeight == 0.f && seqLen >= 4) {
+                ASSERT_GE(expected.classes.size(), 2u);
+                ASSERT_EQ(expected.classes[0], expected.classes[1]) << "batch " << n;
+            }
+        }
+    }
+
+    size_t batch = 0;
+    size_t maxSeqLen = 0;
+    size_t classes = 0;
+    size_t beamSize = 0;
+    int blank = -1;
+    float lmWeight = 0.f;
+    bool peaked = false;
+};
+
+TEST_P(CTCPrefixBeamSearchLayerCPUTest, CompareWithRefs) {
+    std::shared_ptr<ov::Core> core = ov::test::utils::PluginCache::get().core();
+    // the Core registers the operations exported by the plugin library when it loads the plugin
+    core->get_versions(ov::test::utils::DEVICE_CPU);
+    compareWithRefs(core->read_model(createIR(), ov::Tensor()));
+}
+
+TEST_P(CTCPrefixBeamSearchLayerCPUTest, CompareWithRefsBuiltModel) {
+    compareWithRefs(createModel());
+}
+
+namespace {
+
+INSTANTIATE_TEST_SUITE_P(smoke_CTCPrefixBeamSearch,
+                         CTCPrefixBeamSearchLayerCPUTest,
+                         ::testing::Combine(::testing::Values(5),
+                                            ::testing::Values(1, 12),
+                                            ::testing::Values(8, 40),
+                                            ::testing::Values(1, 4, 16),
+                                            ::testing::Values(-1, 0, 3),
+                                            ::testing::Values(0.f, 0.5f),
+                                            ::testing::Values(false, true)),
+                         CTCPrefixBeamSearchLayerCPUTest::getTestCaseName);
+
+}  // namespace
+
+}  // namespace test
+}  // namespace ov
@@ -153,6 +153,17 @@ const auto testCasesAxis_negative =
                        ::testing::ValuesIn(exclusive),
                        ::testing::ValuesIn(reverse));
 
+// the long scan axis of a few slices is split between the threads
+const std::vector<InputShape> longAxisShapes = {
+    {{-1, -1}, {{1, 131072}, {2, 65536}, {3, 20000}}},
+    {{-1, -1, -1}, {{1, 40000, 3}, {1, 4096, 600}}}};
+
+const auto testCasesLongAxis = ::testing::Combine(::testing::Values(ov::element::i32),
+                                                  ::testing::ValuesIn(longAxisShapes),
+                                                  ::testing::Values(axes[1]),
+                                                  ::testing::ValuesIn(exclusive),
+                                                  ::testing::ValuesIn(reverse));
+
 INSTANTIATE_TEST_SUITE_P(smoke_CompareWithRefsNumpy_axis_0,
                          CumSumLayerCPUTest,
                          testCasesAxis_0,
@@ -185,6 +196,10 @@ INSTANTIATE_TEST_SUITE_P(smoke_CompareWithRefsNumpy_negative_axes,
                          CumSumLayerCPUTest,
                          testCasesAxis_negative,
                          CumSumLayerCPUTest::getTestCaseName);
+INSTANTIATE_TEST_SUITE_P(smoke_CompareWithRefsNumpy_long_axis,
+                         CumSumLayerCPUTest,
+                         testCasesLongAxis,
+                         CumSumLayerCPUTest::getTestCaseName);
 
 }  // namespace test
 }  // namespace ov
@@ -101,7 +101,7 @@ namespace {
 
 const std::vector<ElementType> inputPrecisions = {ElementType::f32, ElementType::bf16, ElementType::i8};
 
-const std::vector<ElementType> indexesPrecisions = {ElementType::i32};
+const std::vector<ElementType> indexesPrecisions = {ElementType::i32, ElementType::i64};
 
 const std::vector<InputShape> inputShapesDynamicBD_0 = {
     {{-1, -1, -1},                                      // dynamic
@@ -118,6 +118,9 @@ const std::vector<std::pair<Shape, std::vector<int>>> indexesShapesBD_0 = {
     std::pair<Shape, std::vector<int>>{{2, 2}, {3, 3, 2, 1}},
     std::pair<Shape, std::vector<int>>{{1, 2, 3}, {0, 1, 1, 1, 0, 2}},
     std::pair<Shape, std::vector<int>>{{2, 1, 1, 2}, {0, 2, 1, 1}},
+    std::pair<Shape, std::vector<int>>{{6, 3, 3}, {0, 1, 2, 3, 0, 1, 2, 3, 0, 1, 2, 3, 3, 2, 1, 0, 3, 2,
+                                                   1, 0, 3, 2, 1, 0, 0, 0, 1, 1, 2, 2, 3, 3, 0, 0, 1, 1,
+                                                   2, 2, 3, 3, 3, 3, 0, 2, 1, 3, 1, 0, 2, 0, 3, 1, 2, 1}},
 };
 
 const auto subset_BD0 = ::testing::Combine(::testing::ValuesIn(inputShapesDynamicBD_0),
@@ -6,6 +6,10 @@
 #include "common_test_utils/node_builders/constant.hpp"
 #include "common_test_utils/ov_tensor_utils.hpp"
 #include "common_test_utils/test_enums.hpp"
+#include "openvino/op/concat.hpp"
+#include "openvino/op/gather.hpp"
+#include "openvino/op/multiply.hpp"
+#include "openvino/op/shape_of.hpp"
 
 using namespace ov::test::utils;
 
@@ -442,6 +446,115 @@ class StaticLoopDynamicSubgraphCPUTest : public SubgraphBaseTest {
 };
 
 
+using LoopBackEdgeParams = typename std::tuple<
+        std::vector<InputShape>,                                           // X, initial H and W shapes
+        int64_t,                                                           // X slicing axis
+        bool>;                                                             // The body shapes grow
+
+/*
+ * The recurrence over the slices of X:
+ *
+ *   H[i + 1] = H[i] * W + X[i]          (stable body shapes)
+ *   H[i + 1] = Concat(H[i] * W, X[i])   (the body shapes grow each iteration)
+ *
+ * The trip count is the number of the slices. The static body passes H by the back edge without the copy and reads
+ * the contiguous slices (the axis 0) in place, the dynamic body keeps the back edge mappers while its shapes are
+ * stable and copies the equal dense memories.
+ */
+class LoopBackEdgeLayerCPUTest : public testing::WithParamInterface<LoopBackEdgeParams>,
+                                 virtual public SubgraphBaseTest {
+public:
+    static std::string getTestCaseName(testing::TestParamInfo<LoopBackEdgeParams> obj) {
+        std::vector<InputShape> shapes;
+        int64_t axis;
+        bool growing;
+        std::tie(shapes, axis, growing) = obj.param;
+
+        std::ostringstream result;
+        for (size_t i = 0; i < shapes.size(); i++) {
+            result << "Input" << i << "_";
+            result << "IS=" << ov::test::utils::partialShape2str({shapes[i].first}) << "_";
+            result << "TS=";
+            for (const auto& item : shapes[i].second) {
+                result << ov::test::utils::vec2str(item) << "_";
+            }
+        }
+        result << "axis=" << axis << "_";
+        result << "growing=" << growing;
+        return result.str();
+    }
+
+protected:
+    void generate_inputs(const std::vector<ov::Shape>& targetInputStaticShapes) override {
+        inputs.clear();
+        const auto& funcInputs = function->inputs();
+        for (size_t i = 0; i < funcInputs.size(); ++i) {
+            const auto& funcInput = funcInputs[i];
+            ov::test::utils::InputGenerateData in_data;
+            // W is a scalar in [0, 1), so H doesn't grow with the iterations and the growing H can be scaled
+            in_data.start_from = i == 2 ? 0 : -1;
+            in_data.range = i == 2 ? 1 : 2;
+            in_data.resolution = 32;
+            ov::Tensor tensor = ov::test::utils::create_and_fill_tensor(funcInput.get_element_type(), targetInputStaticShapes[i], in_data);
+            inputs.insert({funcInput.get_node_shared_ptr(), tensor});
+        }
+    }
+
+    void SetUp() override {
+        std::vector<InputShape> shapes;
+        int64_t axis;
+        bool growing;
+        std::tie(shapes, axis, growing) = this->GetParam();
+
+        targetDevice = ov::test::utils::DEVICE_CPU;
+        init_input_shapes(shapes);
+
+        ov::ParameterVector params;
+        for (auto&& shape : inputDynamicShapes) {
+            params.push_back(std::make_shared<ov::op::v0::Parameter>(ov::element::f32, shape));
+        }
+
+        auto shape_of = std::make_shared<ov::op::v3::ShapeOf>(params[0], ov::element::i64);
+        auto trip_count_input = std::make_shared<ov::op::v8::Gather>(shape_of,
+                                                                     ov::op::v0::Constant::create(ov::element::i64, {1}, {axis}),
+                                                                     ov::op::v0::Constant::create(ov::element::i64, {}, {0}));
+        auto exec_condition = std::make_shared<ov::op::v0::Constant>(ov::element::boolean, ov::Shape{1}, true);
+        auto body_condition_const = std::make_shared<ov::op::v0::Constant>(ov::element::boolean, ov::Shape{1}, true);
+
+        // the shapes of the body parameters are defined by the Loop inputs
+        ov::ParameterVector body_params;
+        for (size_t i = 0; i < params.size(); ++i) {
+            body_params.emplace_back(std::make_shared<ov::op::v0::Parameter>(ov::element::f32, ov::PartialShape::dynamic(3)));
+        }
+        const auto& xi = body_params[0];
+        const auto& h = body_params[1];
+        const auto& w = body_params[2];
+
+        auto scaled = std::make_shared<ov::op::v1::Multiply>(h, w);
+        std::shared_ptr<ov::Node> h_next;
+        if (growing) {
+            h_next = std::make_shared<ov::op::v0::Concat>(ov::OutputVector{scaled, xi}, 2);
+        } else {
+            h_next = std::make_shared<ov::op::v1::Add>(scaled, xi);
+        }
+        auto body = std::make_shared<ov::Model>(ov::OutputVector{body_condition_const, h_next}, body_params);
+
+        auto loop = std::make_shared<ov::op::v5::Loop>(trip_count_input, exec_condition);
+        loop->set_function(body);
+        loop->set_special_body_ports(ov::op::v5::Loop::SpecialBodyPorts{-1, 0});
+
+        loop->set_sliced_input(xi, params[0], 0, 1, 1, -1, axis);
+        loop->set_merged_input(h, params[1], h_next);
+        loop->set_invariant_input(w, params[2]);
+
+        ov::ResultVector results{std::make_shared<ov::op::v0::Result>(loop->get_iter_value(h_next, -1))};
+        if (!growing) {
+            results.push_back(std::make_shared<ov::op::v0::Result>(loop->get_concatenated_slices(h_next, 0, 1, 1, -1, axis)));
+        }
+        function = std::make_shared<ov::Model>(results, params, "loop");
+    }
+};
+
 TEST_P(LoopLayerCPUTest, CompareWithRefs) {
     run();
 }
@@ -462,6 +575,10 @@ TEST_F(StaticLoopDynamicSubgraphCPUTest, smoke_StaticLoopWithDynSubgraph) {
     run();
 }
 
+TEST_P(LoopBackEdgeLayerCPUTest, CompareWithRefs) {
+    run();
+}
+
 namespace {
 
 const std::vector<ElementType> inputPrecisions = {
@@ -675,6 +792,79 @@ INSTANTIATE_TEST_SUITE_P(smoke_LoopForConcat, LoopForConcatLayerCPUTest,
                                  ::testing::ValuesIn(inputPrecisions)),
                          LoopLayerCPUTest::getTestCaseName);
 
+// the static shapes are inferred twice, so the second inference starts with the swapped back edge buffers
+std::vector<std::vector<InputShape>> inputs_back_edge_static_axis0 = {
+    {
+        {{}, {{5, 2, 4}, {5, 2, 4}}},  // X
+        {{}, {{1, 2, 4}, {1, 2, 4}}},  // H
+        {{}, {{1, 1, 1}, {1, 1, 1}}},  // W
+    },
+    {
+        {{}, {{1, 3, 4}, {1, 3, 4}}},  // X
+        {{}, {{1, 3, 4}, {1, 3, 4}}},  // H
+        {{}, {{1, 1, 1}, {1, 1, 1}}},  // W
+    },
+};
+
+// the slices along the axis 1 are not contiguous for the batch 2
+std::vector<std::vector<InputShape>> inputs_back_edge_static_axis1 = {
+    {
+        {{}, {{2, 5, 4}, {2, 5, 4}}},  // X
+        {{}, {{2, 1, 4}, {2, 1, 4}}},  // H
+        {{}, {{1, 1, 1}, {1, 1, 1}}},  // W
+    },
+    {
+        {{}, {{1, 6, 4}, {1, 6, 4}}},  // X
+        {{}, {{1, 1, 4}, {1, 1, 4}}},  // H
+        {{}, {{1, 1, 1}, {1, 1, 1}}},  // W
+    },
+};
+
+INSTANTIATE_TEST_SUITE_P(smoke_LoopBackEdgeStaticAxis0, LoopBackEdgeLayerCPUTest,
+                         ::testing::Combine(
+                                 ::testing::ValuesIn(inputs_back_edge_static_axis0),
+                                 ::testing::Values(0),
+                                 ::testing::Values(false, true)),
+                         LoopBackEdgeLayerCPUTest::getTestCaseName);
+
+INSTANTIATE_TEST_SUITE_P(smoke_LoopBackEdgeStaticAxis1, LoopBackEdgeLayerCPUTest,
+                         ::testing::Combine(
+                                 ::testing::ValuesIn(inputs_back_edge_static_axis1),
+                                 ::testing::Values(1),
+                                 ::testing::Values(false, true)),
+                         LoopBackEdgeLayerCPUTest::getTestCaseName);
+
+// the trip count and the body shapes change between the inferences and come back
+std::vector<std::vector<InputShape>> inputs_back_edge_dynamic_axis0 = {
+    {
+        {{-1, -1, 4}, {{5, 2, 4}, {3, 2, 4}, {3, 3, 4}, {1, 1, 4}, {5, 2, 4}}},  // X
+        {{1, -1, 4}, {{1, 2, 4}, {1, 2, 4}, {1, 3, 4}, {1, 1, 4}, {1, 2, 4}}},   // H
+        {{1, 1, 1}, {{1, 1, 1}, {1, 1, 1}, {1, 1, 1}, {1, 1, 1}, {1, 1, 1}}},    // W
+    },
+};
+
+std::vector<std::vector<InputShape>> inputs_back_edge_dynamic_axis1 = {
+    {
+        {{-1, -1, 4}, {{2, 5, 4}, {2, 3, 4}, {3, 3, 4}, {1, 7, 4}, {2, 5, 4}}},  // X
+        {{-1, 1, 4}, {{2, 1, 4}, {2, 1, 4}, {3, 1, 4}, {1, 1, 4}, {2, 1, 4}}},   // H
+        {{1, 1, 1}, {{1, 1, 1}, {1, 1, 1}, {1, 1, 1}, {1, 1, 1}, {1, 1, 1}}},    // W
+    },
+};
+
+INSTANTIATE_TEST_SUITE_P(smoke_LoopBackEdgeDynamicAxis0, LoopBackEdgeLayerCPUTest,
+                         ::testing::Combine(
+                                 ::testing::ValuesIn(inputs_back_edge_dynamic_axis0),
+                                 ::testing::Values(0),
+                                 ::testing::Values(false, true)),
+                         LoopBackEdgeLayerCPUTest::getTestCaseName);
+
+INSTANTIATE_TEST_SUITE_P(smoke_LoopBackEdgeDynamicAxis1, LoopBackEdgeLayerCPUTest,
+                         ::testing::Combine(
+                                 ::testing::ValuesIn(inputs_back_edge_dynamic_axis1),
+                                 ::testing::Values(1),
+                                 ::testing::Values(false, true)),
+                         LoopBackEdgeLayerCPUTest::getTestCaseName);
+
 }  // namespace
 }  // namespace test
 }  // namespace ov
@@ -455,6 +455,41 @@ INSTANTIATE_TEST_SUITE_P(nightly_dynamic_bf16_BatchSizeOne, LSTMSequenceCPUTest,
                                ::testing::Values(additionalConfig[1])),
             LSTMSequenceCPUTest::getTestCaseName);
 
+// the sequence length changes and comes back with the same batch, so the primitives and the packed weights of the
+// lengths seen before are reused
+const std::vector<InputShape> dynamicSeqLenShapes = {
+    { {3, -1, 10},                                                              // Dynamic shape 0
+      { {3, 5, 10}, {3, 2, 10}, {3, 9, 10}, {3, 5, 10}, {3, 2, 10}, {3, 1, 10}, {3, 9, 10} } },
+    { {3, 1, 10},                                                               // Dynamic shape 1
+      { {3, 1, 10}, {3, 1, 10}, {3, 1, 10}, {3, 1, 10}, {3, 1, 10}, {3, 1, 10}, {3, 1, 10} } },
+    { {3, 1, 10},                                                               // Dynamic shape 2
+      { {3, 1, 10}, {3, 1, 10}, {3, 1, 10}, {3, 1, 10}, {3, 1, 10}, {3, 1, 10}, {3, 1, 10} } },
+    { {3},                                                                      // Static shape 3
+      { {3}, {3}, {3}, {3}, {3}, {3}, {3} } }
+};
+
+INSTANTIATE_TEST_SUITE_P(smoke_dynamic_seq_len, LSTMSequenceCPUTest,
+            ::testing::Combine(::testing::Values(dynamicSeqLenShapes),
+                               ::testing::ValuesIn(mode),
+                               ::testing::ValuesIn(activations),
+                               ::testing::ValuesIn(clip),
+                               ::testing::ValuesIn(direction),
+                               ::testing::ValuesIn(netPrecisions),
+                               ::testing::Values(cpuParams),
+                               ::testing::Values(ov::AnyMap{})),
+            LSTMSequenceCPUTest::getTestCaseName);
+
+INSTANTIATE_TEST_SUITE_P(nightly_dynamic_seq_len_bf16, LSTMSequenceCPUTest,
+            ::testing::Combine(::testing::Values(dynamicSeqLenShapes),
+                               ::testing::ValuesIn(mode),
+                               ::testing::ValuesIn(activations),
+                               ::testing::ValuesIn(clip),
+                               ::testing::ValuesIn(direction),
+                               ::testing::ValuesIn(netPrecisions),
+                               ::testing::Values(cpuParams),
+                               ::testing::Values(additionalConfig[1])),
+            LSTMSequenceCPUTest::getTestCaseName);
+
 // Odd but valid use case
 std::vector<InputShape> mixedDynamicStaticBatch {
     {{ {2, 3}, 5, 10},                         // Dynamic shape 0
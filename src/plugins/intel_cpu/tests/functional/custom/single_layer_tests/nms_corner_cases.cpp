@@ -0,0 +1,221 @@
+// Copyright (C) 2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "openvino/op/detection_output.hpp"
+#include "openvino/op/matrix_nms.hpp"
+#include "openvino/op/multiclass_nms.hpp"
+#include "shared_test_classes/base/ov_subgraph.hpp"
+#include "utils/cpu_test_utils.hpp"
+
+using namespace CPUTestUtils;
+
+namespace ov {
+namespace test {
+namespace {
+// The boxes with the not positive areas (the zero height, inverted and point ones), the duplicates and the box
+// inside another one. The scores of the different boxes have ties.
+const std::vector<float> nmsBoxes = {
+    0.0f, 0.0f, 1.0f, 1.0f,  // 0
+    0.0f, 0.0f, 1.0f, 1.0f,  // 1: the duplicate of 0
+    0.5f, 0.5f, 0.5f, 0.9f,  // 2: the zero height
+    0.2f, 0.2f, 0.1f, 0.1f,  // 3: inverted
+    2.0f, 2.0f, 3.0f, 3.0f,  // 4
+    2.0f, 2.0f, 3.0f, 3.0f,  // 5: the duplicate of 4
+    0.3f, 0.3f, 0.3f, 0.3f,  // 6: the point
+    0.1f, 0.1f, 0.9f, 0.9f,  // 7: inside 0
+};
+const std::vector<float> nmsScores = {
+    0.9f, 0.8f, 0.85f, 0.85f, 0.7f, 0.7f, 0.6f, 0.75f,  // class 0
+    0.7f, 0.7f, 0.9f, 0.6f, 0.85f, 0.85f, 0.7f, 0.8f,   // class 1
+};
+const size_t nmsBoxesNum = 8;
+const size_t nmsClassesNum = 2;
+
+ov::Tensor makeTensor(const ov::Shape& shape, const std::vector<float>& values) {
+    ov::Tensor tensor(ov::element::f32, shape);
+    OPENVINO_ASSERT(tensor.get_size() == values.size());
+    std::copy(values.begin(), values.end(), tensor.data<float>());
+    return tensor;
+}
+}  // namespace
+
+using NmsCornerCasesParams = std::tuple<std::string,  // NMS type
+                                        float,        // iou threshold (MulticlassNms) or post threshold (MatrixNms)
+                                        int,          // keep_top_k
+                                        bool>;        // normalized
+
+class NmsCornerCasesLayerCPUTest : public testing::WithParamInterface<NmsCornerCasesParams>,
+                                   virtual public SubgraphBaseTest,
+                                   public CPUTestsBase {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<NmsCornerCasesParams>& obj) {
+        std::string nmsType;
+        float threshold;
+        int keepTopK;
+        bool normalized;
+        std::tie(nmsType, threshold, keepTopK, normalized) = obj.param;
+
+        std::ostringstream result;
+        result << nmsType << "_";
+        result << "threshold=" << threshold << "_";
+        result << "keepTopK=" << keepTopK << "_";
+        result << "normalized=" << normalized;
+        return result.str();
+    }
+
+protected:
+    void SetUp() override {
+        targetDevice = ov::test::utils::DEVICE_CPU;
+
+        std::string nmsType;
+        float threshold;
+        int keepTopK;
+        bool normalized;
+        std::tie(nmsType, threshold, keepTopK, normalized) = GetParam();
+
+        init_input_shapes(static_shapes_to_test_representation({{1, nmsBoxesNum, 4}, {1, nmsClassesNum, nmsBoxesNum}}));
+        auto boxes = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, inputDynamicShapes[0]);
+        auto scores = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, inputDynamicShapes[1]);
+
+        std::shared_ptr<ov::Node> nms;
+        if (nmsType == "MulticlassNms") {
+            ov::op::v9::MulticlassNms::Attributes attrs;
+            attrs.sort_result_type = ov::op::v9::MulticlassNms::SortResultType::SCORE;
+            attrs.output_type = ov::element::i32;
+            attrs.iou_threshold = threshold;
+            attrs.score_threshold = 0.1f;
+            attrs.keep_top_k = keepTopK;
+            attrs.normalized = normalized;
+            nms = std::make_shared<ov::op::v9::MulticlassNms>(boxes, scores, attrs);
+        } else {
+            ov::op::v8::MatrixNms::Attributes attrs;
+            attrs.sort_result_type = ov::op::v8::MatrixNms::SortResultType::SCORE;
+            attrs.output_type = ov::element::i32;
+            attrs.score_threshold = 0.1f;
+            attrs.keep_top_k = keepTopK;
+            attrs.post_threshold = threshold;
+            attrs.normalized = normalized;
+            nms = std::make_shared<ov::op::v8::MatrixNms>(boxes, scores, attrs);
+        }
+        ov::ParameterVector params{boxes, scores};
+        function = makeNgraphFunction(ov::element::f32, params, nms, nmsType);
+    }
+
+    void generate_inputs(const std::vector<ov::Shape>& targetInputStaticShapes) override {
+        inputs.clear();
+        const auto& funcInputs = function->inputs();
+        inputs.insert({funcInputs[0].get_node_shared_ptr(), makeTensor(targetInputStaticShapes[0], nmsBoxes)});
+        inputs.insert({funcInputs[1].get_node_shared_ptr(), makeTensor(targetInputStaticShapes[1], nmsScores)});
+    }
+};
+
+TEST_P(NmsCornerCasesLayerCPUTest, CompareWithRefs) {
+    run();
+}
+
+namespace {
+
+// the not positive IoU threshold suppresses all the boxes except the first one of the class, even the degenerate ones
+INSTANTIATE_TEST_SUITE_P(smoke_MulticlassNmsCornerCases,
+                         NmsCornerCasesLayerCPUTest,
+                         ::testing::Combine(::testing::Values("MulticlassNms"),
+                                            ::testing::Values(0.5f, 0.0f, -0.1f),
+                                            ::testing::Values(-1, 3, 5),
+                                            ::testing::Values(true, false)),
+                         NmsCornerCasesLayerCPUTest::getTestCaseName);
+
+INSTANTIATE_TEST_SUITE_P(smoke_MatrixNmsCornerCases,
+                         NmsCornerCasesLayerCPUTest,
+                         ::testing::Combine(::testing::Values("MatrixNms"),
+                                            ::testing::Values(0.0f, 0.5f),
+                                            ::testing::Values(-1, 3, 5),
+                                            ::testing::Values(true, false)),
+                         NmsCornerCasesLayerCPUTest::getTestCaseName);
+
+}  // namespace
+
+/*
+ * DetectionOutput with the priors decoded as is (the zero locations with the variances encoded in the target), so the
+ * boxes are the priors: the zero width and the point ones, the duplicates and the box inside another one.
+ * keep_top_k cuts the detections of the same score, which are ordered by the prior index.
+ */
+class DetectionOutputKeepTopKTiesLayerCPUTest : public testing::WithParamInterface<int>,
+                                                virtual public SubgraphBaseTest,
+                                                public CPUTestsBase {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<int>& obj) {
+        std::ostringstream result;
+        result << "keepTopK=" << obj.param;
+        return result.str();
+    }
+
+protected:
+    static constexpr size_t priorsNum = 6;
+    static constexpr size_t classesNum = 3;
+
+    void SetUp() override {
+        targetDevice = ov::test::utils::DEVICE_CPU;
+
+        init_input_shapes(static_shapes_to_test_representation(
+            {{1, priorsNum * 4}, {1, priorsNum * classesNum}, {1, 1, priorsNum * 4}}));
+        ov::ParameterVector params;
+        for (const auto& shape : inputDynamicShapes) {
+            params.push_back(std::make_shared<ov::op::v0::Parameter>(ov::element::f32, shape));
+        }
+
+        ov::op::v0::DetectionOutput::Attributes attrs;
+        attrs.num_classes = static_cast<int>(classesNum);
+        attrs.background_label_id = 0;
+        attrs.top_k = -1;
+        attrs.keep_top_k = {GetParam()};
+        attrs.code_type = "caffe.PriorBoxParameter.CORNER";
+        attrs.share_location = true;
+        attrs.nms_threshold = 0.5f;
+        attrs.confidence_threshold = 0.1f;
+        attrs.variance_encoded_in_target = true;
+        attrs.normalized = true;
+        auto detectionOutput = std::make_shared<ov::op::v0::DetectionOutput>(params[0], params[1], params[2], attrs);
+        function = makeNgraphFunction(ov::element::f32, params, detectionOutput, "DetectionOutput");
+    }
+
+    void generate_inputs(const std::vector<ov::Shape>& targetInputStaticShapes) override {
+        const std::vector<float> priors = {
+            0.0f, 0.0f, 0.5f, 0.5f,  // 0
+            0.5f, 0.5f, 1.0f, 1.0f,  // 1
+            0.2f, 0.2f, 0.2f, 0.6f,  // 2: the zero width
+            0.6f, 0.6f, 0.6f, 0.6f,  // 3: the point
+            0.0f, 0.0f, 0.5f, 0.5f,  // 4: the duplicate of 0
+            0.1f, 0.1f, 0.4f, 0.4f,  // 5: inside 0
+        };
+        // the scores of the classes for each prior, the background class is ignored
+        const std::vector<float> confidence = {
+            0.1f, 0.8f, 0.5f,  // 0
+            0.1f, 0.6f, 0.9f,  // 1
+            0.1f, 0.6f, 0.4f,  // 2
+            0.1f, 0.6f, 0.45f,  // 3
+            0.1f, 0.7f, 0.6f,  // 4
+            0.1f, 0.3f, 0.6f,  // 5
+        };
+        const std::vector<float> locations(priorsNum * 4, 0.f);
+
+        inputs.clear();
+        const auto& funcInputs = function->inputs();
+        inputs.insert({funcInputs[0].get_node_shared_ptr(), makeTensor(targetInputStaticShapes[0], locations)});
+        inputs.insert({funcInputs[1].get_node_shared_ptr(), makeTensor(targetInputStaticShapes[1], confidence)});
+        inputs.insert({funcInputs[2].get_node_shared_ptr(), makeTensor(targetInputStaticShapes[2], priors)});
+    }
+};
+
+TEST_P(DetectionOutputKeepTopKTiesLayerCPUTest, CompareWithRefs) {
+    run();
+}
+
+// 10 detections are left after NMS, 5 of them have the same score 0.6, so keep_top_k 3 and 5 cut them
+INSTANTIATE_TEST_SUITE_P(smoke_DetectionOutputKeepTopKTies,
+                         DetectionOutputKeepTopKTiesLayerCPUTest,
+                         ::testing::Values(-1, 3, 5, 10),
+                         DetectionOutputKeepTopKTiesLayerCPUTest::getTestCaseName);
+
+}  // namespace test
+}  // namespace ov
@@ -176,5 +176,102 @@ INSTANTIATE_TEST_SUITE_P(smoke_CompareWithRefs,
                                             ::testing::ValuesIn(inputPrecisions),
                                             ::testing::ValuesIn(constantPrecisions)),
                          ScatterElementsUpdateLayerCPUTest::getTestCaseName);
+
+// Many updates of a few lines along the axis, they are partitioned between the threads by the destinations.
+using ScatterElementsUpdate12LargeParams = std::tuple<std::pair<ov::Shape, ov::Shape>,  // data and indices shapes
+                                                      std::int64_t,                     // axis
+                                                      ov::op::v12::ScatterElementsUpdate::Reduction,
+                                                      bool,                             // use_init_val
+                                                      ElementType>;                     // input precision
+
+class ScatterElementsUpdate12LargeCPUTest : public testing::WithParamInterface<ScatterElementsUpdate12LargeParams>,
+                                            public SubgraphBaseTest,
+                                            public CPUTestsBase {
+public:
+    static std::string getTestCaseName(testing::TestParamInfo<ScatterElementsUpdate12LargeParams> obj) {
+        std::pair<ov::Shape, ov::Shape> shapes;
+        std::int64_t axis;
+        ov::op::v12::ScatterElementsUpdate::Reduction reduction;
+        bool useInitVal;
+        ElementType inputPrecision;
+        std::tie(shapes, axis, reduction, useInitVal, inputPrecision) = obj.param;
+
+        std::ostringstream result;
+        result << inputPrecision << "_data=" << ov::test::utils::vec2str(shapes.first)
+               << "_indices=" << ov::test::utils::vec2str(shapes.second) << "_axis=" << axis
+               << "_reduction=" << reduction << "_use_init_val=" << useInitVal;
+        return result.str();
+    }
+
+protected:
+    void generate_inputs(const std::vector<ov::Shape>& targetInputStaticShapes) override {
+        inputs.clear();
+        const auto& funcInputs = function->inputs();
+        for (size_t i = 0; i < funcInputs.size(); ++i) {
+            const auto& funcInput = funcInputs[i];
+            ov::test::utils::InputGenerateData in_data;
+            if (i == 1) {
+                // the indices cover the axis including the negative values, so the destinations repeat many times
+                const auto axisDim = static_cast<int32_t>(targetInputStaticShapes[0][axis]);
+                in_data.start_from = -axisDim;
+                in_data.range = 2 * axisDim;
+            } else {
+                in_data.start_from = 0;
+                in_data.range = 10;
+                in_data.resolution = 1000;
+            }
+            auto tensor = ov::test::utils::create_and_fill_tensor(funcInput.get_element_type(),
+                                                                  targetInputStaticShapes[i],
+                                                                  in_data);
+            inputs.insert({funcInput.get_node_shared_ptr(), tensor});
+        }
+    }
+
+    void SetUp() override {
+        targetDevice = ov::test::utils::DEVICE_CPU;
+        std::pair<ov::Shape, ov::Shape> shapes;
+        ov::op::v12::ScatterElementsUpdate::Reduction reduction;
+        bool useInitVal;
+        ElementType inputPrecision;
+        std::tie(shapes, axis, reduction, useInitVal, inputPrecision) = this->GetParam();
+
+        init_input_shapes(static_shapes_to_test_representation({shapes.first, shapes.second, shapes.second}));
+        selectedType = makeSelectedTypeStr("unknown", inputPrecision);
+
+        auto dataParam = std::make_shared<ov::op::v0::Parameter>(inputPrecision, inputDynamicShapes[0]);
+        auto indicesParam = std::make_shared<ov::op::v0::Parameter>(ElementType::i32, inputDynamicShapes[1]);
+        auto updatesParam = std::make_shared<ov::op::v0::Parameter>(inputPrecision, inputDynamicShapes[2]);
+        auto axisNode = ov::op::v0::Constant::create(ElementType::i32, {}, {axis});
+        auto scatter = std::make_shared<ov::op::v12::ScatterElementsUpdate>(dataParam,
+                                                                            indicesParam,
+                                                                            updatesParam,
+                                                                            axisNode,
+                                                                            reduction,
+                                                                            useInitVal);
+
+        ov::ParameterVector allParams{dataParam, indicesParam, updatesParam};
+        function = makeNgraphFunction(inputPrecision, allParams, scatter, "ScatterElementsUpdate12LargeCPUTest");
+    }
+
+    std::int64_t axis = 0;
+};
+
+TEST_P(ScatterElementsUpdate12LargeCPUTest, CompareWithRefs) {
+    run();
+    CheckPluginRelatedResults(compiledModel, "ScatterUpdate");
+}
+
+INSTANTIATE_TEST_SUITE_P(smoke_CompareWithRefs,
+                         ScatterElementsUpdate12LargeCPUTest,
+                         ::testing::Combine(::testing::Values(std::make_pair(ov::Shape{1000}, ov::Shape{65536}),
+                                                              std::make_pair(ov::Shape{500, 3}, ov::Shape{40000, 3})),
+                                            ::testing::Values(0),
+                                            ::testing::Values(ov::op::v12::ScatterElementsUpdate::Reduction::NONE,
+                                                              ov::op::v12::ScatterElementsUpdate::Reduction::SUM,
+                                                              ov::op::v12::ScatterElementsUpdate::Reduction::MAX,
+                                                              ov::op::v12::ScatterElementsUpdate::Reduction::MEAN),
+                                            ::testing::Values(true, false),
+                                            ::testing::ValuesIn(inputPrecisions)),
+                         ScatterElementsUpdate12LargeCPUTest::getTestCaseName);
 }  // namespace test
 }  // namespace ov
@@ -180,6 +180,22 @@ INSTANTIATE_TEST_SUITE_P(smoke_static_1D,
                                             ::testing::Values(additionalConfig[0])),
                          UniqueLayerTestCPU::getTestCaseName);
 
+// the flattened tensors are sorted and grouped by several threads
+std::vector<std::vector<InputShape>> statShapesLarge = {
+    {{{}, {{4, 64, 1024}}}},  // Static shapes
+    {{{}, {{262147}}}},       // Static shapes
+};
+
+INSTANTIATE_TEST_SUITE_P(smoke_static_large,
+                         UniqueLayerTestCPU,
+                         ::testing::Combine(::testing::ValuesIn(statShapesLarge),
+                                            ::testing::Values(std::tuple<bool, int>{true, 0}),
+                                            ::testing::ValuesIn(sorted),
+                                            ::testing::ValuesIn(dataPrecisionSmoke),
+                                            ::testing::ValuesIn(getCPUInfo()),
+                                            ::testing::Values(additionalConfig[0])),
+                         UniqueLayerTestCPU::getTestCaseName);
+
 std::vector<std::vector<InputShape>> getStaticShapes() {
     std::vector<std::vector<InputShape>> result = {
         {{{}, {{1, 1, 1}}}},     // Static shapes
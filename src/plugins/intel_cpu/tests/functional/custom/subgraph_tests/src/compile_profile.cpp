@@ -0,0 +1,45 @@
+// Copyright (C) 2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include "common_test_utils/ov_plugin_cache.hpp"
+#include "internal_properties.hpp"
+#include "openvino/op/add.hpp"
+#include "openvino/op/constant.hpp"
+#include "openvino/op/relu.hpp"
+
+namespace ov {
+namespace test {
+
+class CompileProfileTest : public ::testing::Test {
+protected:
+    std::shared_ptr<ov::Model> create_test_function() {
+        auto param = std::make_shared<ov::op::v0::Parameter>(element::f32, ov::PartialShape{1, 16, 32, 32});
+        auto constant = ov::op::v0::Constant::create(element::f32, {1}, {1});
+        auto add = std::make_shared<ov::op::v1::Add>(param, constant);
+        auto relu = std::make_shared<ov::op::v0::Relu>(add);
+        auto result = std::make_shared<ov::op::v0::Result>(relu);
+        return std::make_shared<ov::Model>(ResultVector{result}, ParameterVector{param});
+    }
+};
+
+TEST_F(CompileProfileTest, smoke_CompileProfileReported) {
+    std::shared_ptr<ov::Core> core = ov::test::utils::PluginCache::get().core();
+    auto compiled_model = core->compile_model(create_test_function(), "CPU", {ov::enable_profiling(true)});
+
+    const auto profile = compiled_model.get_property(ov::intel_cpu::compile_profile);
+    EXPECT_EQ(profile.find("{\"passes\":[{\"name\":"), 0u);
+    EXPECT_NE(profile.find("\"applied_rewrites\":"), std::string::npos);
+}
+
+TEST_F(CompileProfileTest, smoke_CompileProfileDisabledByDefault) {
+    std::shared_ptr<ov::Core> core = ov::test::utils::PluginCache::get().core();
+    auto compiled_model = core->compile_model(create_test_function(), "CPU");
+
+    EXPECT_TRUE(compiled_model.get_property(ov::intel_cpu::compile_profile).empty());
+}
+
+}  // namespace test
+}  // namespace ov
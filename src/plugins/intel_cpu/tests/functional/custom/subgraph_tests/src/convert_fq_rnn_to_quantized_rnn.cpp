@@ -8,6 +8,9 @@
 #include "common_test_utils/node_builders/fake_quantize.hpp"
 #include "openvino/core/node.hpp"
 #include "openvino/core/type/element_type.hpp"
+#include "openvino/op/broadcast.hpp"
+#include "openvino/op/gather.hpp"
+#include "openvino/op/shape_of.hpp"
 #include "openvino/runtime/tensor.hpp"
 #include "shared_test_classes/base/ov_subgraph.hpp"
 #include "utils/cpu_test_utils.hpp"
@@ -151,11 +154,24 @@ protected:
 
         std::shared_ptr<ov::Node> rnnCellOp;
 
-        // fill sequence_length constant with max sequence length values
         const auto batchSize  = targetStaticShapes.front()[0][0];
-        const auto maxSeqLen  = targetStaticShapes.front()[0][1];
-        std::vector<int> lengths(batchSize, static_cast<int>(maxSeqLen));
-        auto seq_lengths = ov::op::v0::Constant::create(element::i64, Shape{batchSize}, lengths);
+        size_t maxSeqLen = 0;
+        for (const auto& shapes : targetStaticShapes)
+            maxSeqLen = std::max(maxSeqLen, shapes[0][1]);
+        std::shared_ptr<ov::Node> seq_lengths;
+        if (inputDynamicShapes[0][1].is_static()) {
+            // fill sequence_length constant with max sequence length values
+            std::vector<int> lengths(batchSize, static_cast<int>(maxSeqLen));
+            seq_lengths = ov::op::v0::Constant::create(element::i64, Shape{batchSize}, lengths);
+        } else {
+            // the lengths follow the input, so the same model runs the chunks of a varying length
+            auto shapeX = std::make_shared<ov::op::v3::ShapeOf>(inputParams[0], element::i64);
+            auto seqLen = std::make_shared<ov::op::v8::Gather>(shapeX,
+                                                               ov::op::v0::Constant::create(element::i64, {1}, {1}),
+                                                               ov::op::v0::Constant::create(element::i64, {}, {0}));
+            seq_lengths = std::make_shared<ov::op::v3::Broadcast>(seqLen,
+                                                                  ov::op::v0::Constant::create(element::i64, {1}, {batchSize}));
+        }
 
         if (rnnType == "LSTMSequence") {
             hasCell = true;
@@ -208,6 +224,15 @@ const std::vector<std::vector<InputShape>> staticShapesLSTM = {
     },
 };
 
+// the sequence length changes and comes back, so the packed weights of the different lengths are reused
+const std::vector<std::vector<InputShape>> dynamicSeqLenShapesLSTM = {
+    {
+        { {2, -1, 10}, { {2, 5, 10}, {2, 2, 10}, {2, 8, 10}, {2, 5, 10}, {2, 2, 10}, {2, 1, 10} } },  // X
+        { {2, 1, 4}, { {2, 1, 4}, {2, 1, 4}, {2, 1, 4}, {2, 1, 4}, {2, 1, 4}, {2, 1, 4} } },          // H
+        { {2, 1, 4}, { {2, 1, 4}, {2, 1, 4}, {2, 1, 4}, {2, 1, 4}, {2, 1, 4}, {2, 1, 4} } },          // C
+    },
+};
+
 std::vector<bool> quantizedHiddenStateParam{true, false};
 
 INSTANTIATE_TEST_SUITE_P(smoke_static, ConvertFqRnnToQuantizedRnn,
@@ -216,6 +241,12 @@ INSTANTIATE_TEST_SUITE_P(smoke_static, ConvertFqRnnToQuantizedRnn,
                                             ::testing::ValuesIn(staticShapesLSTM),
                                             ::testing::ValuesIn(quantizedHiddenStateParam)),
                          ConvertFqRnnToQuantizedRnn::getTestCaseName);
+
+INSTANTIATE_TEST_SUITE_P(smoke_dynamic_seq_len, ConvertFqRnnToQuantizedRnn,
+                         ::testing::Combine(::testing::Values("LSTMSequence", "GRUSequence"),
+                                            ::testing::ValuesIn(dynamicSeqLenShapesLSTM),
+                                            ::testing::ValuesIn(quantizedHiddenStateParam)),
+                         ConvertFqRnnToQuantizedRnn::getTestCaseName);
 } // namespace
 
 }  // namespace test
@@ -0,0 +1,90 @@
+// Copyright (C) 2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include "common_test_utils/ov_plugin_cache.hpp"
+#include "internal_properties.hpp"
+#include "openvino/op/add.hpp"
+#include "openvino/op/constant.hpp"
+#include "openvino/op/relu.hpp"
+#include "utils/cpu_test_utils.hpp"
+
+using namespace CPUTestUtils;
+
+namespace ov {
+namespace test {
+
+class ExecutionTraceTest : public ::testing::Test {
+protected:
+    std::shared_ptr<ov::Model> create_test_function() {
+        auto param = std::make_shared<ov::op::v0::Parameter>(element::f32, ov::PartialShape{1, 3, 8, 8});
+        auto constant = ov::op::v0::Constant::create(element::f32, {1}, {1});
+        auto add = std::make_shared<ov::op::v1::Add>(param, constant);
+        add->set_friendly_name("traced_add");
+        auto relu = std::make_shared<ov::op::v0::Relu>(add);
+        auto result = std::make_shared<ov::op::v0::Result>(relu);
+        return std::make_shared<ov::Model>(ResultVector{result}, ParameterVector{param});
+    }
+
+    static size_t count_events(const std::string& trace) {
+        const std::string complete_event = "\"ph\":\"X\"";
+        size_t count = 0;
+        for (auto pos = trace.find(complete_event); pos != std::string::npos;
+             pos = trace.find(complete_event, pos + complete_event.size())) {
+            count++;
+        }
+        return count;
+    }
+};
+
+TEST_F(ExecutionTraceTest, smoke_ExecutionTraceRecordsNodes) {
+    std::shared_ptr<ov::Core> core = ov::test::utils::PluginCache::get().core();
+    auto compiled_model = core->compile_model(create_test_function(),
+                                              "CPU",
+                                              {ov::intel_cpu::execution_trace_capacity(1024), ov::num_streams(1)});
+    auto req = compiled_model.create_infer_request();
+    constexpr size_t num_infers = 3;
+    for (size_t i = 0; i < num_infers; i++) {
+        req.infer();
+    }
+
+    const auto trace = compiled_model.get_property(ov::intel_cpu::execution_trace);
+    EXPECT_EQ(trace.find("{\"traceEvents\":["), 0u);
+    EXPECT_NE(trace.find("\"name\":\"traced_add\""), std::string::npos);
+    EXPECT_NE(trace.find("\"shape\":\"[1,3,8,8]"), std::string::npos);
+    EXPECT_NE(trace.find("\"name\":\"Infer\""), std::string::npos);
+    // at least the inference itself and a single node per inference
+    EXPECT_GE(count_events(trace), 2 * num_infers);
+}
+
+TEST_F(ExecutionTraceTest, smoke_ExecutionTraceKeepsLastEvents) {
+    std::shared_ptr<ov::Core> core = ov::test::utils::PluginCache::get().core();
+    constexpr int capacity = 2;
+    auto compiled_model = core->compile_model(create_test_function(),
+                                              "CPU",
+                                              {ov::intel_cpu::execution_trace_capacity(capacity), ov::num_streams(1)});
+    auto req = compiled_model.create_infer_request();
+    for (size_t i = 0; i < 4; i++) {
+        req.infer();
+    }
+
+    const auto trace = compiled_model.get_property(ov::intel_cpu::execution_trace);
+    EXPECT_EQ(count_events(trace), static_cast<size_t>(capacity));
+    // the inference event is recorded the last
+    EXPECT_NE(trace.find("\"name\":\"Infer\""), std::string::npos);
+}
+
+TEST_F(ExecutionTraceTest, smoke_ExecutionTraceDisabledByDefault) {
+    std::shared_ptr<ov::Core> core = ov::test::utils::PluginCache::get().core();
+    auto compiled_model = core->compile_model(create_test_function(), "CPU");
+    auto req = compiled_model.create_infer_request();
+    req.infer();
+
+    const auto trace = compiled_model.get_property(ov::intel_cpu::execution_trace);
+    EXPECT_EQ(count_events(trace), 0u);
+}
+
+}  // namespace test
+}  // namespace ov
@@ -0,0 +1,101 @@
+// Copyright (C) 2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <cstring>
+
+#include "common_test_utils/ov_plugin_cache.hpp"
+#include "internal_properties.hpp"
+#include "openvino/op/add.hpp"
+#include "openvino/op/constant.hpp"
+#include "openvino/op/relu.hpp"
+#include "utils/cpu_test_utils.hpp"
+
+#if defined(__linux__)
+#    include <linux/perf_event.h>
+#    include <sys/syscall.h>
+#    include <unistd.h>
+#endif
+
+using namespace CPUTestUtils;
+
+namespace ov {
+namespace test {
+
+namespace {
+// the same check the plugin does before opening the counters: the user space cycles of the calling thread
+bool perf_events_available() {
+#if defined(__linux__)
+    perf_event_attr attr;
+    std::memset(&attr, 0, sizeof(attr));
+    attr.type = PERF_TYPE_HARDWARE;
+    attr.size = sizeof(attr);
+    attr.config = PERF_COUNT_HW_CPU_CYCLES;
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+    const int fd = static_cast<int>(syscall(__NR_perf_event_open, &attr, 0, -1, -1, 0));
+    if (fd < 0)
+        return false;
+    close(fd);
+    return true;
+#else
+    return false;
+#endif
+}
+}  // namespace
+
+class HwPerfCountersTest : public ::testing::Test {
+protected:
+    std::shared_ptr<ov::Model> create_test_function() {
+        auto param = std::make_shared<ov::op::v0::Parameter>(element::f32, ov::PartialShape{1, 16, 32, 32});
+        auto constant = ov::op::v0::Constant::create(element::f32, {1}, {1});
+        auto add = std::make_shared<ov::op::v1::Add>(param, constant);
+        add->set_friendly_name("add");
+        // fused into the Add node
+        auto relu = std::make_shared<ov::op::v0::Relu>(add);
+        relu->set_friendly_name("relu");
+        auto result = std::make_shared<ov::op::v0::Result>(relu);
+        return std::make_shared<ov::Model>(ResultVector{result}, ParameterVector{param});
+    }
+};
+
+TEST_F(HwPerfCountersTest, smoke_HwPerfCountersReported) {
+    if (!perf_events_available()) {
+        GTEST_SKIP() << "perf events are not accessible";
+    }
+
+    std::shared_ptr<ov::Core> core = ov::test::utils::PluginCache::get().core();
+    auto compiled_model = core->compile_model(create_test_function(),
+                                              "CPU",
+                                              {ov::intel_cpu::hw_perf_counters(true), ov::num_streams(1)});
+    auto req = compiled_model.create_infer_request();
+    req.infer();
+    req.infer();
+
+    const auto report = compiled_model.get_property(ov::intel_cpu::hw_perf_counters_report);
+    ASSERT_EQ(report.count("add"), 1u);
+    const auto& add = report.at("add");
+    for (const auto& name : {"cycles", "instructions", "llc_misses", "memory_bandwidth_mb_per_s"}) {
+        ASSERT_EQ(add.count(name), 1u) << name;
+    }
+    EXPECT_GT(add.at("cycles"), 0u);
+    EXPECT_GT(add.at("instructions"), 0u);
+
+    // the fused node is executed by the Add node, so it reports the same counters
+    ASSERT_EQ(report.count("relu"), 1u);
+    EXPECT_EQ(report.at("relu"), add);
+}
+
+TEST_F(HwPerfCountersTest, smoke_HwPerfCountersDisabledByDefault) {
+    std::shared_ptr<ov::Core> core = ov::test::utils::PluginCache::get().core();
+    auto compiled_model = core->compile_model(create_test_function(), "CPU", {ov::enable_profiling(true)});
+    auto req = compiled_model.create_infer_request();
+    req.infer();
+
+    EXPECT_TRUE(compiled_model.get_property(ov::intel_cpu::hw_perf_counters_report).empty());
+}
+
+}  // namespace test
+}  // namespace ov
@@ -0,0 +1,79 @@
+// Copyright (C) 2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <numeric>
+
+#include "common_test_utils/ov_plugin_cache.hpp"
+#include "internal_properties.hpp"
+#include "openvino/op/add.hpp"
+#include "openvino/op/constant.hpp"
+#include "utils/cpu_test_utils.hpp"
+
+using namespace CPUTestUtils;
+
+namespace ov {
+namespace test {
+
+// The ROI tensors are not compatible with the graph input memory, so they are converted by the input staging stage
+class InputStagingTest : public ::testing::Test {
+protected:
+    std::shared_ptr<ov::Model> create_test_function() {
+        auto param = std::make_shared<ov::op::v0::Parameter>(element::f32, ov::PartialShape{1, 2, 2, 2});
+        param->get_output_tensor(0).set_names({"tensor_input_0"});
+        auto constant = ov::op::v0::Constant::create(element::f32, {1}, {1});
+        auto add = std::make_shared<ov::op::v1::Add>(param, constant);
+        auto result = std::make_shared<ov::op::v0::Result>(add);
+        result->get_output_tensor(0).set_names({"tensor_output_0"});
+        return std::make_shared<ov::Model>(ResultVector{result}, ParameterVector{param});
+    }
+
+    static void check_output(ov::InferRequest& req, float offset) {
+        // ROI {0, 1, 1, 1} - {1, 3, 3, 3} of the 1x4x4x4 iota tensor
+        static const std::vector<float> roi_values = {21, 22, 25, 26, 37, 38, 41, 42};
+        auto actual_tensor = req.get_tensor("tensor_output_0");
+        auto* actual = actual_tensor.data<float>();
+        for (size_t i = 0; i < roi_values.size(); i++) {
+            EXPECT_EQ(actual[i], roi_values[i] + offset + 1);
+        }
+    }
+};
+
+TEST_F(InputStagingTest, smoke_AsyncInputStagingROI) {
+    std::shared_ptr<ov::Core> core = ov::test::utils::PluginCache::get().core();
+    auto compiled_model = core->compile_model(create_test_function(),
+                                              "CPU",
+                                              {ov::intel_cpu::async_input_staging(true), ov::num_streams(2)});
+
+    constexpr size_t num_requests = 4;
+    const auto input_shape = Shape{1, 4, 4, 4};
+    std::vector<ov::InferRequest> requests;
+    std::vector<std::vector<float>> data(num_requests, std::vector<float>(ov::shape_size(input_shape)));
+    for (size_t i = 0; i < num_requests; i++) {
+        std::iota(data[i].begin(), data[i].end(), static_cast<float>(i * 100));
+        auto input_tensor = ov::Tensor(element::f32, input_shape, data[i].data());
+        requests.push_back(compiled_model.create_infer_request());
+        requests.back().set_tensor("tensor_input_0", ov::Tensor(input_tensor, {0, 1, 1, 1}, {1, 3, 3, 3}));
+    }
+
+    for (size_t iter = 0; iter < 3; iter++) {
+        for (auto& req : requests) {
+            req.start_async();
+        }
+        for (size_t i = 0; i < num_requests; i++) {
+            requests[i].wait();
+            check_output(requests[i], static_cast<float>(i * 100));
+        }
+    }
+
+    // the synchronous inference stages the inputs in place
+    for (size_t i = 0; i < num_requests; i++) {
+        requests[i].infer();
+        check_output(requests[i], static_cast<float>(i * 100));
+    }
+}
+
+}  // namespace test
+}  // namespace ov
@@ -0,0 +1,119 @@
+// Copyright (C) 2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include "common_test_utils/common_utils.hpp"
+#include "common_test_utils/file_utils.hpp"
+#include "internal_properties.hpp"
+#include "openvino/op/add.hpp"
+#include "openvino/op/multiply.hpp"
+#include "openvino/runtime/core.hpp"
+#include "openvino/runtime/system_conf.hpp"
+#include "openvino/util/file_util.hpp"
+
+namespace ov {
+namespace test {
+
+class JitKernelDiskCacheTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        m_cache_dir = ov::test::utils::generateTestFilePrefix() + "_jit_kernel_cache";
+        m_other_cache_dir = m_cache_dir + "_other";
+    }
+
+    void TearDown() override {
+        for (const auto& dir : {m_cache_dir, m_other_cache_dir}) {
+            ov::test::utils::removeFilesWithExt(dir, "bin");
+            // the model cache blobs
+            ov::test::utils::removeFilesWithExt(dir, "blob");
+            ov::test::utils::removeDir(dir);
+        }
+    }
+
+    static std::shared_ptr<ov::Model> create_test_function() {
+        // the chain, which is executed by the generic JIT eltwise kernel with the fused multiply
+        auto param0 = std::make_shared<ov::op::v0::Parameter>(element::f32, ov::Shape{4, 8, 16});
+        auto param1 = std::make_shared<ov::op::v0::Parameter>(element::f32, ov::Shape{4, 8, 16});
+        auto add = std::make_shared<ov::op::v1::Add>(param0, param1);
+        auto multiply = std::make_shared<ov::op::v1::Multiply>(add, param1);
+        auto result = std::make_shared<ov::op::v0::Result>(multiply);
+        return std::make_shared<ov::Model>(ResultVector{result}, ParameterVector{param0, param1});
+    }
+
+    static ov::AnyMap with_config(ov::AnyMap config) {
+        // the eltwise chain must not be tokenized by snippets, which kernels are not cached
+        config.emplace(ov::intel_cpu::snippets_mode(ov::intel_cpu::SnippetsMode::DISABLE));
+        return config;
+    }
+
+    static std::vector<float> infer(ov::CompiledModel& compiled_model) {
+        auto req = compiled_model.create_infer_request();
+        for (size_t port = 0; port < compiled_model.inputs().size(); port++) {
+            auto input = req.get_input_tensor(port);
+            auto* data = input.data<float>();
+            for (size_t i = 0; i < input.get_size(); i++) {
+                data[i] = static_cast<float>(i % 13) - static_cast<float>(port);
+            }
+        }
+        req.infer();
+        auto output = req.get_output_tensor();
+        return {output.data<float>(), output.data<float>() + output.get_size()};
+    }
+
+    static std::vector<float> infer(ov::Core& core, const ov::AnyMap& config) {
+        auto compiled_model = core.compile_model(create_test_function(), "CPU", with_config(config));
+        return infer(compiled_model);
+    }
+
+    std::string m_cache_dir;
+    std::string m_other_cache_dir;
+};
+
+TEST_F(JitKernelDiskCacheTest, smoke_KernelsAreStoredAndReused) {
+    if (!ov::with_cpu_x86_sse42())
+        GTEST_SKIP() << "The JIT eltwise kernel is not available";
+
+    ov::Core core;
+    const auto reference = infer(core, {});
+    EXPECT_EQ(reference, infer(core, {ov::intel_cpu::jit_kernel_cache_dir(m_cache_dir)}));
+    EXPECT_FALSE(ov::test::utils::listFilesWithExt(m_cache_dir, "bin").empty());
+
+    // the entries kept in memory belong to the compiled model, so the next one reads the kernels back from the disk
+    EXPECT_EQ(reference, infer(core, {ov::intel_cpu::jit_kernel_cache_dir(m_cache_dir)}));
+}
+
+TEST_F(JitKernelDiskCacheTest, smoke_ModelCacheDirDoesNotEnableKernelCache) {
+    if (!ov::with_cpu_x86_sse42())
+        GTEST_SKIP() << "The JIT eltwise kernel is not available";
+
+    ov::Core core;
+    const auto reference = infer(core, {});
+    EXPECT_EQ(reference, infer(core, {ov::cache_dir(m_other_cache_dir)}));
+    EXPECT_TRUE(ov::test::utils::listFilesWithExt(m_other_cache_dir, "bin").empty());
+    EXPECT_TRUE(ov::test::utils::listFilesWithExt(ov::util::path_join({m_other_cache_dir, "cpu_jit"}), "bin").empty());
+}
+
+TEST_F(JitKernelDiskCacheTest, smoke_ConcurrentModelsUseOwnDirectories) {
+    if (!ov::with_cpu_x86_sse42())
+        GTEST_SKIP() << "The JIT eltwise kernel is not available";
+
+    ov::Core core;
+    const auto reference = infer(core, {});
+    auto first = core.compile_model(create_test_function(),
+                                    "CPU",
+                                    with_config({ov::intel_cpu::jit_kernel_cache_dir(m_cache_dir)}));
+    auto second = core.compile_model(create_test_function(),
+                                     "CPU",
+                                     with_config({ov::intel_cpu::jit_kernel_cache_dir(m_other_cache_dir)}));
+    for (auto* compiled_model : {&first, &second}) {
+        EXPECT_EQ(reference, infer(*compiled_model));
+    }
+    // a compiled model doesn't switch the directory of another one
+    EXPECT_FALSE(ov::test::utils::listFilesWithExt(m_cache_dir, "bin").empty());
+    EXPECT_FALSE(ov::test::utils::listFilesWithExt(m_other_cache_dir, "bin").empty());
+}
+
+}  // namespace test
+}  // namespace ov
@@ -0,0 +1,222 @@
+// Copyright (C) 2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <numeric>
+#include <random>
+
+#include "common_test_utils/ov_plugin_cache.hpp"
+#include "openvino/op/constant.hpp"
+#include "openvino/op/cum_sum.hpp"
+#include "openvino/op/divide.hpp"
+#include "openvino/op/gather.hpp"
+#include "openvino/op/less.hpp"
+#include "openvino/op/multinomial.hpp"
+#include "openvino/op/select.hpp"
+#include "openvino/op/softmax.hpp"
+#include "openvino/op/subtract.hpp"
+#include "openvino/op/topk.hpp"
+#include "utils/cpu_test_utils.hpp"
+
+using namespace CPUTestUtils;
+
+namespace ov {
+namespace test {
+
+using TopKSamplingParams = std::tuple<size_t,  // batch
+                                      size_t,  // vocabulary size
+                                      size_t,  // top_k
+                                      size_t,  // samples number
+                                      bool,    // with_replacement
+                                      float>;  // top_p, 1 for no mask
+
+/*
+ * The sampling head:
+ *
+ *   logits -> Divide(temperature) -> TopK -> Softmax [-> top_p mask] -> Multinomial(seeds) -> samples
+ *                                      |                                      |
+ *                                   indices ----------------------------> Gather -> tokens
+ *
+ * where the top_p mask is Select(Less(CumSum(probs) - probs, top_p), probs, 0),
+ * is fused to TopKSampling, which draws the random values the same way as Multinomial, so the fused and the unfused
+ * models give the same samples and tokens. The unfused model has the probabilities as the extra output, which stops
+ * the fusion.
+ */
+class TopKSamplingCPUTest : public testing::WithParamInterface<TopKSamplingParams>, public ::testing::Test {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<TopKSamplingParams>& obj) {
+        size_t batch, vocab, topK, samples;
+        bool withReplacement;
+        float topP;
+        std::tie(batch, vocab, topK, samples, withReplacement, topP) = obj.param;
+
+        std::ostringstream result;
+        result << "batch=" << batch << "_";
+        result << "vocab=" << vocab << "_";
+        result << "topK=" << topK << "_";
+        result << "samples=" << samples << "_";
+        result << "withReplacement=" << withReplacement << "_";
+        result << "topP=" << topP;
+        return result.str();
+    }
+
+protected:
+    std::shared_ptr<ov::Model> createModel(bool withProbabilitiesOutput) const {
+        size_t batch, vocab, topK, samples;
+        bool withReplacement;
+        float topP;
+        std::tie(batch, vocab, topK, samples, withReplacement, topP) = GetParam();
+
+        auto logits = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, ov::PartialShape{-1, -1});
+        auto temperature = ov::op::v0::Constant::create(ov::element::f32, {}, {0.7f});
+        auto scaled = std::make_shared<ov::op::v1::Divide>(logits, temperature);
+        auto k = ov::op::v0::Constant::create(ov::element::i64, {}, {topK});
+        auto topk = std::make_shared<ov::op::v11::TopK>(scaled,
+                                                        k,
+                                                        1,
+                                                        ov::op::TopKMode::MAX,
+                                                        ov::op::TopKSortType::SORT_VALUES,
+                                                        ov::element::i32);
+        auto softmax = std::make_shared<ov::op::v8::Softmax>(topk->output(0), -1);
+        ov::Output<ov::Node> probs = softmax;
+        if (topP < 1.f) {
+            // the candidates which preceding probabilities sum to top_p or more are dropped
+            auto cumsumAxis = ov::op::v0::Constant::create(ov::element::i64, {}, {-1});
+            auto cumsum = std::make_shared<ov::op::v0::CumSum>(softmax, cumsumAxis);
+            auto exclusiveSum = std::make_shared<ov::op::v1::Subtract>(cumsum, softmax);
+            auto threshold = ov::op::v0::Constant::create(ov::element::f32, {}, {topP});
+            auto mask = std::make_shared<ov::op::v1::Less>(exclusiveSum, threshold);
+            auto zero = ov::op::v0::Constant::create(ov::element::f32, {}, {0.f});
+            probs = std::make_shared<ov::op::v1::Select>(mask, softmax, zero);
+        }
+        auto samplesNum = ov::op::v0::Constant::create(ov::element::i32, {1}, {samples});
+        auto multinomial = std::make_shared<ov::op::v13::Multinomial>(probs,
+                                                                      samplesNum,
+                                                                      ov::element::i32,
+                                                                      withReplacement,
+                                                                      false,
+                                                                      1,
+                                                                      2);
+        auto axis = ov::op::v0::Constant::create(ov::element::i32, {}, {1});
+        auto tokens = std::make_shared<ov::op::v8::Gather>(topk->output(1), multinomial, axis, 1);
+
+        ov::ResultVector results{std::make_shared<ov::op::v0::Result>(multinomial),
+                                 std::make_shared<ov::op::v0::Result>(tokens)};
+        if (withProbabilitiesOutput) {
+            results.push_back(std::make_shared<ov::op::v0::Result>(softmax));
+        }
+        return std::make_shared<ov::Model>(results, ov::ParameterVector{logits}, "TopKSampling");
+    }
+
+    // the distinct logits, so the order of the TopK outputs doesn't depend on the implementation
+    ov::Tensor createLogits() const {
+        size_t batch, vocab;
+        std::tie(batch, vocab, std::ignore, std::ignore, std::ignore, std::ignore) = GetParam();
+
+        ov::Tensor tensor(ov::element::f32, {batch, vocab});
+        auto* data = tensor.data<float>();
+        std::mt19937 gen(42);
+        std::vector<size_t> order(vocab);
+        for (size_t b = 0; b < batch; b++) {
+            std::iota(order.begin(), order.end(), 0);
+            std::shuffle(order.begin(), order.end(), gen);
+            for (size_t i = 0; i < vocab; i++) {
+                data[b * vocab + i] = 0.01f * static_cast<float>(order[i]) - 10.f;
+            }
+        }
+        return tensor;
+    }
+
+    std::vector<ov::Tensor> infer(const ov::CompiledModel& compiledModel, const ov::Tensor& logits) const {
+        auto request = compiledModel.create_infer_request();
+        request.set_input_tensor(logits);
+        request.infer();
+        return {request.get_output_tensor(0), request.get_output_tensor(1)};
+    }
+};
+
+TEST_P(TopKSamplingCPUTest, CompareWithUnfused) {
+    std::shared_ptr<ov::Core> core = ov::test::utils::PluginCache::get().core();
+    auto fusedModel = core->compile_model(createModel(false), ov::test::utils::DEVICE_CPU);
+    CheckNumberOfNodesWithType(fusedModel, "TopKSampling", 1);
+    CheckNumberOfNodesWithType(fusedModel, "Multinomial", 0);
+    auto unfusedModel = core->compile_model(createModel(true), ov::test::utils::DEVICE_CPU);
+    CheckNumberOfNodesWithType(unfusedModel, "TopKSampling", 0);
+    CheckNumberOfNodesWithType(unfusedModel, "Multinomial", 1);
+
+    size_t topK;
+    bool withReplacement;
+    std::tie(std::ignore, std::ignore, topK, std::ignore, withReplacement, std::ignore) = GetParam();
+
+    const auto logits = createLogits();
+    // the second inference of the same model repeats the samples, the random values only depend on the seeds
+    for (size_t i = 0; i < 2; i++) {
+        const auto fused = infer(fusedModel, logits);
+        const auto unfused = infer(unfusedModel, logits);
+        for (size_t out = 0; out < fused.size(); out++) {
+            ASSERT_EQ(fused[out].get_shape(), unfused[out].get_shape());
+            ASSERT_EQ(fused[out].get_element_type(), ov::element::i32);
+            const auto* fusedData = fused[out].data<const int32_t>();
+            const auto* unfusedData = unfused[out].data<const int32_t>();
+            for (size_t j = 0; j < fused[out].get_size(); j++) {
+                ASSERT_EQ(fusedData[j], unfusedData[j]) << "output " << out << " element " << j;
+            }
+        }
+
+        const auto shape = fused[0].get_shape();
+        const auto* sampleIndices = fused[0].data<const int32_t>();
+        for (size_t b = 0; b < shape[0]; b++) {
+            std::vector<bool> selected(topK, false);
+            for (size_t s = 0; s < shape[1]; s++) {
+                const auto index = sampleIndices[b * shape[1] + s];
+                ASSERT_GE(index, 0);
+                ASSERT_LT(static_cast<size_t>(index), topK);
+                // the greedy search when top_k is 1
+                if (topK == 1) {
+                    ASSERT_EQ(index, 0);
+                }
+                if (!withReplacement) {
+                    ASSERT_FALSE(selected[index]) << "batch " << b << " sample " << s;
+                    selected[index] = true;
+                }
+            }
+        }
+    }
+}
+
+namespace {
+
+INSTANTIATE_TEST_SUITE_P(smoke_TopKSampling,
+                         TopKSamplingCPUTest,
+                         ::testing::Values(TopKSamplingParams{4, 1000, 10, 5, false, 1.f},
+                                           TopKSamplingParams{4, 1000, 10, 5, true, 1.f},
+                                           TopKSamplingParams{3, 1000, 10, 10, false, 1.f},
+                                           // top_k 1
+                                           TopKSamplingParams{3, 1000, 1, 1, false, 1.f},
+                                           TopKSamplingParams{1, 1000, 1, 3, true, 1.f}),
+                         TopKSamplingCPUTest::getTestCaseName);
+
+// the batches are fewer than the threads and the vocabulary is large, so the heap selection is chunked
+INSTANTIATE_TEST_SUITE_P(smoke_TopKSamplingChunked,
+                         TopKSamplingCPUTest,
+                         ::testing::Values(TopKSamplingParams{1, 50000, 40, 3, false, 1.f},
+                                           TopKSamplingParams{2, 50000, 40, 3, true, 1.f},
+                                           TopKSamplingParams{1, 50000, 1, 2, true, 1.f}),
+                         TopKSamplingCPUTest::getTestCaseName);
+
+// the nucleus keeps about a half of the top_k candidates, so it's larger than the samples without replacement
+INSTANTIATE_TEST_SUITE_P(smoke_TopKSamplingTopP,
+                         TopKSamplingCPUTest,
+                         ::testing::Values(TopKSamplingParams{4, 1000, 10, 3, false, 0.5f},
+                                           TopKSamplingParams{4, 1000, 10, 5, true, 0.5f},
+                                           TopKSamplingParams{3, 1000, 20, 4, true, 0.9f},
+                                           TopKSamplingParams{2, 50000, 40, 3, false, 0.8f}),
+                         TopKSamplingCPUTest::getTestCaseName);
+
+}  // namespace
+
+}  // namespace test
+}  // namespace ov
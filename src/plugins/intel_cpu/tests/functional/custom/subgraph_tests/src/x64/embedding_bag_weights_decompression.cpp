@@ -0,0 +1,254 @@
+// Copyright (C) 2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "common_test_utils/node_builders/constant.hpp"
+#include "openvino/op/convert.hpp"
+#include "openvino/op/embedding_segments_sum.hpp"
+#include "openvino/op/embeddingbag_offsets_sum.hpp"
+#include "openvino/op/embeddingbag_packedsum.hpp"
+#include "openvino/op/matmul.hpp"
+#include "openvino/op/multiply.hpp"
+#include "openvino/op/subtract.hpp"
+#include "shared_test_classes/base/ov_subgraph.hpp"
+#include "transformations/rt_info/decompression.hpp"
+#include "utils/cpu_test_utils.hpp"
+
+using namespace CPUTestUtils;
+
+namespace ov {
+namespace test {
+/*
+ * TP - table precision
+ *
+ *    Table(TP)   Zero_point(TP)
+ *       |            |
+ *    Convert      Convert
+ *         \       /
+ *       Subtract(Opt)   Scale
+ *               \       /
+ *   f16/bf16: - Multiply      (u8/i8 tables only)
+ *                  |
+ *   Indices    Offsets/Segment_ids    Per_sample_weights
+ *        \        |                     /
+ *       EmbeddingBagOffsetsSum / EmbeddingBagPackedSum / EmbeddingSegmentsSum
+ */
+using EmbeddingBagWeightsDecompressionParams = std::tuple<std::string,           // embedding bag type
+                                                          ov::Shape,             // table shape
+                                                          ov::test::ElementType, // table precision
+                                                          bool,                  // with decompression subtract
+                                                          bool>;                 // per-row decompression constants
+
+class EmbeddingBagWeightsDecompression : public testing::WithParamInterface<EmbeddingBagWeightsDecompressionParams>,
+                                         virtual public SubgraphBaseTest,
+                                         public CPUTestsBase {
+public:
+    static std::string getTestCaseName(testing::TestParamInfo<EmbeddingBagWeightsDecompressionParams> obj) {
+        std::string bag_type;
+        ov::Shape table_shape;
+        ov::test::ElementType table_precision;
+        bool with_subtract;
+        bool per_row;
+        std::tie(bag_type, table_shape, table_precision, with_subtract, per_row) = obj.param;
+
+        std::ostringstream result;
+        result << bag_type << "_";
+        result << "table_shape=" << table_shape << "_";
+        result << "table_precision=" << table_precision << "_";
+        result << "with_subtract=" << with_subtract << "_";
+        result << "per_row=" << per_row;
+        return result.str();
+    }
+
+protected:
+    void SetUp() override {
+        targetDevice = ov::test::utils::DEVICE_CPU;
+
+        std::string bag_type;
+        ov::Shape table_shape;
+        ov::test::ElementType table_precision;
+        bool with_subtract;
+        bool per_row;
+        std::tie(bag_type, table_shape, table_precision, with_subtract, per_row) = GetParam();
+
+        const size_t rows = table_shape[0];
+        const auto last_row = static_cast<int32_t>(rows - 1);
+        // the skewed bags: the empty one, the bag of the most indices and the repeated indices
+        const std::vector<int32_t> indices{0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 2, 2, 0, last_row};
+        const std::vector<int32_t> offsets{0, 12, 12, 14};
+        const std::vector<int32_t> segment_ids{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 2, 3, 3};
+        // the bags of the same size with the repeated indices
+        const std::vector<int32_t> packed_indices{0, 1, 2, 3, last_row, 2, 2, 2, 0};
+        const ov::Shape packed_shape{3, 3};
+
+        const bool is_packed = bag_type == "EmbeddingBagPackedSum";
+        init_input_shapes({{{}, {is_packed ? packed_shape : ov::Shape{indices.size()}}}});
+
+        auto per_sample_weights = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, inputDynamicShapes[0]);
+
+        const bool is_integer = ov::element::Type(table_precision).is_integral();
+        const auto table_data = is_integer ? ov::test::utils::InputGenerateData(-5, 10)
+                                           : ov::test::utils::InputGenerateData(-1, 2, 100);
+        auto table = ov::test::utils::make_constant(table_precision, table_shape, table_data);
+        std::shared_ptr<ov::Node> decompressed_table = std::make_shared<ov::op::v0::Convert>(table, ov::element::f32);
+        decompressed_table->set_friendly_name("table_convert");
+        fused_ops = {"table_convert"};
+        if (is_integer) {
+            ov::Shape decompression_shape(table_shape.size(), 1);
+            if (per_row)
+                decompression_shape[0] = rows;
+            if (with_subtract) {
+                auto zero_point = ov::test::utils::make_constant(table_precision, decompression_shape,
+                                                                 ov::test::utils::InputGenerateData(-2, 4));
+                auto zero_point_convert = std::make_shared<ov::op::v0::Convert>(zero_point, ov::element::f32);
+                decompressed_table = std::make_shared<ov::op::v1::Subtract>(decompressed_table, zero_point_convert);
+                decompressed_table->set_friendly_name("decompression_subtract");
+                fused_ops.push_back("decompression_subtract");
+            }
+            auto scale = ov::test::utils::make_constant(ov::element::f32, decompression_shape,
+                                                        ov::test::utils::InputGenerateData(0.01, 1, 1000));
+            decompressed_table = std::make_shared<ov::op::v1::Multiply>(decompressed_table, scale);
+            decompressed_table->set_friendly_name("decompression_multiply");
+            fused_ops.push_back("decompression_multiply");
+        } else {
+            ov::mark_as_decompression(decompressed_table);
+        }
+
+        auto default_index = ov::op::v0::Constant::create(ov::element::i32, {}, {0});
+        std::shared_ptr<ov::Node> embedding_bag;
+        if (bag_type == "EmbeddingBagOffsetsSum") {
+            auto indices_const = ov::op::v0::Constant::create(ov::element::i32, {indices.size()}, indices);
+            auto offsets_const = ov::op::v0::Constant::create(ov::element::i32, {offsets.size()}, offsets);
+            embedding_bag = std::make_shared<ov::op::v3::EmbeddingBagOffsetsSum>(decompressed_table,
+                                                                                 indices_const,
+                                                                                 offsets_const,
+                                                                                 default_index,
+                                                                                 per_sample_weights);
+        } else if (is_packed) {
+            auto indices_const = ov::op::v0::Constant::create(ov::element::i32, packed_shape, packed_indices);
+            embedding_bag = std::make_shared<ov::op::v3::EmbeddingBagPackedSum>(decompressed_table,
+                                                                                indices_const,
+                                                                                per_sample_weights);
+        } else {
+            auto indices_const = ov::op::v0::Constant::create(ov::element::i32, {indices.size()}, indices);
+            auto segment_ids_const = ov::op::v0::Constant::create(ov::element::i32, {segment_ids.size()}, segment_ids);
+            // the segments 1 and 4 are empty
+            auto num_segments = ov::op::v0::Constant::create(ov::element::i32, {}, {5});
+            embedding_bag = std::make_shared<ov::op::v3::EmbeddingSegmentsSum>(decompressed_table,
+                                                                               indices_const,
+                                                                               segment_ids_const,
+                                                                               num_segments,
+                                                                               default_index,
+                                                                               per_sample_weights);
+        }
+        embedding_bag->set_friendly_name("embedding_bag");
+        function = std::make_shared<ov::Model>(embedding_bag, ov::ParameterVector{per_sample_weights},
+                                               "EmbeddingBagWeightsDecompression");
+    }
+
+    void check_results() {
+        const auto& bag_type = std::get<0>(GetParam());
+        const auto& table_precision = std::get<2>(GetParam());
+        // the decompression is fused into the embedding bag node, which reads the compressed table
+        bool is_bag_found = false;
+        for (const auto& n : compiledModel.get_runtime_model()->get_ordered_ops()) {
+            auto layer_type = n->get_rt_info().at(ov::exec_model_info::LAYER_TYPE).as<std::string>();
+            if (layer_type != bag_type)
+                continue;
+            is_bag_found = true;
+            ASSERT_EQ(n->get_input_element_type(0), table_precision);
+            const auto table_layer_type =
+                n->get_input_node_ptr(0)->get_rt_info().at(ov::exec_model_info::LAYER_TYPE).as<std::string>();
+            ASSERT_EQ(table_layer_type, "Constant");
+            const auto original_names = n->get_rt_info().at(ov::exec_model_info::ORIGINAL_NAMES).as<std::string>();
+            for (const auto& fused_op : fused_ops) {
+                ASSERT_NE(original_names.find(fused_op), std::string::npos) << fused_op << " is not fused";
+            }
+        }
+        ASSERT_TRUE(is_bag_found);
+        CheckNumberOfNodesWithType(compiledModel, "Convert", 0);
+        CheckNumberOfNodesWithType(compiledModel, "Eltwise", 0);
+    }
+
+    std::vector<std::string> fused_ops;
+};
+
+TEST_P(EmbeddingBagWeightsDecompression, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+    run();
+    check_results();
+}
+
+/*
+ * The i8 decompression is kept only for the embedding tables, for the other consumers it's folded
+ *
+ *    Weights(i8)
+ *       |
+ *    Convert
+ *       |
+ *    Multiply    Scale
+ *         \      /
+ *  Data    Multiply
+ *     \     /
+ *     MatMul
+ */
+class I8WeightsDecompressionNotEmbedding : public SubgraphBaseStaticTest, public CPUTestsBase {
+protected:
+    void SetUp() override {
+        targetDevice = ov::test::utils::DEVICE_CPU;
+        init_input_shapes({{{}, {{4, 16}}}});
+
+        auto data = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, inputDynamicShapes[0]);
+        auto weights = ov::test::utils::make_constant(ov::element::i8, ov::Shape{16, 8},
+                                                      ov::test::utils::InputGenerateData(-5, 10));
+        auto convert = std::make_shared<ov::op::v0::Convert>(weights, ov::element::f32);
+        auto scale = ov::test::utils::make_constant(ov::element::f32, ov::Shape{1, 8},
+                                                    ov::test::utils::InputGenerateData(0.01, 1, 1000));
+        auto multiply = std::make_shared<ov::op::v1::Multiply>(convert, scale);
+        auto matmul = std::make_shared<ov::op::v0::MatMul>(data, multiply);
+        function = std::make_shared<ov::Model>(matmul, ov::ParameterVector{data}, "I8WeightsDecompressionNotEmbedding");
+    }
+
+    void check_results() {
+        for (const auto& n : compiledModel.get_runtime_model()->get_ordered_ops()) {
+            ASSERT_NE(n->get_output_element_type(0), ov::element::i8) << n->get_friendly_name();
+        }
+        CheckNumberOfNodesWithType(compiledModel, "Convert", 0);
+        CheckNumberOfNodesWithType(compiledModel, "Eltwise", 0);
+    }
+};
+
+TEST_F(I8WeightsDecompressionNotEmbedding, smoke_CompareWithRefs) {
+    run();
+    check_results();
+}
+
+namespace {
+
+const std::vector<std::string> bag_types = {"EmbeddingBagOffsetsSum",
+                                            "EmbeddingBagPackedSum",
+                                            "EmbeddingSegmentsSum"};
+
+const std::vector<ov::Shape> table_shapes = {{20, 16}, {37, 83}, {40, 4, 17}};
+
+INSTANTIATE_TEST_SUITE_P(smoke_EmbeddingBagWeightsDecompression_f16_bf16,
+                         EmbeddingBagWeightsDecompression,
+                         ::testing::Combine(::testing::ValuesIn(bag_types),
+                                            ::testing::ValuesIn(table_shapes),
+                                            ::testing::Values(ov::element::f16, ov::element::bf16),
+                                            ::testing::Values(false),
+                                            ::testing::Values(false)),
+                         EmbeddingBagWeightsDecompression::getTestCaseName);
+
+INSTANTIATE_TEST_SUITE_P(smoke_EmbeddingBagWeightsDecompression_int8,
+                         EmbeddingBagWeightsDecompression,
+                         ::testing::Combine(::testing::ValuesIn(bag_types),
+                                            ::testing::ValuesIn(table_shapes),
+                                            ::testing::Values(ov::element::u8, ov::element::i8),
+                                            ::testing::Values(false, true),
+                                            ::testing::Values(false, true)),
+                         EmbeddingBagWeightsDecompression::getTestCaseName);
+
+}  // namespace
+}  // namespace test
+}  // namespace ov
@@ -71,4 +71,24 @@ INSTANTIATE_TEST_SUITE_P(smoke_set5, GatherElementsLayerTest,
                             ::testing::ValuesIn(indices_types),
                             ::testing::Values(ov::test::utils::DEVICE_CPU)),
                         GatherElementsLayerTest::getTestCaseName);
+
+INSTANTIATE_TEST_SUITE_P(smoke_set6, GatherElementsLayerTest,
+                        ::testing::Combine(
+                            ::testing::Values(ov::test::static_shapes_to_test_representation({ov::Shape{2, 37, 19}})),
+                            ::testing::Values(ov::Shape{2, 21, 19}),
+                            ::testing::Values(1, -2),
+                            ::testing::ValuesIn(model_types),
+                            ::testing::ValuesIn(indices_types),
+                            ::testing::Values(ov::test::utils::DEVICE_CPU)),
+                        GatherElementsLayerTest::getTestCaseName);
+
+INSTANTIATE_TEST_SUITE_P(smoke_set7, GatherElementsLayerTest,
+                        ::testing::Combine(
+                            ::testing::Values(ov::test::static_shapes_to_test_representation({ov::Shape{3, 5, 70}})),
+                            ::testing::Values(ov::Shape{3, 5, 45}),
+                            ::testing::Values(2, -1),
+                            ::testing::ValuesIn(model_types),
+                            ::testing::ValuesIn(indices_types),
+                            ::testing::Values(ov::test::utils::DEVICE_CPU)),
+                        GatherElementsLayerTest::getTestCaseName);
 }  // namespace
@@ -0,0 +1,84 @@
+// Copyright (C) 2018-2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <memory>
+
+#include <openvino/core/model.hpp>
+#include <openvino/opsets/opset1.hpp>
+#include <transformations/cpu_opset/common/pass/hoist_tensor_iterator_input_projection.hpp>
+
+#include "common_test_utils/ov_test_utils.hpp"
+
+using namespace testing;
+using namespace ov::intel_cpu;
+
+namespace {
+
+// H(t) = tanh(X(t) * W^T + H(t-1))
+std::shared_ptr<ov::Model> make_rnn_body(const std::shared_ptr<ov::opset1::Parameter>& x_t,
+                                         const std::shared_ptr<ov::opset1::Parameter>& h,
+                                         bool projected) {
+    ov::Output<ov::Node> input =
+        std::make_shared<ov::opset1::Squeeze>(x_t, ov::opset1::Constant::create(ov::element::i64, {1}, {1}));
+    if (!projected) {
+        auto w = ov::opset1::Constant::create(ov::element::f32, ov::Shape{16, 8}, {0.5f});
+        input = std::make_shared<ov::opset1::MatMul>(input, w, false, true);
+    }
+    auto add = std::make_shared<ov::opset1::Add>(input, h);
+    auto tanh = std::make_shared<ov::opset1::Tanh>(add);
+    auto result = std::make_shared<ov::opset1::Result>(tanh);
+    return std::make_shared<ov::Model>(ov::ResultVector{result}, ov::ParameterVector{x_t, h});
+}
+
+std::shared_ptr<ov::Model> make_model(bool projected) {
+    auto x = std::make_shared<ov::opset1::Parameter>(ov::element::f32, ov::PartialShape{2, -1, 8});
+    auto h_init = std::make_shared<ov::opset1::Parameter>(ov::element::f32, ov::Shape{2, 16});
+    ov::Output<ov::Node> input = x;
+    if (projected) {
+        auto w = ov::opset1::Constant::create(ov::element::f32, ov::Shape{16, 8}, {0.5f});
+        input = std::make_shared<ov::opset1::MatMul>(x, w, false, true);
+    }
+    auto x_t = std::make_shared<ov::opset1::Parameter>(ov::element::f32, ov::Shape{2, 1, projected ? 16lu : 8lu});
+    auto h = std::make_shared<ov::opset1::Parameter>(ov::element::f32, ov::Shape{2, 16});
+    auto body = make_rnn_body(x_t, h, projected);
+
+    auto ti = std::make_shared<ov::opset1::TensorIterator>();
+    ti->set_body(body);
+    ti->set_sliced_input(x_t, input, 0, 1, 1, -1, 1);
+    ti->set_merged_input(h, h_init, body->get_results()[0]);
+    auto h_last = ti->get_iter_value(body->get_results()[0], -1);
+    return std::make_shared<ov::Model>(ov::OutputVector{h_last}, ov::ParameterVector{x, h_init});
+}
+
+}  // namespace
+
+TEST_F(TransformationTestsF, HoistTensorIteratorInputProjection) {
+    model = make_model(false);
+    manager.register_pass<HoistTensorIteratorInputProjection>();
+    model_ref = make_model(true);
+}
+
+TEST_F(TransformationTestsF, HoistTensorIteratorInputProjection_SlicedParameterUsedTwice) {
+    {
+        auto x = std::make_shared<ov::opset1::Parameter>(ov::element::f32, ov::PartialShape{2, -1, 8});
+        auto x_t = std::make_shared<ov::opset1::Parameter>(ov::element::f32, ov::Shape{2, 1, 8});
+        auto squeeze = std::make_shared<ov::opset1::Squeeze>(x_t,
+                                                             ov::opset1::Constant::create(ov::element::i64, {1}, {1}));
+        auto w = ov::opset1::Constant::create(ov::element::f32, ov::Shape{8, 8}, {0.5f});
+        auto matmul = std::make_shared<ov::opset1::MatMul>(squeeze, w);
+        // the slice itself is used by the body as well
+        auto add = std::make_shared<ov::opset1::Add>(matmul, squeeze);
+        auto result = std::make_shared<ov::opset1::Result>(add);
+        auto body = std::make_shared<ov::Model>(ov::ResultVector{result}, ov::ParameterVector{x_t});
+
+        auto ti = std::make_shared<ov::opset1::TensorIterator>();
+        ti->set_body(body);
+        ti->set_sliced_input(x_t, x, 0, 1, 1, -1, 1);
+        auto out = ti->get_concatenated_slices(result, 0, 1, 1, -1, 1);
+        model = std::make_shared<ov::Model>(ov::OutputVector{out}, ov::ParameterVector{x});
+        manager.register_pass<HoistTensorIteratorInputProjection>();
+    }
+}
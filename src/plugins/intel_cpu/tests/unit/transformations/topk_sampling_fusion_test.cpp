@@ -0,0 +1,131 @@
+// Copyright (C) 2018-2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <memory>
+
+#include <openvino/core/model.hpp>
+#include <openvino/opsets/opset13.hpp>
+#include <transformations/cpu_opset/common/pass/topk_sampling_fusion.hpp>
+#include <transformations/cpu_opset/common/op/topk_sampling.hpp>
+#include <openvino/pass/manager.hpp>
+#include "common_test_utils/ov_test_utils.hpp"
+
+using namespace testing;
+using namespace ov::intel_cpu;
+
+static std::shared_ptr<ov::Node> makeSamplingHead(const std::shared_ptr<ov::Node>& logits,
+                                                  int64_t top_k,
+                                                  float temperature,
+                                                  bool log_probs,
+                                                  float top_p = 1.f) {
+    auto scale = ov::opset13::Constant::create(ov::element::f32, ov::Shape{}, {temperature});
+    auto scaled = std::make_shared<ov::opset13::Divide>(logits, scale);
+    auto k = ov::opset13::Constant::create(ov::element::i64, ov::Shape{}, {top_k});
+    auto topk = std::make_shared<ov::opset13::TopK>(scaled,
+                                                   k,
+                                                   1,
+                                                   ov::op::TopKMode::MAX,
+                                                   ov::op::TopKSortType::SORT_VALUES,
+                                                   ov::element::i32);
+    auto softmax = std::make_shared<ov::opset13::Softmax>(topk->output(0), -1);
+    ov::Output<ov::Node> probs = softmax;
+    if (top_p < 1.f) {
+        auto axis = ov::opset13::Constant::create(ov::element::i64, ov::Shape{}, {-1});
+        auto cumsum = std::make_shared<ov::opset13::CumSum>(softmax, axis);
+        auto exclusive_sum = std::make_shared<ov::opset13::Subtract>(cumsum, softmax);
+        auto threshold = ov::opset13::Constant::create(ov::element::f32, ov::Shape{}, {top_p});
+        auto mask = std::make_shared<ov::opset13::Less>(exclusive_sum, threshold);
+        auto zero = ov::opset13::Constant::create(ov::element::f32, ov::Shape{}, {0.f});
+        probs = std::make_shared<ov::opset13::Select>(mask, softmax, zero);
+    }
+    auto num_samples = ov::opset13::Constant::create(ov::element::i32, ov::Shape{1}, {1});
+    auto multinomial =
+        std::make_shared<ov::opset13::Multinomial>(probs, num_samples, ov::element::i32, false, log_probs, 1, 2);
+    auto axis = ov::opset13::Constant::create(ov::element::i32, ov::Shape{}, {1});
+    return std::make_shared<ov::opset13::Gather>(topk->output(1), multinomial, axis, 1);
+}
+
+TEST(TransformationTests, TopKSamplingFusion) {
+    std::shared_ptr<ov::Model> f(nullptr), f_ref(nullptr);
+    {
+        auto logits = std::make_shared<ov::opset13::Parameter>(ov::element::f32, ov::PartialShape{-1, 32000});
+        auto tokens = makeSamplingHead(logits, 50, 0.7f, false);
+
+        f = std::make_shared<ov::Model>(ov::NodeVector{tokens}, ov::ParameterVector{logits});
+        ov::pass::Manager m;
+        m.register_pass<TopKSamplingFusion>();
+        m.run_passes(f);
+    }
+    {
+        auto logits = std::make_shared<ov::opset13::Parameter>(ov::element::f32, ov::PartialShape{-1, 32000});
+        auto num_samples = ov::opset13::Constant::create(ov::element::i32, ov::Shape{1}, {1});
+        TopKSamplingNode::Config config;
+        config.top_k = 50;
+        config.temperature = 0.7f;
+        config.global_seed = 1;
+        config.op_seed = 2;
+        auto sampling = std::make_shared<TopKSamplingNode>(logits, num_samples, config);
+
+        f_ref = std::make_shared<ov::Model>(ov::OutputVector{sampling->output(1)}, ov::ParameterVector{logits});
+    }
+
+    auto res = compare_functions(f, f_ref);
+    ASSERT_TRUE(res.first) << res.second;
+}
+
+TEST(TransformationTests, TopKSamplingFusionLogProbs) {
+    std::shared_ptr<ov::Model> f(nullptr), f_ref(nullptr);
+    {
+        auto logits = std::make_shared<ov::opset13::Parameter>(ov::element::f32, ov::PartialShape{-1, 32000});
+        auto tokens = makeSamplingHead(logits, 50, 0.7f, true);
+
+        f = std::make_shared<ov::Model>(ov::NodeVector{tokens}, ov::ParameterVector{logits});
+        ov::pass::Manager m;
+        m.register_pass<TopKSamplingFusion>();
+        m.run_passes(f);
+    }
+    {
+        auto logits = std::make_shared<ov::opset13::Parameter>(ov::element::f32, ov::PartialShape{-1, 32000});
+        auto tokens = makeSamplingHead(logits, 50, 0.7f, true);
+
+        f_ref = std::make_shared<ov::Model>(ov::NodeVector{tokens}, ov::ParameterVector{logits});
+    }
+
+    auto res = compare_functions(f, f_ref);
+    ASSERT_TRUE(res.first) << res.second;
+}
+
+TEST(TransformationTests, TopKSamplingFusionTopP) {
+    std::shared_ptr<ov::Model> f(nullptr), f_ref(nullptr);
+    {
+        auto logits = std::make_shared<ov::opset13::Parameter>(ov::element::f32, ov::PartialShape{-1, 32000});
+        auto tokens = makeSamplingHead(logits, 50, 0.7f, false, 0.9f);
+
+        f = std::make_shared<ov::Model>(ov::NodeVector{tokens}, ov::ParameterVector{logits});
+        ov::pass::Manager m;
+        m.register_pass<TopKSamplingFusion>();
+        m.run_passes(f);
+    }
+    {
+        auto logits = std::make_shared<ov::opset13::Parameter>(ov::element::f32, ov::PartialShape{-1, 32000});
+        auto num_samples = ov::opset13::Constant::create(ov::element::i32, ov::Shape{1}, {1});
+        TopKSamplingNode::Config config;
+        config.top_k = 50;
+        config.temperature = 0.7f;
+        config.top_p = 0.9f;
+        config.global_seed = 1;
+        config.op_seed = 2;
+        auto sampling = std::make_shared<TopKSamplingNode>(logits, num_samples, config);
+
+        f_ref = std::make_shared<ov::Model>(ov::OutputVector{sampling->output(1)}, ov::ParameterVector{logits});
+    }
+
+    // the fused top_p is an attribute
+    auto fc = FunctionsComparator::with_default();
+    fc.enable(FunctionsComparator::ATTRIBUTES);
+    auto res = fc.compare(f, f_ref);
+    ASSERT_TRUE(res.valid) << res.message;
+}